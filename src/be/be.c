@@ -15,9 +15,12 @@
 #include "kob.h"
 #include "mkboard.h"
 #include "mkdebug.h"
+#include "mkmonitor.h"
+#include "mksim.h"
 #include "mkwire.h"
 #include "morse.h"
 #include "net.h"
+#include "ntp.h"
 #include "util.h"
 #include "hardware/rtc.h"
 
@@ -32,25 +35,37 @@ static void _handle_config_changed(cmt_msg_t* msg);
 static void _handle_cmt_sleep(cmt_msg_t* msg);
 static void _handle_kob_key_read(cmt_msg_t* msg);
 static void _handle_kob_sound_code_cont(cmt_msg_t* msg);
+static void _handle_mks_ack_timeout(cmt_msg_t* msg);
+static void _handle_mks_capture_packet(cmt_msg_t* msg);
 static void _handle_mks_keep_alive_send(cmt_msg_t* msg);
+static void _handle_mks_monitor_ack_timeout(cmt_msg_t* msg);
+static void _handle_mks_monitor_packet_received(cmt_msg_t* msg);
+static void _handle_mks_packet_received(cmt_msg_t* msg);
+static void _handle_mks_sim_send(cmt_msg_t* msg);
+static void _handle_mks_sim_start(cmt_msg_t* msg);
+static void _handle_mks_sim_stop(cmt_msg_t* msg);
 static void _handle_morse_decode_flush(cmt_msg_t* msg);
 static void _handle_morse_to_decode(cmt_msg_t* msg);
 static void _handle_send_be_status(cmt_msg_t* msg);
 static void _handle_ui_initialized(cmt_msg_t* msg);
+static void _handle_wire_code_playout(cmt_msg_t* msg);
 static void _handle_wire_connect(cmt_msg_t* msg);
 static void _handle_wire_connect_toggle(cmt_msg_t* msg);
 static void _handle_wire_disconnect(cmt_msg_t* msg);
+static void _handle_wire_monitor_connect(cmt_msg_t* msg);
+static void _handle_wire_monitor_toggle(cmt_msg_t* msg);
 static void _handle_wire_set(cmt_msg_t* msg);
 
 // Idle functions...
 static void _be_idle_function_1();
 static void _be_idle_function_2();
 static void _be_idle_function_3();
+static void _be_idle_function_4();
+static void _be_idle_function_5();
 
 static cmt_msg_t _msg_be_send_status;
 static cmt_msg_t _msg_be_initialized;
 
-static uint32_t _last_rtc_update_ts; // ms timestamp of the last time we updated the RTC
 static uint32_t _last_status_update_ts; // ms timestamp of last status update
 
 static const msg_handler_entry_t _be_test = { MSG_BE_TEST, _handle_be_test };
@@ -58,30 +73,52 @@ static const msg_handler_entry_t _config_changed_handler_entry = { MSG_CONFIG_CH
 static const msg_handler_entry_t _cmt_sm_tick_handler_entry = { MSG_CMT_SLEEP, _handle_cmt_sleep };
 static const msg_handler_entry_t _kob_key_read_handler_entry = { MSG_KEY_READ, _handle_kob_key_read };
 static const msg_handler_entry_t _kob_sound_code_cont_handler_entry = { MSG_KOB_SOUND_CODE_CONT, _handle_kob_sound_code_cont };
+static const msg_handler_entry_t _mks_ack_timeout_handler_entry = { MSG_MKS_ACK_TIMEOUT, _handle_mks_ack_timeout };
+static const msg_handler_entry_t _mks_capture_packet_handler_entry = { MSG_MKS_CAPTURE_PACKET, _handle_mks_capture_packet };
 static const msg_handler_entry_t _mks_keep_alive_send_handler_entry = { MSG_MKS_KEEP_ALIVE_SEND, _handle_mks_keep_alive_send };
+static const msg_handler_entry_t _mks_monitor_ack_timeout_handler_entry = { MSG_MKS_MONITOR_ACK_TIMEOUT, _handle_mks_monitor_ack_timeout };
+static const msg_handler_entry_t _mks_monitor_packet_received_handler_entry = { MSG_MKS_MONITOR_PACKET_RECEIVED, _handle_mks_monitor_packet_received };
+static const msg_handler_entry_t _mks_packet_received_handler_entry = { MSG_MKS_PACKET_RECEIVED, _handle_mks_packet_received };
+static const msg_handler_entry_t _mks_sim_send_handler_entry = { MSG_MKS_SIM_SEND, _handle_mks_sim_send };
+static const msg_handler_entry_t _mks_sim_start_handler_entry = { MSG_MKS_SIM_START, _handle_mks_sim_start };
+static const msg_handler_entry_t _mks_sim_stop_handler_entry = { MSG_MKS_SIM_STOP, _handle_mks_sim_stop };
 static const msg_handler_entry_t _morse_decode_flush_handler_entry = { MSG_MORSE_DECODE_FLUSH, _handle_morse_decode_flush };
 static const msg_handler_entry_t _morse_to_decode_handler_entry = { MSG_MORSE_CODE_SEQUENCE, _handle_morse_to_decode };
 static const msg_handler_entry_t _send_be_status_handler_entry = { MSG_SEND_BE_STATUS, _handle_send_be_status };
 static const msg_handler_entry_t _ui_initialized_handler_entry = { MSG_UI_INITIALIZED, _handle_ui_initialized };
+static const msg_handler_entry_t _wire_code_playout_handler_entry = { MSG_WIRE_CODE_PLAYOUT, _handle_wire_code_playout };
 static const msg_handler_entry_t _wire_connect_handler_entry = { MSG_WIRE_CONNECT, _handle_wire_connect };
 static const msg_handler_entry_t _wire_connect_toggle_handler_entry = { MSG_WIRE_CONNECT_TOGGLE, _handle_wire_connect_toggle };
 static const msg_handler_entry_t _wire_disconnect_handler_entry = { MSG_WIRE_DISCONNECT, _handle_wire_disconnect };
+static const msg_handler_entry_t _wire_monitor_connect_handler_entry = { MSG_WIRE_MONITOR_CONNECT, _handle_wire_monitor_connect };
+static const msg_handler_entry_t _wire_monitor_toggle_handler_entry = { MSG_WIRE_MONITOR_TOGGLE, _handle_wire_monitor_toggle };
 static const msg_handler_entry_t _wire_set_handler_entry = { MSG_WIRE_SET, _handle_wire_set };
 
 // For performance - put these in order that we expect to receive more often
 static const msg_handler_entry_t* _be_handler_entries[] = {
     & _cmt_sm_tick_handler_entry,
+    & _mks_packet_received_handler_entry,
     & _morse_to_decode_handler_entry,
+    & _mks_monitor_packet_received_handler_entry,
+    & _mks_sim_send_handler_entry,
+    & _mks_capture_packet_handler_entry,
+    & _wire_code_playout_handler_entry,
     & _morse_decode_flush_handler_entry,
     & _kob_key_read_handler_entry,
     & _kob_sound_code_cont_handler_entry,
     & _send_be_status_handler_entry,
     & _mks_keep_alive_send_handler_entry,
+    & _mks_ack_timeout_handler_entry,
+    & _mks_monitor_ack_timeout_handler_entry,
     & _wire_connect_handler_entry,
     & _wire_connect_toggle_handler_entry,
     & _wire_disconnect_handler_entry,
+    & _wire_monitor_connect_handler_entry,
+    & _wire_monitor_toggle_handler_entry,
     & _wire_set_handler_entry,
     & _config_changed_handler_entry,
+    & _mks_sim_start_handler_entry,
+    & _mks_sim_stop_handler_entry,
     & _ui_initialized_handler_entry,
     & _be_test,
     ((msg_handler_entry_t*)0), // Last entry must be a NULL
@@ -92,6 +129,8 @@ static const idle_fn _be_idle_functions[] = {
     (idle_fn)_be_idle_function_1,
     (idle_fn)_be_idle_function_2,
     (idle_fn)_be_idle_function_3,
+    (idle_fn)_be_idle_function_4,
+    (idle_fn)_be_idle_function_5,
     (idle_fn)0, // Last entry must be a NULL
 };
 
@@ -113,13 +152,9 @@ static void _be_idle_function_1() {
 }
 
 static void _be_idle_function_2() {
-    uint32_t now = now_ms();
-    if (_last_rtc_update_ts + HOUR_IN_MS < now) {
-        // Keep the RTC set correctly by making a NTP call.
-        _last_rtc_update_ts = now;
-        const config_sys_t* cfgsys = config_sys();
-        network_update_rtc(cfgsys->tz_offset);
-    }
+    // Keep the wall clock (and the RTC) in step with NTP.
+    const config_sys_t* cfgsys = config_sys();
+    ntp_poll(cfgsys->tz_offset);
 }
 
 static void _be_idle_function_3() {
@@ -132,6 +167,14 @@ static void _be_idle_function_3() {
     }
 }
 
+static void _be_idle_function_4() {
+    wifi_connection_check();  // Keep WiFi connected (and start a bind waiting for it)
+}
+
+static void _be_idle_function_5() {
+    mkmonitor_decode_flush_check();  // Finish decoding on monitored wires that have gone quiet
+}
+
 
 // ====================================================================
 // Message handler functions
@@ -196,10 +239,43 @@ static void _handle_kob_sound_code_cont(cmt_msg_t* msg) {
     kob_sound_code_continue();
 }
 
+static void _handle_mks_ack_timeout(cmt_msg_t* msg) {
+    mkwire_ack_timeout();
+}
+
+static void _handle_mks_capture_packet(cmt_msg_t* msg) {
+    // A packet from a capture being replayed.
+    mkwire_recv_inject(msg->data.pbuf);
+}
+
 static void _handle_mks_keep_alive_send(cmt_msg_t* msg) {
     mkwire_keep_alive_send();
 }
 
+static void _handle_mks_monitor_ack_timeout(cmt_msg_t* msg) {
+    mkmonitor_ack_timeout();
+}
+
+static void _handle_mks_monitor_packet_received(cmt_msg_t* msg) {
+    mkmonitor_recv_process();
+}
+
+static void _handle_mks_packet_received(cmt_msg_t* msg) {
+    mkwire_recv_process();
+}
+
+static void _handle_mks_sim_send(cmt_msg_t* msg) {
+    mksim_send();
+}
+
+static void _handle_mks_sim_start(cmt_msg_t* msg) {
+    mksim_start(&msg->data.sim_params);
+}
+
+static void _handle_mks_sim_stop(cmt_msg_t* msg) {
+    mksim_stop();
+}
+
 static void _handle_morse_decode_flush(cmt_msg_t* msg) {
     // Call the morse decode flush function to force a decode operation to complete.
     morse_decode_flush();
@@ -215,6 +291,7 @@ static void _handle_morse_to_decode(cmt_msg_t* msg) {
     mcode_seq_t* mcode_seq = msg->data.mcode_seq; // Contained code_seq and mcode_seq need to be freed when done.
     kob_sound_code(mcode_seq);
     morse_decode(mcode_seq);
+    mksim_decoded(mcode_seq);
     mcode_seq_free(mcode_seq);
 }
 
@@ -240,10 +317,23 @@ static void _handle_ui_initialized(cmt_msg_t* msg) {
     }
 }
 
+static void _handle_wire_code_playout(cmt_msg_t* msg) {
+    mkwire_code_playout();
+}
+
 static void _handle_wire_disconnect(cmt_msg_t* msg) {
     mkwire_disconnect();
 }
 
+static void _handle_wire_monitor_connect(cmt_msg_t* msg) {
+    mkmonitor_connect_next();
+}
+
+static void _handle_wire_monitor_toggle(cmt_msg_t* msg) {
+    unsigned short wire = msg->data.wire;
+    mkmonitor_toggle(wire);
+}
+
 static void _handle_wire_connect(cmt_msg_t* msg) {
     unsigned short wire = msg->data.wire;
     mkwire_connect(wire);
@@ -259,7 +349,6 @@ static void _handle_wire_set(cmt_msg_t* msg) {
 }
 
 void be_module_init() {
-    _last_rtc_update_ts = 0;
     char hostname[NET_URL_MAX_LEN + 1];
     const config_t* cfg = config_current();
     _last_cfg = config_new(cfg);
@@ -17,6 +17,8 @@ extern "C" {
 #include <stdint.h>
 #include "gfx.h"
 #include "kob_t.h"
+#include "mksim.h"
+#include "mkstation.h"
 #include "morse.h"
 #include "pico/types.h"
 
@@ -32,15 +34,25 @@ typedef enum _MSG_ID_ {
     MSG_CMT_SLEEP,
     MSG_KEY_READ,
     MSG_KOB_SOUND_CODE_CONT,
+    MSG_MKS_ACK_TIMEOUT,
+    MSG_MKS_CAPTURE_PACKET,
     MSG_MKS_KEEP_ALIVE_SEND,
+    MSG_MKS_MONITOR_ACK_TIMEOUT,
+    MSG_MKS_MONITOR_PACKET_RECEIVED,
     MSG_MKS_PACKET_RECEIVED,
+    MSG_MKS_SIM_SEND,
+    MSG_MKS_SIM_START,
+    MSG_MKS_SIM_STOP,
     MSG_MORSE_DECODE_FLUSH,
     MSG_MORSE_CODE_SEQUENCE,
     MSG_SEND_BE_STATUS,
     MSG_UI_INITIALIZED,
+    MSG_WIRE_CODE_PLAYOUT,
     MSG_WIRE_CONNECT,
     MSG_WIRE_CONNECT_TOGGLE,
     MSG_WIRE_DISCONNECT,
+    MSG_WIRE_MONITOR_CONNECT,
+    MSG_WIRE_MONITOR_TOGGLE,
     MSG_WIRE_SET,
     //
     // Front-End/UI messages
@@ -55,10 +67,14 @@ typedef enum _MSG_ID_ {
     MSG_TOUCH_PANEL,
     MSG_UPDATE_UI_STATUS,
     MSG_WIFI_CONN_STATUS_UPDATE,
+    MSG_WIRE_CAPTURE_REPLAY,
+    MSG_WIRE_CAPTURE_WRITE,
     MSG_WIRE_CHANGED,
     MSG_WIRE_CONNECTED_STATE,
     MSG_WIRE_CURRENT_SENDER,
-    MSG_WIRE_STATION_ID_RCVD,
+    MSG_WIRE_STATION_ADDED,
+    MSG_WIRE_STATION_EXPIRED,
+    MSG_WIRE_STATION_UPDATED,
     MSG_WIRE_STATIONS_CLEARED,
 } msg_id_t;
 
@@ -87,7 +103,9 @@ typedef union _MSG_DATA_VALUE {
     kob_status_t kob_status;
     mcode_seq_t* mcode_seq;
     _cmt_sleep_data_t* cmt_sleep;
-    const char* station_id;
+    struct pbuf* pbuf;
+    mksim_params_t sim_params;
+    mk_station_handle_t station;
     char* str;
     int32_t status;
     gfx_point* touch_point;
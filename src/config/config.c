@@ -154,6 +154,11 @@ static int _scih_disp_wrap_back_writer(const sys_cfg_item_handler_class_t* self,
 static const struct _SYS_CFG_ITEM_HANDLER_CLASS_ _scihc_disp_wrap_back =
 { "disp_wrap_back", "Display text characters to scan back for EOL wrap", _SYSCFG_DWB_ID, _scih_disp_wrap_back_reader, _scih_disp_wrap_back_writer};
 
+static int _scih_disp_font_ram_reader(const sys_cfg_item_handler_class_t* self, config_sys_t* sys_cfg, const char* value);
+static int _scih_disp_font_ram_writer(const sys_cfg_item_handler_class_t* self, const config_sys_t* sys_cfg, char* buf, bool full);
+static const struct _SYS_CFG_ITEM_HANDLER_CLASS_ _scihc_disp_font_ram =
+{ "disp_font_ram", "Display renders from a copy of the font in RAM", _SYSCFG_DFR_ID, _scih_disp_font_ram_reader, _scih_disp_font_ram_writer};
+
 static int _scih_wifi_password_reader(const sys_cfg_item_handler_class_t* self, config_sys_t* sys_cfg, const char* value);
 static int _scih_wifi_password_writer(const sys_cfg_item_handler_class_t* self, const config_sys_t* sys_cfg, char* buf, bool full);
 static const struct _SYS_CFG_ITEM_HANDLER_CLASS_ _scihc_wifi_password =
@@ -170,6 +175,7 @@ static const sys_cfg_item_handler_class_t* _sys_cfg_handlers[] = {
     & _scihc_wifi_password,
     & _scihc_ssid,
     & _scihc_disp_wrap_back,
+    & _scihc_disp_font_ram,
     ((const sys_cfg_item_handler_class_t*)0), // NULL last item to signify end
 };
 
@@ -601,6 +607,29 @@ static int _scih_disp_wrap_back_writer(const sys_cfg_item_handler_class_t* self,
     return (len);
 }
 
+static int _scih_disp_font_ram_reader(const sys_cfg_item_handler_class_t* self, config_sys_t* sys_cfg, const char* value) {
+    int retval = -1;
+
+    bool b = bool_from_str(value);
+    sys_cfg->disp_font_ram = b;
+    retval = 1;
+
+    return (retval);
+}
+
+static int _scih_disp_font_ram_writer(const sys_cfg_item_handler_class_t* self, const config_sys_t* sys_cfg, char* buf, bool full) {
+    int len = 0;
+
+    // If full - print comment and key
+    if (full) {
+        len = sprintf(buf, "# Display renders from a copy of the font in RAM (rather than flash).\n%s=", self->key);
+    }
+    // format the value we are responsible for
+    len += sprintf(buf + len, "%hd", binary_from_int(sys_cfg->disp_font_ram));
+
+    return (len);
+}
+
 static int _scih_wifi_password_reader(const sys_cfg_item_handler_class_t* self, config_sys_t* sys_cfg, const char* value) {
     int retval = -1;
 
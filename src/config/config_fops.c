@@ -32,6 +32,7 @@ static const char* _sys_cfg_filename = "mukob.sys.cfg";
 static const struct _SYS_CFG_ITEM_HANDLER_CLASS_** _sys_cfg_handlers;
 static const cfg_item_handler_class_t** _cfg_handlers;
 static FATFS _fs;
+static int _sd_holds = 0;
 
 static FRESULT _cfo_mount_sd() {
     FRESULT res = FR_OK;
@@ -49,7 +50,7 @@ static FRESULT _cfo_mount_sd() {
 static FRESULT _cfo_unmount_sd() {
     FRESULT res = FR_OK;
 
-    if (_fs.fs_type != 0) {
+    if (_fs.fs_type != 0 && 0 == _sd_holds) {
         res = f_unmount("0:");
         _fs.fs_type = 0;
     }
@@ -452,6 +453,22 @@ FRESULT cfo_save_sys_cfg(const config_sys_t* sys_cfg) {
     return (fr);
 }
 
+FRESULT cfo_sd_hold() {
+    FRESULT res = _cfo_mount_sd();
+    if (FR_OK == res) {
+        _sd_holds++;
+    }
+
+    return (res);
+}
+
+void cfo_sd_release() {
+    if (_sd_holds > 0) {
+        _sd_holds--;
+    }
+    _cfo_unmount_sd();
+}
+
 void config_fops_module_init(const sys_cfg_item_handler_class_t** sys_cfg_handlers, const cfg_item_handler_class_t** cfg_handlers) {
     assert(!_initialized);
     _sys_cfg_handlers = sys_cfg_handlers;
@@ -70,6 +70,24 @@ struct _CFG_ITEM_HANDLER_CLASS_ {
 //                                     const cfg_item_handler_class_t* (*) cfg_handlers[]);
 extern void config_fops_module_init(const sys_cfg_item_handler_class_t** sys_cfg_handlers, const cfg_item_handler_class_t** cfg_handlers);
 
+/**
+ * @brief Keep the SD card mounted (mounting it if needed).
+ * @ingroup config
+ *
+ * The config operations mount and unmount the card each time. This keeps it mounted
+ * for something that keeps a file open (the wire capture) until `cfo_sd_release` is
+ * called. This must be done on the UI core (as the config file operations are).
+ *
+ * @return F_OK if the card is mounted.
+ */
+extern FRESULT cfo_sd_hold();
+
+/**
+ * @brief Release a hold on the SD card (unmounting it if there are no other holds).
+ * @ingroup config
+ */
+extern void cfo_sd_release();
+
 /**
  * @brief Read a config file and set the values on a config object.
  * @ingroup config
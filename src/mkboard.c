@@ -42,6 +42,7 @@
 #include "mkdebug.h"
 #include "multicore.h"
 #include "net.h"
+#include "ntp.h"
 #include "term.h"
 #include "touch.h"
 #include "util.h"
@@ -207,13 +208,15 @@ int board_init() {
     config_module_init();
     const config_sys_t* system_cfg = config_sys();
 
+    ntp_module_init();
     if (system_cfg->is_set) {
-        // Make an NTP call to get the actual time and set the RTC correctly
+        // Connect to WiFi and use NTP to get the actual time and set the RTC correctly
         // This also initializes the network subsystem
+        // Ok to wait/`sleep` as msg system not started
         wifi_set_creds(system_cfg->wifi_ssid, system_cfg->wifi_password);
-        network_update_rtc(system_cfg->tz_offset);
-        // Give it time to make a NTP call
-        sleep_ms(1000); // Ok to `sleep` as msg system not started
+        if (wifi_connect_wait(WIFI_CONNECT_TIMEOUT_MS)) {
+            ntp_sync_wait(system_cfg->tz_offset, NTP_SYNC_WAIT_MS);
+        }
     }
     // Now read the RTC and print it
     char datetime_buf[256];
@@ -224,6 +227,7 @@ int board_init() {
     // Initialize the display
     display_reset_on(false);
     sleep_ms(100); // Ok to `sleep` as msg system not started
+    disp_font_ram(system_cfg->disp_font_ram);
     disp_module_init();
     disp_print_wrap_len_set(system_cfg->disp_wrap_back);
     display_backlight_on(true);
@@ -58,6 +58,7 @@ mcode_seq_t* mcode_seq_alloc(mcode_source_t source, code_element_t* code_seq, in
     else {
         mcode_seq->len = (len <= MKS_CODESEQ_MAX_LEN ? len : MKS_CODESEQ_MAX_LEN);
         mcode_seq->source = source;
+        mcode_seq->ts_recv = 0;
         memcpy(mcode_seq->code_seq, code_seq, mcode_seq->len * sizeof(code_element_t));
     }
 
@@ -74,6 +75,7 @@ int mcode_seq_append(mcode_seq_t* mcode_seq, code_element_t* code_seq, int len)
 
 mcode_seq_t* mcode_seq_copy(const mcode_seq_t* mcode_seq_src) {
     mcode_seq_t* mcode_seq = mcode_seq_alloc(mcode_seq_src->source, mcode_seq_src->code_seq, mcode_seq_src->len);
+    mcode_seq->ts_recv = mcode_seq_src->ts_recv;
 
     return (mcode_seq);
 }
@@ -87,6 +87,7 @@ typedef struct _MCODE_SEQ {
     mcode_source_t source;
     int len;
     code_element_t* code_seq;
+    uint32_t ts_recv;       // ms time a wire sequence was received (0 for other sources)
 } mcode_seq_t;
 
 /**
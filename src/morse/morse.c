@@ -13,6 +13,7 @@
 
 #include "cmt.h"
 #include "kob.h"
+#include "mkboard.h"
 #include "mkdebug.h"
 #include "util.h"
 
@@ -23,52 +24,26 @@
 // Internal function declarations
 
 static char _d_lookup_char(char* dds_buf);
-static void _d_post_decoded_text(char* cs, float spacing);
+static void _d_post_code_text(const char* text, void* handler_data);
+static void _d_post_decoded_text(morse_decoder_t* dec, char* cs, float spacing);
 static void _mstr_clear(char* dds_buf);
 
 // Class data
 
 static code_type_t _code_type;
 
-// For 'DECODE' we use a few static string buffers, rather than calloc/free over and over.
-#define _MSTRING_ALLOC_SIZE 32
-static char _d_mstr_1[_MSTRING_ALLOC_SIZE];
-static char _d_mstr_2[_MSTRING_ALLOC_SIZE];
-static char _d_mstr_3[_MSTRING_ALLOC_SIZE];
-static char _d_mstr_4[_MSTRING_ALLOC_SIZE];
-
-/**
- * @brief Decode morse (code duration) sequence processing data
- * @ingroup morse
- *
- * This holds data to build morse elements into based on timings
- * to allow them to be converted to a character (looked up from a code table).
- */
-typedef struct _DECODE_PROC_DATA_ {
-    char* morse_elements; // String buffer to build the dots-dashes into
-    float space_before;   // space before each character
-    float mark_len;       // length of last dot or dash in character
-} decode_proc_data_t;
+// For 'DECODE' each decoder has a few string buffers, rather than calloc/free over and over.
+#define _MSTRING_ALLOC_SIZE MORSE_MSTRING_SIZE
 
 #define _D_CHAR_ONE 0
 #define _D_CHAR_TWO 1
-#define _D_BOTH_CHARS 2
+#define _D_BOTH_CHARS MORSE_DECODE_CHARS
 // 'DECODE' data
-static decode_proc_data_t _d_process[_D_BOTH_CHARS]; // Processing data to build two Morse elements
-static bool _d_circuit_latched_closed; // True if cicuit has been latched closed by a +1 code element
-static int16_t _d_complete_chars; // number of complete characters in buffer
-static float _d_mark_len_total; // accumulates the length of a mark as positive code elements are received
-static float _d_space_len_total; // accumulates the length of a space as negative code elements are received
-// One-time calculated values based on the configured code speed
-static float _d_dot_len; // nominal dot length (ms)
-static float _d_tru_dot; // actual length of typical dot(ms)
 static uint8_t _d_wpm; // configured code speed (max of text and char speeds)
+// The decoder for the code that is sounded (the current wire and the key).
+static morse_decoder_t _decoder;
 // Scheduled message to cause character to be 'flushed' if time elapses before two have been received.
 static cmt_msg_t _decode_flusher_msg;
-// Detected code speed values. Start with the configured speed and calculated values
-static float _d_detected_dot_len; // = _d_dot_len
-static float _d_detected_tru_dot; // = _d_truDot
-static uint8_t _d_detected_wpm;   // = _d_wpm
 
 // 'ENCODE' data
 static code_spacing_t _e_spacing;
@@ -84,31 +59,32 @@ static int32_t _e_word_space; // Time between words (ms)
  * @brief Decode the current character with the next_space.
  * @ingroup morse
  *
+ * @param dec The decoder
  * @param next_space The next space time value
  */
-static void _d_decode_char(float next_space) {
-    float sp1 = _d_process[ _D_CHAR_ONE ].space_before; // space before 1st character
-    float sp2 = _d_process[ _D_CHAR_TWO ].space_before; // space before 2nd character
-    char* code = _d_mstr_3; // use one of our Morse-String buffers
-    char* cs = _d_mstr_4; // use another Morse-String buffers
+static void _d_decode_char(morse_decoder_t* dec, float next_space) {
+    float sp1 = dec->process[ _D_CHAR_ONE ].space_before; // space before 1st character
+    float sp2 = dec->process[ _D_CHAR_TWO ].space_before; // space before 2nd character
+    char* code = dec->code; // use one of our Morse-String buffers
+    char* cs = dec->cs; // use another Morse-String buffers
     _mstr_clear(code);
     _mstr_clear(cs);
 
-    _d_complete_chars += 1; // number of complete characters in buffer (1 or 2)
-    if (_d_complete_chars == _D_BOTH_CHARS && sp2 < (MD_MAX_MORSE_SPACE * _d_dot_len)
+    dec->complete_chars += 1; // number of complete characters in buffer (1 or 2)
+    if (dec->complete_chars == _D_BOTH_CHARS && sp2 < (MD_MAX_MORSE_SPACE * dec->dot_len)
         && (MD_MORSE_RATIO * sp1) > sp2 && sp2 < (MD_MORSE_RATIO * next_space)) {
         // could be two halves of a spaced character
         // try combining the two halves
-        strcat(code, _d_process[ _D_CHAR_ONE ].morse_elements); strcat(code, " "); strcat(code, _d_process[ _D_CHAR_TWO ].morse_elements);
+        strcat(code, dec->process[ _D_CHAR_ONE ].morse_elements); strcat(code, " "); strcat(code, dec->process[ _D_CHAR_TWO ].morse_elements);
         *cs = _d_lookup_char(code);
         if (*cs != '\000' && *cs != '&') {
             // yes, it's a spaced character, clear the buffers
-            _d_process[ _D_CHAR_TWO ].space_before = 0.0;
-            _mstr_clear(_d_process[ _D_CHAR_ONE ].morse_elements);
-            _d_process[ _D_CHAR_ONE ].mark_len = 0.0;
-            _mstr_clear(_d_process[ _D_CHAR_TWO ].morse_elements);
-            _d_process[ _D_CHAR_TWO ].mark_len = 0.0;
-            _d_complete_chars = 0;
+            dec->process[ _D_CHAR_TWO ].space_before = 0.0;
+            _mstr_clear(dec->process[ _D_CHAR_ONE ].morse_elements);
+            dec->process[ _D_CHAR_ONE ].mark_len = 0.0;
+            _mstr_clear(dec->process[ _D_CHAR_TWO ].morse_elements);
+            dec->process[ _D_CHAR_TWO ].mark_len = 0.0;
+            dec->complete_chars = 0;
         }
         else {
             // it's not recognized as a spaced character,
@@ -116,51 +92,51 @@ static void _d_decode_char(float next_space) {
             *cs = '\000';
         }
     }
-    if (_d_complete_chars == _D_BOTH_CHARS && sp2 < (MD_MIN_CHAR_SPACE * _d_dot_len)) {
+    if (dec->complete_chars == _D_BOTH_CHARS && sp2 < (MD_MIN_CHAR_SPACE * dec->dot_len)) {
         // it's a single character, merge the two halves
-        strcat(_d_process[ _D_CHAR_ONE ].morse_elements, _d_process[ _D_CHAR_TWO ].morse_elements);
-        _d_process[ _D_CHAR_ONE ].mark_len = _d_process[ _D_CHAR_TWO ].mark_len;
-        _mstr_clear(_d_process[ _D_CHAR_TWO ].morse_elements);
-        _d_process[ _D_CHAR_TWO ].space_before = 0.0;
-        _d_process[ _D_CHAR_TWO ].mark_len = 0.0;
-        _d_complete_chars = 1;
+        strcat(dec->process[ _D_CHAR_ONE ].morse_elements, dec->process[ _D_CHAR_TWO ].morse_elements);
+        dec->process[ _D_CHAR_ONE ].mark_len = dec->process[ _D_CHAR_TWO ].mark_len;
+        _mstr_clear(dec->process[ _D_CHAR_TWO ].morse_elements);
+        dec->process[ _D_CHAR_TWO ].space_before = 0.0;
+        dec->process[ _D_CHAR_TWO ].mark_len = 0.0;
+        dec->complete_chars = 1;
     }
-    if (_d_complete_chars == _D_BOTH_CHARS) {
+    if (dec->complete_chars == _D_BOTH_CHARS) {
         // decode the first character, otherwise wait for the next one to arrive
-        strcpy(code, _d_process[ _D_CHAR_ONE ].morse_elements);
+        strcpy(code, dec->process[ _D_CHAR_ONE ].morse_elements);
         *cs = _d_lookup_char(code);
-        if (*cs == 'T' && _d_process[ _D_CHAR_ONE ].mark_len > (MD_MAX_DASH_LEN * _d_dot_len)) {
+        if (*cs == 'T' && dec->process[ _D_CHAR_ONE ].mark_len > (MD_MAX_DASH_LEN * dec->dot_len)) {
             *cs = '_';
         }
-        else if (*cs == 'T' && _d_process[ _D_CHAR_ONE ].mark_len > (MD_MIN_L_LEN * _d_dot_len) &&
+        else if (*cs == 'T' && dec->process[ _D_CHAR_ONE ].mark_len > (MD_MIN_L_LEN * dec->dot_len) &&
                  CODE_TYPE_AMERICAN == _code_type) {
             *cs = 'L';
         }
         else if (*cs == 'E') {
-            if (_d_process[ _D_CHAR_ONE ].mark_len == 1.0) {
+            if (dec->process[ _D_CHAR_ONE ].mark_len == 1.0) {
                 *cs = '_';
             }
-            else if (_d_process[ _D_CHAR_ONE ].mark_len == 2.0) {
+            else if (dec->process[ _D_CHAR_ONE ].mark_len == 2.0) {
                 *cs = '_';
                 sp1 = 0; // ZZZ eliminate space between underscores
             }
         }
-        strcpy(_d_process[ _D_CHAR_ONE ].morse_elements, _d_process[ _D_CHAR_TWO ].morse_elements);
-        _d_process[ _D_CHAR_ONE ].space_before = _d_process[ _D_CHAR_TWO ].space_before;
-        _d_process[ _D_CHAR_ONE ].mark_len = _d_process[ _D_CHAR_TWO ].mark_len;
-        _mstr_clear(_d_process[ _D_CHAR_TWO ].morse_elements);
-        _d_process[ _D_CHAR_TWO ].space_before = 0.0;
-        _d_process[ _D_CHAR_TWO ].mark_len = 0.0;
-        _d_complete_chars = 1;
+        strcpy(dec->process[ _D_CHAR_ONE ].morse_elements, dec->process[ _D_CHAR_TWO ].morse_elements);
+        dec->process[ _D_CHAR_ONE ].space_before = dec->process[ _D_CHAR_TWO ].space_before;
+        dec->process[ _D_CHAR_ONE ].mark_len = dec->process[ _D_CHAR_TWO ].mark_len;
+        _mstr_clear(dec->process[ _D_CHAR_TWO ].morse_elements);
+        dec->process[ _D_CHAR_TWO ].space_before = 0.0;
+        dec->process[ _D_CHAR_TWO ].mark_len = 0.0;
+        dec->complete_chars = 1;
     }
-    _d_process[_d_complete_chars].space_before = next_space;
-    float spacing = ((sp1 / (3.0 * _d_tru_dot)) - 1.0);
+    dec->process[dec->complete_chars].space_before = next_space;
+    float spacing = ((sp1 / (3.0 * dec->tru_dot)) - 1.0);
     if (*code && *cs == '\000') {
         strcpy(cs, "["); strcat(cs, code); strcat(cs, "]");
-        _d_post_decoded_text(cs, spacing);
+        _d_post_decoded_text(dec, cs, spacing);
     }
     else if (*cs != '\000') {
-        _d_post_decoded_text(cs, spacing);
+        _d_post_decoded_text(dec, cs, spacing);
     }
 }
 
@@ -177,7 +153,7 @@ static char _d_lookup_char(char* dds) {
     return ('\000');
 }
 
-static void _d_post_decoded_text(char* cs, float spacing) {
+static void _d_post_decoded_text(morse_decoder_t* dec, char* cs, float spacing) {
     // Generate a string with leading spacing and the character.
     char txt[32];
     memset(txt, '\000', sizeof(txt));
@@ -201,14 +177,22 @@ static void _d_post_decoded_text(char* cs, float spacing) {
     }
     // Append the char
     strcat(txt, cs);
-    // Post the string
+    // Hand off the string
+    dec->text_handler(txt, dec->handler_data);
+}
+
+/**
+ * @brief Text handler for the default decoder. Posts the text to the UI (MSG_CODE_TEXT).
+ * @ingroup morse
+ */
+static void _d_post_code_text(const char* text, void* handler_data) {
     cmt_msg_t msg;
     msg.id = MSG_CODE_TEXT;
-    msg.data.str = str_value_create(txt);
+    msg.data.str = str_value_create(text);
     postUIMsgBlocking(&msg);
 }
 
-static void _d_update_detected_wpm(mcode_seq_t* mcode_seq) {
+static void _d_update_detected_wpm(morse_decoder_t* dec, mcode_seq_t* mcode_seq) {
     // @todo: Fill this code in to calculate the actual (perceved) speed.
 }
 
@@ -255,44 +239,62 @@ void morse_decode(mcode_seq_t* mcode_seq) {
 
     // Code received, so cancel a pending flush timer
     scheduled_msg_cancel(MSG_MORSE_DECODE_FLUSH);
-    // _d_update_detected_wpm(mcode_seq);
+    morse_decoder_decode(&_decoder, mcode_seq);
+    // Set up a 'flusher' alarm (skip if debugging decode)
+    if (!(debugging_flags & DEBUGGING_MORSE_DECODE)) {
+        schedule_msg_in_ms(morse_decoder_flush_ms(&_decoder), &_decode_flusher_msg);
+    }
+    bool cc = kob_status()->circuit_closed;
+    if (cc != _decoder.circuit_latched_closed) {
+        // ZZZ kob_update_circuit_closed(_decoder.circuit_latched_closed);
+    }
+}
+
+void morse_decode_flush() {
+    morse_decoder_flush(&_decoder);
+}
+
+void morse_decoder_decode(morse_decoder_t* dec, mcode_seq_t* mcode_seq) {
+    dec->flush_pending = true;
+    dec->ts_code = now_ms();
+    // _d_update_detected_wpm(dec, mcode_seq);
     // Run through the code list
     for (int i = 0; i < mcode_seq->len; i++) {
         int32_t c = mcode_seq->code_seq[i];
         if (c < 0) {
             // start or continuation of space, or continuation of mark (if latched)
             c = (-c);
-            if (_d_circuit_latched_closed) {
+            if (dec->circuit_latched_closed) {
                 // circuit has been latched closed
-                _d_mark_len_total += (float)c;
+                dec->mark_len_total += (float)c;
             }
-            else if (_d_space_len_total > 0.0) {
+            else if (dec->space_len_total > 0.0) {
                 // continuation of space
-                _d_space_len_total += (float)c;
+                dec->space_len_total += (float)c;
             }
             else {
                 // end of mark
-                if (_d_mark_len_total > (MD_MIN_DASH_LEN * _d_tru_dot)) {
-                    _mstr_append(_d_process[_d_complete_chars].morse_elements, '-'); // dash
+                if (dec->mark_len_total > (MD_MIN_DASH_LEN * dec->tru_dot)) {
+                    _mstr_append(dec->process[dec->complete_chars].morse_elements, '-'); // dash
                 }
                 else {
-                    _mstr_append(_d_process[_d_complete_chars].morse_elements, '.'); // dot
+                    _mstr_append(dec->process[dec->complete_chars].morse_elements, '.'); // dot
                 }
-                _d_process[_d_complete_chars].mark_len = _d_mark_len_total;
-                _d_mark_len_total = 0.0;
-                _d_space_len_total = (float)c;
+                dec->process[dec->complete_chars].mark_len = dec->mark_len_total;
+                dec->mark_len_total = 0.0;
+                dec->space_len_total = (float)c;
             }
         }
         else if (c == MORSE_EXTENDED_MARK_START_INDICATOR) {
             // start(or continuation) of extended mark
-            _d_circuit_latched_closed = true;
-            if (_d_space_len_total > 0.0) {
+            dec->circuit_latched_closed = true;
+            if (dec->space_len_total > 0.0) {
                 // start of mark
-                if (_d_space_len_total > (MD_MIN_MORSE_SPACE * _d_dot_len)) {
+                if (dec->space_len_total > (MD_MIN_MORSE_SPACE * dec->dot_len)) {
                     // possible Morse or word space
-                    _d_decode_char(_d_space_len_total);
-                    _d_mark_len_total = 0.0;
-                    _d_space_len_total = 0.0;
+                    _d_decode_char(dec, dec->space_len_total);
+                    dec->mark_len_total = 0.0;
+                    dec->space_len_total = 0.0;
                 }
                 else {
                     // continuation of mark
@@ -301,63 +303,82 @@ void morse_decode(mcode_seq_t* mcode_seq) {
         }
         else if (c == MORSE_EXTENDED_MARK_END_INDICATOR) {
             // end of mark (or continuation of space)
-            _d_circuit_latched_closed = false;
+            dec->circuit_latched_closed = false;
         }
         else if (c > 2) {
             // mark
-            _d_circuit_latched_closed = false;
-            if (_d_space_len_total > 0.0) {
+            dec->circuit_latched_closed = false;
+            if (dec->space_len_total > 0.0) {
                 // start of new mark
-                if (_d_space_len_total > (MD_MIN_MORSE_SPACE * _d_dot_len)) {
+                if (dec->space_len_total > (MD_MIN_MORSE_SPACE * dec->dot_len)) {
                     // possible Morse or word space
-                    _d_decode_char(_d_space_len_total);
+                    _d_decode_char(dec, dec->space_len_total);
                 }
-                _d_mark_len_total = (float)c;
-                _d_space_len_total = 0.0;
+                dec->mark_len_total = (float)c;
+                dec->space_len_total = 0.0;
             }
-            else if (_d_mark_len_total > 0.0) {
+            else if (dec->mark_len_total > 0.0) {
                 // continuation of mark
-                _d_mark_len_total += (float)c;
+                dec->mark_len_total += (float)c;
             }
         }
     }
-    // Set up a 'flusher' alarm (skip if debugging decode)
-    if (!(debugging_flags & DEBUGGING_MORSE_DECODE)) {
-        schedule_msg_in_ms((20 * _d_tru_dot), &_decode_flusher_msg);
-    }
-    bool cc = kob_status()->circuit_closed;
-    if (cc != _d_circuit_latched_closed) {
-        // ZZZ kob_update_circuit_closed(_d_circuit_latched_closed);
-    }
 }
 
-void morse_decode_flush() {
-    if (_d_mark_len_total > 0 || _d_circuit_latched_closed) {
-        float spacing = _d_process[_d_complete_chars].space_before;
-        if (_d_mark_len_total > (MD_MIN_DASH_LEN * _d_tru_dot)) {
-            _mstr_append(_d_process[_d_complete_chars].morse_elements, '-'); // dash
+void morse_decoder_flush(morse_decoder_t* dec) {
+    dec->flush_pending = false;
+    if (dec->mark_len_total > 0 || dec->circuit_latched_closed) {
+        float spacing = dec->process[dec->complete_chars].space_before;
+        if (dec->mark_len_total > (MD_MIN_DASH_LEN * dec->tru_dot)) {
+            _mstr_append(dec->process[dec->complete_chars].morse_elements, '-'); // dash
         }
-        else if (_d_mark_len_total > 2.0) {
-            _mstr_append(_d_process[_d_complete_chars].morse_elements, '.'); // dot
+        else if (dec->mark_len_total > 2.0) {
+            _mstr_append(dec->process[dec->complete_chars].morse_elements, '.'); // dot
         }
-        _d_process[_d_complete_chars].mark_len = _d_mark_len_total;
-        _d_mark_len_total = 0;
-        _d_space_len_total = 1; // to prevent circuit opening mistakenly decoding as 'E'
-        _d_decode_char(MORSE_CODE_ELEMENT_VALUE_MAX);
-        _d_decode_char(MORSE_CODE_ELEMENT_VALUE_MAX); // a second time, to flush both characters
-        _mstr_clear(_d_process[ _D_CHAR_ONE ].morse_elements);
-        _d_process[ _D_CHAR_ONE ].space_before = 0.0;
-        _d_process[ _D_CHAR_ONE ].mark_len = 0.0;
-        _mstr_clear(_d_process[ _D_CHAR_TWO ].morse_elements);
-        _d_process[ _D_CHAR_TWO ].space_before = 0.0;
-        _d_process[ _D_CHAR_TWO ].mark_len = 0.0;
-        _d_complete_chars = 0;
-        if (_d_circuit_latched_closed) {
-            _d_post_decoded_text("_", ((spacing / (3.0 * _d_tru_dot)) - 1.0));
+        dec->process[dec->complete_chars].mark_len = dec->mark_len_total;
+        dec->mark_len_total = 0;
+        dec->space_len_total = 1; // to prevent circuit opening mistakenly decoding as 'E'
+        _d_decode_char(dec, MORSE_CODE_ELEMENT_VALUE_MAX);
+        _d_decode_char(dec, MORSE_CODE_ELEMENT_VALUE_MAX); // a second time, to flush both characters
+        _mstr_clear(dec->process[ _D_CHAR_ONE ].morse_elements);
+        dec->process[ _D_CHAR_ONE ].space_before = 0.0;
+        dec->process[ _D_CHAR_ONE ].mark_len = 0.0;
+        _mstr_clear(dec->process[ _D_CHAR_TWO ].morse_elements);
+        dec->process[ _D_CHAR_TWO ].space_before = 0.0;
+        dec->process[ _D_CHAR_TWO ].mark_len = 0.0;
+        dec->complete_chars = 0;
+        if (dec->circuit_latched_closed) {
+            _d_post_decoded_text(dec, "_", ((spacing / (3.0 * dec->tru_dot)) - 1.0));
         }
     }
 }
 
+void morse_decoder_flush_check(morse_decoder_t* dec, uint32_t now) {
+    if (dec->flush_pending && (now - dec->ts_code) >= (uint32_t)morse_decoder_flush_ms(dec)) {
+        morse_decoder_flush(dec);
+    }
+}
+
+int32_t morse_decoder_flush_ms(const morse_decoder_t* dec) {
+    return ((int32_t)(20 * dec->tru_dot));
+}
+
+void morse_decoder_init(morse_decoder_t* dec, morse_text_handler_fn text_handler, void* handler_data) {
+    memset(dec, 0, sizeof(morse_decoder_t));
+    dec->text_handler = text_handler;
+    dec->handler_data = handler_data;
+    dec->wpm = _d_wpm;
+    dec->dot_len = (UNIT_DOT_TIME / _d_wpm);
+    dec->tru_dot = dec->dot_len;
+    dec->complete_chars = 0;
+    dec->circuit_latched_closed = false;
+    dec->mark_len_total = 0.0;
+    dec->space_len_total = 1.0;
+    dec->detected_wpm = dec->wpm;
+    dec->detected_dot_len = dec->dot_len;
+    dec->detected_tru_dot = dec->tru_dot;
+}
+
 mcode_seq_t* morse_encode(char c) {
     code_element_t code_seq[(2 * MORSE_MAX_DDS_IN_CHAR) + 1]; // Enough for 2 ints per element - longest is 9 elements (',-)
     int cli = 0; // Code sequence index. Used while building.
@@ -386,7 +407,7 @@ mcode_seq_t* morse_encode(char c) {
         char element;
         while ('\000' != (element = *elements++)) {
             if (SP == element) {
-                _e_space = (3 * _e_dot_len);
+                _e_space = _e_word_space;
             }
             else {
                 code_seq[cli++] = (-_e_space);
@@ -413,7 +434,10 @@ mcode_seq_t* morse_encode(char c) {
                 _e_space = _e_dot_len;
             }
         }
-        _e_space = _e_char_space;
+        if (cli > 0) {
+            // The next character is a character space after this one (a space leaves the word space)
+            _e_space = _e_char_space;
+        }
     }
     // Allocate the codelist structure to return
     mcode_seq_t* mcode_seq = mcode_seq_alloc(MCODE_SRC_UI, code_seq, cli);
@@ -426,19 +450,7 @@ void morse_module_init(uint8_t twpm, uint8_t cwpm_min, code_type_t code_type, co
 
     // Decode values
     _d_wpm = (twpm > cwpm_min ? twpm : cwpm_min);
-    _d_dot_len = (UNIT_DOT_TIME / _d_wpm);
-    _d_tru_dot = _d_dot_len;
-    _d_complete_chars = 0;
-    _d_circuit_latched_closed = false;
-    _d_process[ _D_CHAR_ONE ].morse_elements = _d_mstr_1;
-    _d_process[ _D_CHAR_TWO ].morse_elements = _d_mstr_2;
-    _mstr_clear(_d_process[ _D_CHAR_ONE ].morse_elements);
-    _mstr_clear(_d_process[ _D_CHAR_TWO ].morse_elements);
-    _d_mark_len_total = 0.0;
-    _d_space_len_total = 1.0;
-    _d_detected_wpm = _d_wpm;
-    _d_detected_dot_len = _d_dot_len;
-    _d_detected_tru_dot = _d_tru_dot;
+    morse_decoder_init(&_decoder, _d_post_code_text, NULL);
     _decode_flusher_msg.id = MSG_MORSE_DECODE_FLUSH;
 
     // Encode values
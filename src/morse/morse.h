@@ -14,6 +14,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "float.h"
 
@@ -41,10 +42,67 @@ extern "C" {
 
 #define MORSE_CODE_ELEMENT_VALUE_MAX (FLT_MAX)
 
+#define MORSE_MSTRING_SIZE 32   // Size of the buffers used to build the dits & dahs of a character
+#define MORSE_DECODE_CHARS 2    // Characters held by the decoder (to handle spaced characters)
+
+/**
+ * @brief Function prototype for a decoder text handler.
+ * @ingroup morse
+ *
+ * @param text The decoded text (one character, with leading spaces for the spacing).
+ *             This is only valid for the duration of the call.
+ * @param handler_data The data given to `morse_decoder_init`.
+ */
+typedef void (*morse_text_handler_fn)(const char* text, void* handler_data);
+
+/**
+ * @brief Decode morse (code duration) sequence processing data
+ * @ingroup morse
+ *
+ * This holds data to build morse elements into based on timings
+ * to allow them to be converted to a character (looked up from a code table).
+ */
+typedef struct _DECODE_PROC_DATA_ {
+    char morse_elements[MORSE_MSTRING_SIZE]; // String buffer to build the dots-dashes into
+    float space_before;   // space before each character
+    float mark_len;       // length of last dot or dash in character
+} decode_proc_data_t;
+
+/**
+ * @brief Morse decoder state.
+ * @ingroup morse
+ *
+ * Each source of code that is decoded separately has one of these (statically allocated).
+ * The fields are private to the morse module.
+ */
+typedef struct _MORSE_DECODER_ {
+    decode_proc_data_t process[MORSE_DECODE_CHARS]; // Processing data to build two Morse elements
+    char code[MORSE_MSTRING_SIZE];  // Work buffer
+    char cs[MORSE_MSTRING_SIZE];    // Work buffer
+    bool circuit_latched_closed;    // True if cicuit has been latched closed by a +1 code element
+    bool flush_pending;             // Code has been decoded since the last flush
+    int16_t complete_chars;         // number of complete characters in buffer
+    float mark_len_total;           // accumulates the length of a mark as positive code elements are received
+    float space_len_total;          // accumulates the length of a space as negative code elements are received
+    // Values calculated from the code speed when initialized
+    float dot_len;                  // nominal dot length (ms)
+    float tru_dot;                  // actual length of typical dot(ms)
+    uint8_t wpm;                    // configured code speed (max of text and char speeds)
+    // Detected code speed values. Start with the configured speed and calculated values
+    float detected_dot_len;
+    float detected_tru_dot;
+    uint8_t detected_wpm;
+    uint32_t ts_code;               // ms time code was last decoded
+    morse_text_handler_fn text_handler;
+    void* handler_data;
+} morse_decoder_t;
+
 /**
  * @brief Decode a Morse Code sequence to text.
  * @ingroup morse
  *
+ * This uses the default decoder, which posts the text to the UI (MSG_CODE_TEXT).
+ *
  * @param mcode_seq Morse Code sequence to decode.
  */
 void morse_decode(mcode_seq_t* mcode_seq);
@@ -55,6 +113,57 @@ void morse_decode(mcode_seq_t* mcode_seq);
  */
 extern void morse_decode_flush();
 
+/**
+ * @brief Decode a Morse Code sequence to text with a specific decoder.
+ * @ingroup morse
+ *
+ * The decoded text is given to the decoder's text handler. This doesn't schedule
+ * a flush, the owner of the decoder uses `morse_decoder_flush_check` for that.
+ *
+ * @param dec The decoder.
+ * @param mcode_seq Morse Code sequence to decode.
+ */
+extern void morse_decoder_decode(morse_decoder_t* dec, mcode_seq_t* mcode_seq);
+
+/**
+ * @brief Flush a pending decode operation of a decoder.
+ * @ingroup morse
+ *
+ * @param dec The decoder.
+ */
+extern void morse_decoder_flush(morse_decoder_t* dec);
+
+/**
+ * @brief Flush a decoder if code hasn't been received for the flush time.
+ * @ingroup morse
+ *
+ * @param dec The decoder.
+ * @param now The current millisecond time.
+ */
+extern void morse_decoder_flush_check(morse_decoder_t* dec, uint32_t now);
+
+/**
+ * @brief The time without code after which a decoder should be flushed.
+ * @ingroup morse
+ *
+ * @param dec The decoder.
+ * @return The time in milliseconds.
+ */
+extern int32_t morse_decoder_flush_ms(const morse_decoder_t* dec);
+
+/**
+ * @brief Initialize a decoder.
+ * @ingroup morse
+ *
+ * The decoder uses the code speed set by `morse_module_init` (at the time this is called).
+ * The code type is shared by all decoders.
+ *
+ * @param dec The decoder.
+ * @param text_handler Function called with the decoded text.
+ * @param handler_data Data that is passed to the text handler.
+ */
+extern void morse_decoder_init(morse_decoder_t* dec, morse_text_handler_fn text_handler, void* handler_data);
+
 /**
  * @brief Encode a character into a list of code elements.
  * @ingroup morse
@@ -0,0 +1,363 @@
+/**
+ * MorseKOB Wire code playout (jitter) buffer.
+ *
+ * The playout delay is adapted using an inter-arrival jitter estimate (the same
+ * estimator as RFC-3550 uses). A packet's code sequence covers the time from the
+ * end of the previous packet's last mark to the end of its own last mark, so the
+ * expected time between two consecutive packets is the total time of the code
+ * elements in the later packet. The jitter is the smoothed difference between the
+ * expected and the actual times.
+ *
+ * A 'run' of sequences starts when a sequence is received while nothing is being
+ * played. The first sequence of a run is held for the playout delay. The sequences
+ * that follow are released when the previous one has finished sounding.
+ *
+ * If the next sequence number hasn't arrived when it is needed, the sequence after
+ * it is held (for the playout delay, up to JBUF_REORDER_WAIT_MAX_MS from when it
+ * arrived) to give the missing one a chance to arrive out of order. The sequence
+ * numbers recently played are kept as a bit mask, so that a duplicate can be told
+ * from a sequence that arrived after the wait for it was given up.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "jbuf.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/mutex.h"
+#include "hardware/sync.h"
+
+#define _JBUF_ELEMENT_MAX_MS 5000       // Limit for a single element (same safeguard used when sounding)
+#define _JBUF_JITTER_WINDOW_MS 2000     // Inter-arrival times longer than this are pauses, not jitter
+#define _JBUF_JITTER_MULT 3             // Playout delay as a multiple of the jitter estimate
+
+typedef struct _JBUF_ENTRY_ {
+    mcode_seq_t* mcode_seq;     // NULL when the entry is free
+    uint32_t epoch;             // Sender epoch the sequence was received in
+    int32_t seqno;
+    mk_station_handle_t station;
+    uint32_t ts_arrival;
+    int32_t play_ms;            // Time to sound the sequence (not including the leading space)
+} _jbuf_entry_t;
+
+static bool _initialized = false;
+auto_init_mutex(jbuf_mutex);
+
+/** Static storage for the held sequences - to avoid malloc during message receipt. */
+static _jbuf_entry_t _entries[JBUF_SLOTS];
+static uint32_t _epoch;             // Incremented when the sender changes
+
+// Arrival tracking (for the jitter estimate)
+static bool _arrival_valid;
+static int32_t _seqno_arrival;
+static uint32_t _ts_arrival;
+static int32_t _jitter16;           // Jitter estimate in 1/16 ms
+static int32_t _target_ms;
+
+// Playout tracking
+static bool _running;               // A run is being played
+static bool _played_valid;
+static uint32_t _play_epoch;
+static int32_t _seqno_played;
+static uint32_t _played_mask;       // Bit n set if _seqno_played - n was played
+static uint32_t _ts_play_end;       // When the last sequence released will finish sounding
+
+static jbuf_stats_t _stats;
+
+
+static void _code_times(const mcode_seq_t* mcode_seq, int32_t* total_ms, int32_t* play_ms) {
+    int32_t total = 0;
+    int32_t play = 0;
+    for (int i = 0; i < mcode_seq->len; i++) {
+        code_element_t ce = mcode_seq->code_seq[i];
+        int32_t t = abs(ce);
+        t = (t < _JBUF_ELEMENT_MAX_MS ? t : _JBUF_ELEMENT_MAX_MS);
+        total += t;
+        if (i > 0 || ce > 0) {
+            play += t;
+        }
+    }
+    *total_ms = total;
+    *play_ms = play;
+}
+
+/**
+ * @brief Find the entry that should be played next (lowest epoch, then lowest sequence number).
+ *
+ * Must be called with the lock held.
+ */
+static _jbuf_entry_t* _next_entry() {
+    _jbuf_entry_t* next = NULL;
+    for (int i = 0; i < JBUF_SLOTS; i++) {
+        _jbuf_entry_t* e = &_entries[i];
+        if (e->mcode_seq) {
+            if (!next || e->epoch < next->epoch || (e->epoch == next->epoch && e->seqno < next->seqno)) {
+                next = e;
+            }
+        }
+    }
+    return (next);
+}
+
+static void _reset_timing() {
+    _arrival_valid = false;
+    _running = false;
+    _played_valid = false;
+    _target_ms = JBUF_TARGET_INIT_MS;
+    _jitter16 = (JBUF_TARGET_INIT_MS * 16) / _JBUF_JITTER_MULT;
+}
+
+/**
+ * @brief Move the last played sequence number forward (updating the played mask).
+ *
+ * Must be called with the lock held, and the new sequence number in the play epoch.
+ */
+static void _played_advance(int32_t seqno) {
+    int32_t shift = seqno - _seqno_played;
+    _played_mask = (shift < 32 ? _played_mask << shift : 0);
+    _seqno_played = seqno;
+}
+
+static int32_t _target_from_jitter() {
+    int32_t target = (_JBUF_JITTER_MULT * _jitter16) >> 4;
+    if (target < JBUF_TARGET_MIN_MS) {
+        target = JBUF_TARGET_MIN_MS;
+    }
+    else if (target > JBUF_TARGET_MAX_MS) {
+        target = JBUF_TARGET_MAX_MS;
+    }
+    return (target);
+}
+
+
+void jbuf_clear() {
+    mcode_seq_t* to_free[JBUF_SLOTS];
+    int nf = 0;
+
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&jbuf_mutex);
+    for (int i = 0; i < JBUF_SLOTS; i++) {
+        if (_entries[i].mcode_seq) {
+            to_free[nf++] = _entries[i].mcode_seq;
+            _entries[i].mcode_seq = NULL;
+        }
+    }
+    _epoch++; // Anything that was in flight is treated as a new sender
+    _reset_timing();
+    mutex_exit(&jbuf_mutex);
+    restore_interrupts(flags);
+
+    for (int i = 0; i < nf; i++) {
+        mcode_seq_free(to_free[i]);
+    }
+}
+
+bool jbuf_put(mcode_seq_t* mcode_seq, int32_t seqno, mk_station_handle_t station, bool new_sender, uint32_t now) {
+    mcode_seq_t* drop = NULL;
+    int duplicates = 0;
+    int reordered = 0;
+    int32_t total_ms, play_ms;
+    _code_times(mcode_seq, &total_ms, &play_ms);
+
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&jbuf_mutex);
+    if (new_sender) {
+        _epoch++;
+        _arrival_valid = false;
+    }
+    // Update the jitter estimate from consecutive packets
+    bool out_of_order = (_arrival_valid && seqno < _seqno_arrival);
+    if (_arrival_valid && seqno == _seqno_arrival + 1) {
+        int32_t interval = (int32_t)(now - _ts_arrival);
+        if (interval < _JBUF_JITTER_WINDOW_MS) {
+            int32_t d = abs(interval - total_ms);
+            _jitter16 += d - ((_jitter16 + 8) >> 4);
+            _target_ms = _target_from_jitter();
+        }
+    }
+    if (!_arrival_valid || seqno > _seqno_arrival) {
+        _arrival_valid = true;
+        _seqno_arrival = seqno;
+        _ts_arrival = now;
+    }
+    // See if it is a duplicate, or too late (its place has already been played through)
+    bool dup = false;
+    bool late = (_played_valid && _epoch == _play_epoch && seqno <= _seqno_played);
+    if (late) {
+        int32_t age = _seqno_played - seqno;
+        dup = (age < 32 && (_played_mask & (1u << age)));
+    }
+    _jbuf_entry_t* slot = NULL;
+    for (int i = 0; !late && i < JBUF_SLOTS; i++) {
+        _jbuf_entry_t* e = &_entries[i];
+        if (e->mcode_seq) {
+            dup = late = (e->epoch == _epoch && e->seqno == seqno);
+        }
+        else if (!slot) {
+            slot = e;
+        }
+    }
+    if (late) {
+        if (dup) {
+            _stats.duplicates++;
+            duplicates = 1;
+        }
+        else {
+            _stats.late_drops++;
+        }
+        drop = mcode_seq;
+    }
+    else {
+        if (out_of_order) {
+            _stats.reordered++;
+            reordered = 1;
+        }
+        if (!slot) {
+            // Full - drop the oldest to make room.
+            slot = _next_entry();
+            drop = slot->mcode_seq;
+            _stats.overflow_drops++;
+        }
+        slot->mcode_seq = mcode_seq;
+        slot->epoch = _epoch;
+        slot->seqno = seqno;
+        slot->station = station;
+        slot->ts_arrival = now;
+        slot->play_ms = play_ms;
+    }
+    mutex_exit(&jbuf_mutex);
+    restore_interrupts(flags);
+
+    mcode_seq_free(drop);
+    if (duplicates || reordered) {
+        mkstation_seq_count(station, duplicates, reordered, 0);
+    }
+
+    return (!late);
+}
+
+void jbuf_stats(jbuf_stats_t* stats) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&jbuf_mutex);
+    memcpy(stats, &_stats, sizeof(jbuf_stats_t));
+    stats->depth = 0;
+    for (int i = 0; i < JBUF_SLOTS; i++) {
+        if (_entries[i].mcode_seq) {
+            stats->depth++;
+        }
+    }
+    stats->target_ms = _target_ms;
+    stats->jitter_ms = (_jitter16 >> 4);
+    mutex_exit(&jbuf_mutex);
+    restore_interrupts(flags);
+}
+
+void jbuf_sync_seqno(int32_t seqno) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&jbuf_mutex);
+    if (_epoch == _play_epoch && _played_valid && seqno > _seqno_played && !_next_entry()) {
+        _played_advance(seqno);
+    }
+    if (_arrival_valid && seqno > _seqno_arrival) {
+        // The next code packet's arrival time can't be compared with the last one.
+        _arrival_valid = false;
+    }
+    mutex_exit(&jbuf_mutex);
+    restore_interrupts(flags);
+}
+
+mcode_seq_t* jbuf_take(uint32_t now, int32_t* wait_ms) {
+    mcode_seq_t* mcode_seq = NULL;
+    bool seq_break = false;
+    mk_station_handle_t station = MK_STATION_NONE;
+    int lost = 0;
+
+    *wait_ms = -1;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&jbuf_mutex);
+    _jbuf_entry_t* e = _next_entry();
+    if (_running && (int32_t)((e ? e->ts_arrival : now) - _ts_play_end) >= 0) {
+        // Underrun - what was being played finished before anything else arrived.
+        _running = false;
+    }
+    if (e) {
+        bool in_seq = (_played_valid && e->epoch == _play_epoch && e->seqno == _seqno_played + 1);
+        uint32_t due;
+        if (_running && in_seq) {
+            due = _ts_play_end;
+        }
+        else {
+            // Start of a run, or waiting for a missing sequence (but not longer than the playout delay,
+            // or the reorder wait limit while a run is being played).
+            int32_t hold_ms = _target_ms;
+            if (_running && hold_ms > JBUF_REORDER_WAIT_MAX_MS) {
+                hold_ms = JBUF_REORDER_WAIT_MAX_MS;
+            }
+            due = e->ts_arrival + hold_ms;
+            if (_running && (int32_t)(_ts_play_end - due) > 0) {
+                due = _ts_play_end;
+            }
+        }
+        int32_t dt = (int32_t)(due - now);
+        if (dt > 0) {
+            *wait_ms = dt;
+        }
+        else {
+            mcode_seq = e->mcode_seq;
+            e->mcode_seq = NULL;
+            seq_break = !in_seq;
+            if (_played_valid && e->epoch == _play_epoch) {
+                if (seq_break) {
+                    lost = e->seqno - _seqno_played - 1;
+                    _stats.lost += lost;
+                    station = e->station;
+                }
+                _played_advance(e->seqno);
+            }
+            else {
+                _play_epoch = e->epoch;
+                _seqno_played = e->seqno;
+                _played_mask = 0;
+            }
+            _played_mask |= 1u;
+            _played_valid = true;
+            _ts_play_end = now + e->play_ms;
+            _running = true;
+            _stats.played++;
+            *wait_ms = 0;
+        }
+    }
+    mutex_exit(&jbuf_mutex);
+    restore_interrupts(flags);
+
+    if (lost > 0) {
+        mkstation_seq_count(station, 0, 0, lost);
+    }
+    if (mcode_seq && seq_break) {
+        // Sequence break (lost packet or new sender). Prepend a long break.
+        mcode_seq_t* mcs = mcode_seq_alloc(MCODE_SRC_WIRE, &mcode_long_break, 1);
+        mcode_seq_append(mcs, mcode_seq->code_seq, mcode_seq->len);
+        mcs->ts_recv = mcode_seq->ts_recv;
+        mcode_seq_free(mcode_seq);
+        mcode_seq = mcs;
+    }
+
+    return (mcode_seq);
+}
+
+void jbuf_module_init() {
+    assert(!_initialized);
+    _initialized = true;
+
+    for (int i = 0; i < JBUF_SLOTS; i++) {
+        _entries[i].mcode_seq = NULL;
+    }
+    _epoch = 0;
+    _play_epoch = 0;
+    memset(&_stats, 0, sizeof(jbuf_stats_t));
+    _reset_timing();
+}
@@ -0,0 +1,132 @@
+/**
+ * MorseKOB Wire code playout (jitter) buffer.
+ *
+ * Holds code sequences received from the wire for a short, adaptive, delay
+ * before they are released to be sounded and decoded. The delay is learned from
+ * the variation in the packet inter-arrival times. Sequences are released in
+ * sequence-number order, so packets that arrive out of order are put back in order.
+ * When a sequence number is missing, the buffer waits a bounded time for it before
+ * playing through the gap (declaring it lost).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _MK_JBUF_H_
+#define _MK_JBUF_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mks.h"
+#include "mkstation.h"
+
+/**
+ * @brief Number of code sequences that can be held in the buffer.
+ * @ingroup wire
+ *
+ * This needs to be well under the size of the mcode_seq pool, as the
+ * sequences held here come from that pool.
+ */
+#define JBUF_SLOTS 8
+
+#define JBUF_TARGET_MIN_MS 40       // Minimum playout delay
+#define JBUF_TARGET_MAX_MS 1000     // Maximum playout delay
+#define JBUF_TARGET_INIT_MS 150     // Playout delay to use until we have learned the jitter
+
+/**
+ * @brief Longest time to wait for a missing sequence while a run is being played.
+ * @ingroup wire
+ *
+ * The wait is the playout delay, up to this. It is measured from the arrival of
+ * the sequence that follows the missing one.
+ */
+#define JBUF_REORDER_WAIT_MAX_MS 400
+
+/**
+ * @brief Jitter buffer statistics.
+ * @ingroup wire
+ */
+typedef struct _JBUF_STATS_ {
+    int depth;                  // Number of sequences currently held
+    int32_t target_ms;          // Current playout delay
+    int32_t jitter_ms;          // Current inter-arrival jitter estimate
+    uint32_t played;            // Sequences released to be sounded/decoded
+    uint32_t duplicates;        // Sequences dropped because they were duplicates
+    uint32_t late_drops;        // Sequences dropped because they arrived after their place was played through
+    uint32_t lost;              // Sequences never received (sequence number gaps that were played through)
+    uint32_t reordered;         // Sequences that arrived out of order
+    uint32_t overflow_drops;    // Sequences dropped because the buffer was full
+} jbuf_stats_t;
+
+/**
+ * @brief Clear the buffer (freeing any held sequences) and reset the playout timing.
+ * @ingroup wire
+ *
+ * The statistics are retained.
+ */
+extern void jbuf_clear();
+
+/**
+ * @brief Put a received code sequence into the buffer.
+ * @ingroup wire
+ *
+ * The buffer takes ownership of the sequence. It will be returned by `jbuf_take`
+ * or freed if it is late, a duplicate, or the buffer overflows.
+ *
+ * Duplicates, sequences that arrive out of order, and sequences that are lost are
+ * counted for the station (see `mkstation_seq_count`).
+ *
+ * @param mcode_seq The code sequence received.
+ * @param seqno The sequence number from the packet.
+ * @param station The station that sent the sequence.
+ * @param new_sender True if this is from a different station than the previous sequence.
+ * @param now The millisecond time the packet arrived.
+ * @return true if the sequence was accepted into the buffer.
+ */
+extern bool jbuf_put(mcode_seq_t* mcode_seq, int32_t seqno, mk_station_handle_t station, bool new_sender, uint32_t now);
+
+/**
+ * @brief Get the statistics for the buffer.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void jbuf_stats(jbuf_stats_t* stats);
+
+/**
+ * @brief Indicate that the current sender has used a sequence number (in an ID packet).
+ * @ingroup wire
+ *
+ * This keeps the next code sequence from being seen as a gap (lost packet).
+ *
+ * @param seqno The sequence number from the current sender's ID packet.
+ */
+extern void jbuf_sync_seqno(int32_t seqno);
+
+/**
+ * @brief Take the next sequence that is due to be played.
+ * @ingroup wire
+ *
+ * If a sequence is returned the caller owns it and must free it. A sequence returned after
+ * a break (lost packets or a new sender) will have a long-break prepended to it.
+ *
+ * @param now The current millisecond time.
+ * @param wait_ms Set to the number of milliseconds until the next sequence is due (-1 if the buffer is empty).
+ * @return mcode_seq_t* The next sequence to play, or NULL if none are due.
+ */
+extern mcode_seq_t* jbuf_take(uint32_t now, int32_t* wait_ms);
+
+/**
+ * @brief Initialize the jitter buffer module.
+ * @ingroup wire
+ */
+extern void jbuf_module_init();
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _MK_JBUF_H_
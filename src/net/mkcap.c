@@ -0,0 +1,440 @@
+/**
+ * MorseKOB Wire packet capture and replay.
+ *
+ * Recording: The backend appends records to the buffer being filled. When it
+ * fills, it is marked full, filling moves to the other buffer, and the UI is
+ * sent a message to write it. Only the buffer indexes and flags are shared
+ * (under the lock), the UI writes a full buffer without holding the lock.
+ *
+ * Replay: The UI reads the records (a sector at a time) and, when each is due,
+ * puts the datagram into a PBUF and posts it to the backend, which puts it into
+ * the wire receive path. The time a record is due is its time in the capture,
+ * divided by the speed, from the start of the replay.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "mkcap.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "cmt.h"
+#include "config_fops.h"
+#include "mkboard.h"
+#include "mksim.h"
+#include "mkwire.h"
+#include "net.h"
+#include "ntp.h"
+#include "util.h"
+
+#include "ff.h"
+
+#include "pico/cyw43_arch.h"
+#include "pico/mutex.h"
+#include "hardware/sync.h"
+
+#define _MKCAP_SECTOR_SIZE 512
+#define _MKCAP_FILE_HDR_SIZE 24
+#define _MKCAP_FILE_HDR_V1_SIZE 16
+#define _MKCAP_REC_HDR_SIZE 8
+#define _MKCAP_PKT_MAX 500          // Longest datagram kept (a code packet is 496)
+#define _MKCAP_SENT_FLAG 0x8000
+#define _MKCAP_STORED_MASK 0x7FFF
+
+static const char _magic[6] = "MKCAP";
+
+static bool _initialized = false;
+auto_init_mutex(mkcap_mutex);
+
+static cmt_msg_t _msg_replay = { MSG_WIRE_CAPTURE_REPLAY };
+static cmt_msg_t _msg_write = { MSG_WIRE_CAPTURE_WRITE };
+
+static FIL _fil;
+static bool _file_open = false;
+static mkcap_stats_t _stats;
+
+// Recording (filled by the backend, written by the UI)
+static volatile bool _recording = false;
+static uint8_t _buf[2][_MKCAP_SECTOR_SIZE];
+static volatile bool _buf_full[2];
+static int _fill;                   // Buffer being filled
+static uint16_t _fill_len;          // Bytes in the buffer being filled
+static int _write_next;             // Next buffer to write (the one filled first)
+static uint64_t _ts_last_us;        // Time of the last record
+
+// Replay (all on the UI)
+static uint8_t _rbuf[_MKCAP_SECTOR_SIZE];
+static uint16_t _rlen;
+static uint16_t _rpos;
+static uint8_t _pkt[_MKCAP_PKT_MAX];
+static uint16_t _pkt_len;
+static bool _pkt_sent;
+static bool _pkt_pending;           // A record has been read and is waiting to be due
+static uint64_t _replay_t0_us;      // When the replay started
+static uint64_t _replay_cap_us;     // Time of the pending record in the capture
+
+
+/**
+ * @brief Bytes that can be added to the buffers. Must be called with the lock held.
+ */
+static uint16_t _buf_room() {
+    if (_buf_full[_fill]) {
+        return (0);
+    }
+    return ((_MKCAP_SECTOR_SIZE - _fill_len) + (_buf_full[_fill ^ 1] ? 0 : _MKCAP_SECTOR_SIZE));
+}
+
+/**
+ * @brief Append bytes to the buffers. Must be called with the lock held, and there must be room.
+ *
+ * @return true if a buffer was filled (and needs to be written).
+ */
+static bool _buf_put(const uint8_t* data, uint16_t n) {
+    bool filled = false;
+    while (n > 0) {
+        uint16_t c = _MKCAP_SECTOR_SIZE - _fill_len;
+        c = (c < n ? c : n);
+        memcpy(&_buf[_fill][_fill_len], data, c);
+        _fill_len += c;
+        data += c;
+        n -= c;
+        if (_MKCAP_SECTOR_SIZE == _fill_len) {
+            _buf_full[_fill] = true;
+            _fill ^= 1;
+            _fill_len = 0;
+            filled = true;
+        }
+    }
+    return (filled);
+}
+
+static void _file_write(const uint8_t* data, uint16_t n) {
+    UINT bw;
+    uint64_t t_start = now_us();
+    FRESULT fr = f_write(&_fil, data, n, &bw);
+    uint32_t t = (uint32_t)(now_us() - t_start);
+    if (FR_OK != fr || bw != n) {
+        _stats.write_errors++;
+    }
+    else {
+        _stats.bytes += bw;
+    }
+    if (t > _stats.write_us_max) {
+        _stats.write_us_max = t;
+    }
+}
+
+/**
+ * @brief Read from the capture file (through the sector buffer).
+ *
+ * @return true if all of the bytes were read.
+ */
+static bool _read(uint8_t* dst, uint16_t n) {
+    while (n > 0) {
+        if (_rpos == _rlen) {
+            UINT br;
+            if (FR_OK != f_read(&_fil, _rbuf, sizeof(_rbuf), &br) || 0 == br) {
+                return (false);
+            }
+            _rlen = (uint16_t)br;
+            _rpos = 0;
+            _stats.bytes += br;
+        }
+        uint16_t c = _rlen - _rpos;
+        c = (c < n ? c : n);
+        memcpy(dst, &_rbuf[_rpos], c);
+        _rpos += c;
+        dst += c;
+        n -= c;
+    }
+    return (true);
+}
+
+/**
+ * @brief Read the next record into the pending datagram.
+ *
+ * @return true if a record was read, false at the end of the capture (or if it is damaged).
+ */
+static bool _read_record() {
+    uint8_t hdr[_MKCAP_REC_HDR_SIZE];
+    uint32_t dt_us;
+    uint16_t len;
+    uint16_t stored;
+
+    if (!_read(hdr, sizeof(hdr))) {
+        return (false);
+    }
+    memcpy(&dt_us, &hdr[0], sizeof(dt_us));
+    memcpy(&len, &hdr[4], sizeof(len));
+    memcpy(&stored, &hdr[6], sizeof(stored));
+    _pkt_sent = (0 != (stored & _MKCAP_SENT_FLAG));
+    stored &= _MKCAP_STORED_MASK;
+    if (len > _MKCAP_PKT_MAX || stored > len) {
+        error_printf(false, "MKCap - Damaged record in '%s' (Len: %hu Stored: %hu).\n", _stats.filename, len, stored);
+        return (false);
+    }
+    if (!_read(_pkt, stored)) {
+        return (false);
+    }
+    memset(&_pkt[stored], 0, len - stored);
+    _pkt_len = len;
+    _replay_cap_us += dt_us;
+
+    return (true);
+}
+
+/**
+ * @brief Put the pending datagram into the wire receive path (through the backend).
+ */
+static void _replay_inject() {
+    cyw43_arch_lwip_begin();
+    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, _pkt_len, PBUF_POOL);
+    cyw43_arch_lwip_end();
+    if (!p) {
+        _stats.drops++;
+        return;
+    }
+    pbuf_take(p, _pkt, _pkt_len);
+    cmt_msg_t msg;
+    msg.id = MSG_MKS_CAPTURE_PACKET;
+    msg.data.pbuf = p;
+    if (!postBEMsgNoWait(&msg)) {
+        cyw43_arch_lwip_begin();
+        pbuf_free(p);
+        cyw43_arch_lwip_end();
+        _stats.drops++;
+        return;
+    }
+    _stats.records++;
+}
+
+
+bool mkcap_recording() {
+    return (_recording);
+}
+
+void mkcap_record(bool sent, uint64_t ts_us, const uint8_t* pkt, uint16_t len) {
+    if (!_recording) {
+        return;
+    }
+    len = (len < _MKCAP_PKT_MAX ? len : _MKCAP_PKT_MAX);
+    uint16_t stored = len;
+    while (stored > 0 && 0 == pkt[stored - 1]) {
+        stored--;
+    }
+    bool filled = false;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkcap_mutex);
+    if (_recording) {
+        if (_buf_room() >= (_MKCAP_REC_HDR_SIZE + stored)) {
+            uint8_t hdr[_MKCAP_REC_HDR_SIZE];
+            uint64_t dt = (ts_us > _ts_last_us ? ts_us - _ts_last_us : 0);
+            uint32_t dt_us = (dt < UINT32_MAX ? (uint32_t)dt : UINT32_MAX);
+            uint16_t s = stored | (sent ? _MKCAP_SENT_FLAG : 0);
+            memcpy(&hdr[0], &dt_us, sizeof(dt_us));
+            memcpy(&hdr[4], &len, sizeof(len));
+            memcpy(&hdr[6], &s, sizeof(s));
+            filled = _buf_put(hdr, sizeof(hdr));
+            filled |= _buf_put(pkt, stored);
+            _ts_last_us += dt;
+            _stats.records++;
+        }
+        else {
+            _stats.drops++;
+        }
+    }
+    mutex_exit(&mkcap_mutex);
+    restore_interrupts(flags);
+
+    if (filled) {
+        // If this can't be posted, the buffer is written with the next one (or when stopped).
+        postUIMsgNoWait(&_msg_write);
+    }
+}
+
+void mkcap_replay_next() {
+    if (!_stats.replaying) {
+        return;
+    }
+    if (mkwire_is_connected()) {
+        // The wire is in use.
+        mkcap_stop();
+        return;
+    }
+    scheduled_msg_cancel(MSG_WIRE_CAPTURE_REPLAY);
+    while (true) {
+        if (!_pkt_pending) {
+            if (!_read_record()) {
+                // End of the capture.
+                mkcap_stop();
+                return;
+            }
+            _pkt_pending = true;
+        }
+        int64_t wait_us = (int64_t)((_replay_t0_us + (_replay_cap_us / _stats.speed)) - now_us());
+        if (wait_us >= 1000) {
+            // Come back when it is due.
+            schedule_msg_in_ms((int32_t)(wait_us / 1000), &_msg_replay);
+            return;
+        }
+        _pkt_pending = false;
+        if (!_pkt_sent) {
+            _replay_inject();
+        }
+    }
+}
+
+bool mkcap_replay_start(const char* filename, uint16_t speed) {
+    uint8_t hdr[_MKCAP_FILE_HDR_SIZE];
+    uint16_t version;
+
+    mkcap_stop();
+    if (mkwire_is_connected() || mksim_running()) {
+        error_printf(false, "MKCap - Can't replay while connected to a wire or running the server stand-in.\n");
+        return (false);
+    }
+    if (FR_OK != cfo_sd_hold()) {
+        return (false);
+    }
+    FRESULT fr = f_open(&_fil, filename, FA_READ);
+    if (FR_OK != fr) {
+        error_printf(false, "MKCap - Could not open file '%s' (Error: %d).\n", filename, fr);
+        cfo_sd_release();
+        return (false);
+    }
+    _file_open = true;
+    memset(&_stats, 0, sizeof(mkcap_stats_t));
+    strcpynt(_stats.filename, filename, MKCAP_FILENAME_MAX_LEN);
+    _stats.speed = (speed < 1 ? 1 : (speed > MKCAP_REPLAY_SPEED_MAX ? MKCAP_REPLAY_SPEED_MAX : speed));
+    _rlen = 0;
+    _rpos = 0;
+    if (!_read(hdr, _MKCAP_FILE_HDR_V1_SIZE) || memcmp(hdr, _magic, sizeof(_magic)) != 0) {
+        error_printf(false, "MKCap - '%s' isn't a capture file.\n", filename);
+        mkcap_stop();
+        return (false);
+    }
+    memcpy(&version, &hdr[6], sizeof(version));
+    if (version > MKCAP_VERSION) {
+        error_printf(false, "MKCap - '%s' is a newer version (%hu) than is supported.\n", filename, version);
+        mkcap_stop();
+        return (false);
+    }
+    if (version >= 2) {
+        // Version 2 added the wall clock time of the start.
+        if (!_read(&hdr[_MKCAP_FILE_HDR_V1_SIZE], _MKCAP_FILE_HDR_SIZE - _MKCAP_FILE_HDR_V1_SIZE)) {
+            error_printf(false, "MKCap - '%s' isn't a capture file.\n", filename);
+            mkcap_stop();
+            return (false);
+        }
+        memcpy(&_stats.start_utc_us, &hdr[16], sizeof(_stats.start_utc_us));
+    }
+    _pkt_pending = false;
+    _replay_cap_us = 0;
+    _replay_t0_us = now_us();
+    _stats.replaying = true;
+    mkcap_replay_next();
+
+    return (true);
+}
+
+bool mkcap_start(const char* filename) {
+    uint8_t hdr[_MKCAP_FILE_HDR_SIZE];
+
+    mkcap_stop();
+    if (FR_OK != cfo_sd_hold()) {
+        return (false);
+    }
+    FRESULT fr = f_open(&_fil, filename, FA_CREATE_ALWAYS | FA_WRITE);
+    if (FR_OK != fr) {
+        error_printf(false, "MKCap - Could not create file '%s' (Error: %d).\n", filename, fr);
+        cfo_sd_release();
+        return (false);
+    }
+    _file_open = true;
+    memset(&_stats, 0, sizeof(mkcap_stats_t));
+    strcpynt(_stats.filename, filename, MKCAP_FILENAME_MAX_LEN);
+    // The header starts the first buffer (so the file is written in whole sectors).
+    memset(hdr, 0, sizeof(hdr));
+    memcpy(hdr, _magic, sizeof(_magic));
+    uint16_t version = MKCAP_VERSION;
+    uint16_t wire = mkwire_wire_get();
+    memcpy(&hdr[6], &version, sizeof(version));
+    memcpy(&hdr[8], &wire, sizeof(wire));
+    // The record times are relative to the start, so the wall clock time of the start dates all of them.
+    _stats.start_utc_us = ntp_clock_us();
+    memcpy(&hdr[16], &_stats.start_utc_us, sizeof(_stats.start_utc_us));
+
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkcap_mutex);
+    _fill = 0;
+    _fill_len = 0;
+    _buf_full[0] = false;
+    _buf_full[1] = false;
+    _write_next = 0;
+    _buf_put(hdr, sizeof(hdr));
+    _ts_last_us = now_us();
+    _recording = true;
+    mutex_exit(&mkcap_mutex);
+    restore_interrupts(flags);
+
+    return (true);
+}
+
+void mkcap_stats(mkcap_stats_t* stats) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkcap_mutex);
+    memcpy(stats, &_stats, sizeof(mkcap_stats_t));
+    stats->recording = _recording;
+    mutex_exit(&mkcap_mutex);
+    restore_interrupts(flags);
+}
+
+void mkcap_stop() {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkcap_mutex);
+    bool was_recording = _recording;
+    _recording = false;
+    mutex_exit(&mkcap_mutex);
+    restore_interrupts(flags);
+
+    if (was_recording) {
+        // Write what is left (the full buffers, then the one being filled).
+        mkcap_write();
+        if (_fill_len > 0) {
+            _file_write(_buf[_fill], _fill_len);
+            _fill_len = 0;
+        }
+    }
+    if (_stats.replaying) {
+        _stats.replaying = false;
+        scheduled_msg_cancel(MSG_WIRE_CAPTURE_REPLAY);
+    }
+    if (_file_open) {
+        f_close(&_fil);
+        _file_open = false;
+        cfo_sd_release();
+    }
+}
+
+void mkcap_write() {
+    while (_file_open && _buf_full[_write_next]) {
+        _file_write(_buf[_write_next], _MKCAP_SECTOR_SIZE);
+        uint32_t flags = save_and_disable_interrupts();
+        mutex_enter_blocking(&mkcap_mutex);
+        _buf_full[_write_next] = false;
+        mutex_exit(&mkcap_mutex);
+        restore_interrupts(flags);
+        _write_next ^= 1;
+    }
+}
+
+void mkcap_module_init() {
+    assert(!_initialized);
+    _initialized = true;
+
+    memset(&_stats, 0, sizeof(mkcap_stats_t));
+    _recording = false;
+    _file_open = false;
+}
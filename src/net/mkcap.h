@@ -0,0 +1,143 @@
+/**
+ * MorseKOB Wire packet capture and replay.
+ *
+ * Records the datagrams received from and sent to the MorseKOB Server, with
+ * microsecond timestamps, to a file on the SD card. A capture can be replayed
+ * (at real time or faster) through the wire receive path while not connected,
+ * for repeatable load tests and decoder checks using real traffic.
+ *
+ * The records are put into one of two sector sized buffers by the backend (as
+ * the packets are processed). When a buffer fills, the UI writes it to the file
+ * (FatFs) while the other buffer is being filled, so the receive path never
+ * waits for the card. If both buffers are full the record is dropped (and counted).
+ *
+ * The file operations (start, stop, write, and replay) are done on the UI core,
+ * as are all of the other SD card operations.
+ *
+ * File format (little-endian):
+ *  Header: "MKCAP" NUL, uint16 version, uint16 wire, uint32 reserved,
+ *          int64 wall clock (UTC) microseconds at the start, 0 if the clock wasn't set
+ *          (24 bytes, version 1 files have a 16 byte header without the start time)
+ *  Records: uint32 microseconds since the previous record, uint16 datagram length,
+ *           uint16 bytes stored (bit 15 set if the datagram was sent), data.
+ *           Trailing zero bytes of a datagram aren't stored (most of the text
+ *           field of a code packet is zeros).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _MK_CAP_H_
+#define _MK_CAP_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MKCAP_VERSION 2
+#define MKCAP_FILENAME_DEFAULT "wire.cap"
+#define MKCAP_FILENAME_MAX_LEN 31
+#define MKCAP_REPLAY_SPEED_MAX 100
+
+/**
+ * @brief Capture and replay statistics.
+ * @ingroup wire
+ */
+typedef struct _MKCAP_STATS_ {
+    bool recording;
+    bool replaying;
+    char filename[MKCAP_FILENAME_MAX_LEN + 1];
+    uint32_t records;       // Records captured (or replayed)
+    uint32_t bytes;         // Bytes written to (or read from) the file
+    uint32_t drops;         // Records dropped because both buffers were full
+    uint32_t write_errors;  // File write errors
+    uint32_t write_us_max;  // Longest time writing a buffer to the file
+    uint16_t speed;         // Replay speed (multiple of real time)
+    uint64_t start_utc_us;  // Wall clock (UTC) time the capture started (0 if not known)
+} mkcap_stats_t;
+
+/**
+ * @brief Indicate if a capture is being recorded.
+ * @ingroup wire
+ */
+extern bool mkcap_recording();
+
+/**
+ * @brief Record a datagram.
+ * @ingroup wire
+ *
+ * Called by mkwire (on the backend) for each datagram received and sent. This
+ * doesn't wait. Nothing is done if a capture isn't being recorded.
+ *
+ * @param sent True if the datagram was sent, false if it was received.
+ * @param ts_us The microsecond time the datagram was received or sent.
+ * @param pkt The datagram.
+ * @param len The length of the datagram.
+ */
+extern void mkcap_record(bool sent, uint64_t ts_us, const uint8_t* pkt, uint16_t len);
+
+/**
+ * @brief Replay the next record(s) that are due. Called when the UI gets a MSG_WIRE_CAPTURE_REPLAY message.
+ * @ingroup wire
+ */
+extern void mkcap_replay_next();
+
+/**
+ * @brief Start replaying a capture.
+ * @ingroup wire
+ *
+ * The received datagrams are put into the wire receive path (the sent ones are
+ * skipped). This can't be done while connected to a wire, or while the server
+ * stand-in is running. This is done on the UI core.
+ *
+ * @param filename The capture file.
+ * @param speed Speed as a multiple of real time (1 to MKCAP_REPLAY_SPEED_MAX).
+ * @return true if the replay was started.
+ */
+extern bool mkcap_replay_start(const char* filename, uint16_t speed);
+
+/**
+ * @brief Start recording a capture (replacing the file if it exists).
+ * @ingroup wire
+ *
+ * This is done on the UI core.
+ *
+ * @param filename The capture file.
+ * @return true if the recording was started.
+ */
+extern bool mkcap_start(const char* filename);
+
+/**
+ * @brief Get the capture and replay statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void mkcap_stats(mkcap_stats_t* stats);
+
+/**
+ * @brief Stop recording or replaying, and close the file.
+ * @ingroup wire
+ *
+ * This is done on the UI core.
+ */
+extern void mkcap_stop();
+
+/**
+ * @brief Write the full buffer(s) to the capture file. Called when the UI gets a MSG_WIRE_CAPTURE_WRITE message.
+ * @ingroup wire
+ */
+extern void mkcap_write();
+
+/**
+ * @brief Initialize the capture module.
+ * @ingroup wire
+ */
+extern void mkcap_module_init();
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _MK_CAP_H_
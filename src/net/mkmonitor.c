@@ -0,0 +1,743 @@
+/**
+ * MorseKOB Wire monitoring.
+ *
+ * Each monitored wire is a slot with its own socket, station table, decoder, and
+ * scrollback. The packet path is the same as for the current wire (mkwire): the
+ * receive IRQ handler only puts the PBUF in a ring (shared by the slots) and the
+ * backend processes it. The code isn't held in a playout buffer (it isn't sounded),
+ * it is decoded as it arrives, with duplicates dropped.
+ *
+ * Memory is fixed: about (MK_MONITOR_STATIONS * 32 + MK_MONITOR_SCROLLBACK_SIZE + 250)
+ * bytes per slot, plus one packet buffer.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "mkmonitor.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cmt.h"
+#include "mkboard.h"
+#include "mks.h"
+#include "mkwire.h"
+#include "morse.h"
+#include "net.h"
+#include "util.h"
+
+#include "pico/cyw43_arch.h"
+#include "pico/mutex.h"
+#include "hardware/sync.h"
+
+#define _MKMONITOR_STATION_STALE_MS (50 * 1000) // Same as for the current wire
+#define _MKMONITOR_DUP_WINDOW 16    // Code from the sender this far behind the last is a duplicate
+#define _MKMONITOR_NONE 0xFF
+#define _MKMONITOR_PKT_BUF_SIZE 496 // Size of a Code packet
+
+#if (MK_MONITOR_STATIONS >= _MKMONITOR_NONE)
+#error "MK_MONITOR_STATIONS must be less than 255"
+#endif
+
+typedef struct _MKMONITOR_STATION_ {
+    bool active;
+    uint32_t ts_recv;   // ms time last heard from
+    char id[MK_MONITOR_STATION_ID_LEN + 1];
+} _mkmonitor_station_t;
+
+typedef struct _MKMONITOR_ {
+    uint16_t wire;                  // 0 if the slot is free
+    struct udp_pcb* pcb;
+    wire_link_state_t link_state;   // WIRE_LINK_ACK_WAIT from when a CONNECT is sent until it is ACK'ed
+    bool connected;                 // A CONNECT has been ACK'ed on the socket
+    bool id_pending;                // Send the ID when the ACK is received
+    uint8_t ack_retries;            // Times the current CONNECT has been sent again
+    uint32_t ts_connect_sent;       // When the current CONNECT was sent
+    bool switching;                 // Data for the previous wire is ignored until the new wire is ACK'ed
+    int32_t seqno_send;
+    int32_t seqno_recv;             // Last sequence number from the sender
+    uint8_t sender;                 // Index of the current sender in `stations`
+    _mkmonitor_station_t stations[MK_MONITOR_STATIONS];
+    morse_decoder_t decoder;
+    char scrollback[MK_MONITOR_SCROLLBACK_SIZE];
+    uint16_t sb_head;               // Where the next character goes
+    uint16_t sb_len;
+    uint32_t packets;
+    uint32_t ack_timeouts;
+    uint32_t send_drops;
+    uint32_t ring_drops;
+    uint32_t invalid;
+    uint32_t duplicates;
+    uint64_t proc_us_total;
+    uint32_t proc_us_max;
+} _mkmonitor_t;
+
+/**
+ * @brief Received packet waiting to be processed.
+ * @ingroup wire
+ */
+typedef struct _MKMONITOR_RECV_ENTRY_ {
+    pbuf_t* p;
+    uint16_t wire;      // The wire the slot was monitoring when the packet was received
+    uint8_t index;      // The monitor slot
+} _mkmonitor_recv_entry_t;
+#define _RECV_RING_SIZE 8 // Must be a power of 2
+
+static void _ack_received(_mkmonitor_t* m);
+static void _ack_timeout_schedule();
+static void _bind_handler(err_enum_t status, struct udp_pcb* udp_pcb);
+static void _monitor_close(_mkmonitor_t* m);
+static void _monitor_reset(_mkmonitor_t* m);
+static void _recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_addr_t* addr, u16_t port);
+static void _recv_data(_mkmonitor_t* m, const uint8_t* pkt, uint16_t len);
+static void _recv_process(_mkmonitor_t* m, pbuf_t* p);
+static void _recv_ring_flush();
+static void _scrollback_append(_mkmonitor_t* m, const char* text);
+static void _send(_mkmonitor_t* m, pbuf_t* p);
+static void _send_connect(_mkmonitor_t* m);
+static uint8_t _station_save(_mkmonitor_t* m, const char* station_id, uint32_t now);
+static void _stations_expire(_mkmonitor_t* m, uint32_t now);
+static void _text_handler(const char* text, void* handler_data);
+
+static bool _initialized = false;
+// The UI reads the scrollback, station IDs and statistics.
+auto_init_mutex(mkmonitor_mutex);
+
+static cmt_msg_t _msg_ack_timeout = { MSG_MKS_MONITOR_ACK_TIMEOUT };
+static cmt_msg_t _msg_connect_next = { MSG_WIRE_MONITOR_CONNECT };
+static cmt_msg_t _msg_packet_received = { MSG_MKS_MONITOR_PACKET_RECEIVED };
+
+static _mkmonitor_t _monitors[MK_MONITOR_WIRES];
+static bool _active = false;            // The current wire is connected, so the monitored wires are
+static const char* _hostname = NULL;
+static uint16_t _port = 0;
+static volatile int _binding = -1;      // Slot a bind is in progress for (only one at a time)
+
+/** Packets received (by the IRQ handler) waiting to be processed by the backend. Single producer, single consumer. */
+static _mkmonitor_recv_entry_t _recv_ring[_RECV_RING_SIZE];
+static volatile uint32_t _recv_ring_head = 0;  // Only changed by the IRQ handler
+static volatile uint32_t _recv_ring_tail = 0;  // Only changed by the backend
+
+/** Static storage for a received packet that isn't contiguous, and for the code from it. */
+static uint8_t _pkt_buf[_MKMONITOR_PKT_BUF_SIZE];
+static code_element_t _code[MKS_PKT_MAX_CODE_LEN];
+
+
+void mkmonitor_ack_timeout() {
+    uint32_t now = now_ms();
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire && m->pcb && WIRE_LINK_ACK_WAIT == m->link_state
+          && (int32_t)(now - m->ts_connect_sent) >= MKWIRE_ACK_TIMEOUT_MS) {
+            m->ack_timeouts++;
+            if (m->ack_retries < MKWIRE_ACK_RETRIES_MAX) {
+                m->ack_retries++;
+                _send_connect(m);
+            }
+            else {
+                // Close the socket. The keep alive will bind a new one and try again.
+                error_printf(false, "MKMonitor - No response from the server for wire %hu.\n", m->wire);
+                _monitor_close(m);
+            }
+        }
+    }
+    _ack_timeout_schedule();
+}
+
+void mkmonitor_connect(const char* hostname, uint16_t port) {
+    _hostname = hostname;
+    _port = port;
+    _active = true;
+    mkmonitor_connect_next();
+}
+
+void mkmonitor_connect_next() {
+    if (!_active) {
+        return;
+    }
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire && m->pcb && WIRE_LINK_DOWN == m->link_state) {
+            m->ack_retries = 0;
+            _send_connect(m);
+        }
+    }
+    if (_binding >= 0 || !wifi_connected()) {
+        return;
+    }
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire && !m->pcb) {
+            // Set before the bind, as the handler can be called before it returns.
+            _binding = i;
+            err_enum_t status = udp_socket_bind(_hostname, _port, _bind_handler);
+            if (!(ERR_OK == status || ERR_INPROGRESS == status)) {
+                _binding = -1;
+                error_printf(false, "MKMonitor - Wire %hu connect failed: %d\n", m->wire, status);
+            }
+            break;
+        }
+    }
+}
+
+void mkmonitor_decode_flush_check() {
+    uint32_t now = now_ms();
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire) {
+            morse_decoder_flush_check(&m->decoder, now);
+        }
+    }
+}
+
+void mkmonitor_disconnect() {
+    _active = false;
+    _binding = -1;  // A bind that completes will be dropped
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire) {
+            _monitor_close(m);
+            morse_decoder_flush(&m->decoder);
+            uint32_t flags = save_and_disable_interrupts();
+            mutex_enter_blocking(&mkmonitor_mutex);
+            memset(m->stations, 0, sizeof(m->stations));
+            m->sender = _MKMONITOR_NONE;
+            mutex_exit(&mkmonitor_mutex);
+            restore_interrupts(flags);
+        }
+    }
+    _recv_ring_flush();
+}
+
+bool mkmonitor_is_monitored(uint16_t wire) {
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        if (wire && _monitors[i].wire == wire) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void mkmonitor_keep_alive_send() {
+    uint32_t now = now_ms();
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire) {
+            if (m->pcb && WIRE_LINK_UP == m->link_state) {
+                // (If still waiting for an ACK, the timeout will take care of it.)
+                m->ack_retries = 0;
+                _send_connect(m);
+            }
+            _stations_expire(m, now);
+        }
+    }
+    // Try again for any that aren't bound.
+    mkmonitor_connect_next();
+}
+
+void mkmonitor_recv_process() {
+    while (_recv_ring_tail != _recv_ring_head) {
+        uint32_t tail = _recv_ring_tail;
+        __mem_fence_acquire();
+        _mkmonitor_recv_entry_t* entry = &_recv_ring[tail & (_RECV_RING_SIZE - 1)];
+        pbuf_t* p = entry->p;
+        _mkmonitor_t* m = &_monitors[entry->index];
+        bool current = (m->pcb && m->wire == entry->wire);
+        _recv_ring_tail = tail + 1;
+        if (current) {
+            uint64_t t_start = now_us();
+            _recv_process(m, p);
+            uint32_t t = (uint32_t)(now_us() - t_start);
+            m->packets++;
+            m->proc_us_total += t;
+            if (t > m->proc_us_max) {
+                m->proc_us_max = t;
+            }
+        }
+        cyw43_arch_lwip_begin();
+        pbuf_free(p);
+        cyw43_arch_lwip_end();
+    }
+}
+
+int mkmonitor_scrollback(int index, char* buf, int maxlen) {
+    int len = 0;
+    if (index >= 0 && index < MK_MONITOR_WIRES) {
+        _mkmonitor_t* m = &_monitors[index];
+        uint32_t flags = save_and_disable_interrupts();
+        mutex_enter_blocking(&mkmonitor_mutex);
+        // Copy the most recent text that fits
+        len = (m->sb_len < maxlen ? m->sb_len : maxlen);
+        int i = (m->sb_head + MK_MONITOR_SCROLLBACK_SIZE - len) % MK_MONITOR_SCROLLBACK_SIZE;
+        for (int j = 0; j < len; j++) {
+            buf[j] = m->scrollback[i];
+            i = (i + 1) % MK_MONITOR_SCROLLBACK_SIZE;
+        }
+        mutex_exit(&mkmonitor_mutex);
+        restore_interrupts(flags);
+    }
+    buf[len] = '\000';
+    return (len);
+}
+
+bool mkmonitor_status(int index, mkmonitor_status_t* status) {
+    memset(status, 0, sizeof(mkmonitor_status_t));
+    if (index < 0 || index >= MK_MONITOR_WIRES || !_monitors[index].wire) {
+        return (false);
+    }
+    _mkmonitor_t* m = &_monitors[index];
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkmonitor_mutex);
+    status->wire = m->wire;
+    status->connected = (m->pcb && m->connected);
+    status->ack_wait = (m->pcb && WIRE_LINK_ACK_WAIT == m->link_state);
+    for (int i = 0; i < MK_MONITOR_STATIONS; i++) {
+        if (m->stations[i].active) {
+            status->stations++;
+        }
+    }
+    if (m->sender != _MKMONITOR_NONE) {
+        strcpy(status->sender, m->stations[m->sender].id);
+    }
+    status->packets = m->packets;
+    status->ack_timeouts = m->ack_timeouts;
+    status->send_drops = m->send_drops;
+    status->ring_drops = m->ring_drops;
+    status->invalid = m->invalid;
+    status->duplicates = m->duplicates;
+    status->proc_us_avg = (m->packets ? (uint32_t)(m->proc_us_total / m->packets) : 0);
+    status->proc_us_max = m->proc_us_max;
+    mutex_exit(&mkmonitor_mutex);
+    restore_interrupts(flags);
+    return (true);
+}
+
+bool mkmonitor_toggle(uint16_t wire) {
+    if (wire < 1 || wire > 999) {
+        return (false);
+    }
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire == wire) {
+            // Stop monitoring it
+            _monitor_close(m);
+            m->wire = 0;
+            return (false);
+        }
+    }
+    if (wire == mkwire_wire_get()) {
+        error_printf(false, "MKMonitor - Wire %hu is the current wire.\n", wire);
+        return (false);
+    }
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (!m->wire) {
+            uint32_t flags = save_and_disable_interrupts();
+            mutex_enter_blocking(&mkmonitor_mutex);
+            _monitor_reset(m);
+            m->wire = wire;
+            mutex_exit(&mkmonitor_mutex);
+            restore_interrupts(flags);
+            mkmonitor_connect_next();
+            return (true);
+        }
+    }
+    error_printf(false, "MKMonitor - Can't monitor wire %hu. All %d slots are in use.\n", wire, MK_MONITOR_WIRES);
+    return (false);
+}
+
+void mkmonitor_wire_swap(uint16_t wire, uint16_t new_wire) {
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (wire && m->wire == wire) {
+            if (m->pcb && WIRE_LINK_DOWN != m->link_state) {
+                // Leave the wire, and ignore its data until the new wire is ACK'ed.
+                _send(m, mkwire_disconnect_req());
+                m->link_state = WIRE_LINK_DOWN;
+                m->connected = false;
+                m->switching = true;
+            }
+            uint32_t flags = save_and_disable_interrupts();
+            mutex_enter_blocking(&mkmonitor_mutex);
+            _monitor_reset(m);
+            m->wire = new_wire;
+            mutex_exit(&mkmonitor_mutex);
+            restore_interrupts(flags);
+            mkmonitor_connect_next();
+            break;
+        }
+    }
+}
+
+void mkmonitor_module_init() {
+    assert(!_initialized);
+    _initialized = true;
+    memset(_monitors, 0, sizeof(_monitors));
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _monitors[i].sender = _MKMONITOR_NONE;
+    }
+}
+
+// *** Local functions ***
+
+/**
+ * @brief Handle an ACK to a CONNECT on a slot's socket. Sends the ID (if it is pending).
+ * @ingroup wire
+ */
+static void _ack_received(_mkmonitor_t* m) {
+    m->switching = false;
+    if (WIRE_LINK_ACK_WAIT == m->link_state) {
+        m->link_state = WIRE_LINK_UP;
+        m->ack_retries = 0;
+        m->connected = true;
+        _ack_timeout_schedule();
+    }
+    if (m->id_pending) {
+        m->id_pending = false;
+        m->seqno_send++;
+        _send(m, mkwire_id_req(m->seqno_send));
+    }
+}
+
+/**
+ * @brief Schedule the ACK timeout for the slot that has been waiting longest (if any are waiting).
+ * @ingroup wire
+ */
+static void _ack_timeout_schedule() {
+    int32_t wait_ms = -1;
+    uint32_t now = now_ms();
+    scheduled_msg_cancel(MSG_MKS_MONITOR_ACK_TIMEOUT);
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        _mkmonitor_t* m = &_monitors[i];
+        if (m->wire && m->pcb && WIRE_LINK_ACK_WAIT == m->link_state) {
+            int32_t w = MKWIRE_ACK_TIMEOUT_MS - (int32_t)(now - m->ts_connect_sent);
+            w = (w > 0 ? w : 1);
+            if (wait_ms < 0 || w < wait_ms) {
+                wait_ms = w;
+            }
+        }
+    }
+    if (wait_ms > 0) {
+        schedule_msg_in_ms(wait_ms, &_msg_ack_timeout);
+    }
+}
+
+/**
+ * @brief Called by `udp_socket_bind` when a socket has been bound for the slot in `_binding`.
+ * @ingroup wire
+ *
+ * This can be called from the network interrupt handling, so the CONNECT is left
+ * to the backend (MSG_WIRE_MONITOR_CONNECT).
+ */
+static void _bind_handler(err_enum_t status, struct udp_pcb* udp_pcb) {
+    int index = _binding;
+    _binding = -1;
+    if (ERR_OK != status) {
+        error_printf(false, "MKMonitor - Bind failed: %d\n", status);
+        return;
+    }
+    _mkmonitor_t* m = (index >= 0 ? &_monitors[index] : NULL);
+    if (!m || !_active || !m->wire || m->pcb) {
+        // No longer needed (disconnected or stopped monitoring while binding)
+        udp_remove(udp_pcb);
+        return;
+    }
+    m->pcb = udp_pcb;
+    m->link_state = WIRE_LINK_DOWN;
+    m->connected = false;
+    udp_recv(udp_pcb, _recv, (void*)(uintptr_t)index);
+    postBEMsgNoWait(&_msg_connect_next);
+}
+
+/**
+ * @brief Send a DISCONNECT and free the socket of a slot.
+ * @ingroup wire
+ */
+static void _monitor_close(_mkmonitor_t* m) {
+    if (m->pcb) {
+        if (WIRE_LINK_DOWN != m->link_state) {
+            _send(m, mkwire_disconnect_req());
+        }
+        cyw43_arch_lwip_begin();
+        udp_remove(m->pcb);
+        cyw43_arch_lwip_end();
+        m->pcb = NULL;
+    }
+    m->link_state = WIRE_LINK_DOWN;
+    m->connected = false;
+    m->id_pending = false;
+    m->switching = false;
+    _ack_timeout_schedule();
+}
+
+/**
+ * @brief Clear the stations, decoder, scrollback and statistics of a slot (for a new wire).
+ * @ingroup wire
+ *
+ * The mutex must be held.
+ */
+static void _monitor_reset(_mkmonitor_t* m) {
+    memset(m->stations, 0, sizeof(m->stations));
+    m->sender = _MKMONITOR_NONE;
+    m->seqno_recv = 0;
+    morse_decoder_init(&m->decoder, _text_handler, m);
+    m->sb_head = 0;
+    m->sb_len = 0;
+    m->packets = 0;
+    m->ack_timeouts = 0;
+    m->send_drops = 0;
+    m->ring_drops = 0;
+    m->invalid = 0;
+    m->duplicates = 0;
+    m->proc_us_total = 0;
+    m->proc_us_max = 0;
+}
+
+/**
+ * @brief Handle a UDP packet received on a monitored wire.
+ * @ingroup wire
+ *
+ * Note: This is called from an interrupt handler. As with the current wire, the
+ * PBUF is put into the receive ring and the backend is let know.
+ *
+ * @param arg The monitor slot index
+ */
+static void _recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_addr_t* addr, u16_t port) {
+    if (p != NULL) {
+        uint8_t index = (uint8_t)(uintptr_t)arg;
+        uint32_t head = _recv_ring_head;
+        if (head - _recv_ring_tail < _RECV_RING_SIZE) {
+            _mkmonitor_recv_entry_t* entry = &_recv_ring[head & (_RECV_RING_SIZE - 1)];
+            entry->p = p;
+            entry->index = index;
+            entry->wire = _monitors[index].wire;
+            __mem_fence_release();
+            _recv_ring_head = head + 1;
+            postBEMsgNoWait(&_msg_packet_received);
+        }
+        else {
+            // Full. The backend is behind, so drop it.
+            _monitors[index].ring_drops++;
+            pbuf_free(p);
+        }
+    }
+}
+
+/**
+ * @brief Handle a Data (Code or ID) packet received on a monitored wire.
+ * @ingroup wire
+ *
+ * @param m The monitor slot
+ * @param pkt The packet data (contiguous)
+ * @param len The length of the packet data
+ */
+static void _recv_data(_mkmonitor_t* m, const uint8_t* pkt, uint16_t len) {
+    int32_t seqno;
+    char station_id[MKS_PKT_MAX_STRING_LEN + 1];
+    int n = mkwire_data_parse(pkt, len, station_id, &seqno, _code);
+    if (n < 0) {
+        m->invalid++;
+        return;
+    }
+    uint32_t now = now_ms();
+    uint8_t station = _station_save(m, station_id, now);
+    if (n == 0) {
+        // ID packet. Update sequence number from sender, ignore others.
+        if (station == m->sender) {
+            m->seqno_recv = seqno;
+        }
+        return;
+    }
+    if (station != m->sender) {
+        // New sender. Finish the text from the last one, and mark the change.
+        morse_decoder_flush(&m->decoder);
+        uint32_t flags = save_and_disable_interrupts();
+        mutex_enter_blocking(&mkmonitor_mutex);
+        m->sender = station;
+        mutex_exit(&mkmonitor_mutex);
+        restore_interrupts(flags);
+        _scrollback_append(m, "\n>");
+        _scrollback_append(m, m->stations[station].id);
+        _scrollback_append(m, "\n");
+    }
+    else if ((m->seqno_recv - seqno) >= 0 && (m->seqno_recv - seqno) < _MKMONITOR_DUP_WINDOW) {
+        m->duplicates++;
+        return;
+    }
+    m->seqno_recv = seqno;
+    mcode_seq_t mcode_seq = { MCODE_SRC_WIRE, n, _code };
+    morse_decoder_decode(&m->decoder, &mcode_seq);
+}
+
+/**
+ * @brief Process a packet received on a monitored wire.
+ * @ingroup wire
+ *
+ * @param m The monitor slot
+ * @param p The PBUF received (the caller frees it)
+ */
+static void _recv_process(_mkmonitor_t* m, pbuf_t* p) {
+    uint16_t total_len = p->tot_len;
+    uint16_t pkt_len = (total_len < sizeof(_pkt_buf) ? total_len : sizeof(_pkt_buf));
+    const uint8_t* pkt = (const uint8_t*)pbuf_get_contiguous(p, _pkt_buf, sizeof(_pkt_buf), pkt_len, 0);
+    int16_t cmd = -1;
+    if (pkt && pkt_len >= sizeof(int16_t)) {
+        memcpy(&cmd, pkt, sizeof(int16_t));
+    }
+    if (MKS_CMD_ACK == cmd) {
+        _ack_received(m);
+    }
+    else if (MKS_CMD_DATA == cmd) {
+        if (!m->switching) {
+            _recv_data(m, pkt, pkt_len);
+        }
+    }
+    else {
+        m->invalid++;
+    }
+}
+
+/**
+ * @brief Free any received packets that haven't been processed.
+ * @ingroup wire
+ */
+static void _recv_ring_flush() {
+    while (_recv_ring_tail != _recv_ring_head) {
+        uint32_t tail = _recv_ring_tail;
+        __mem_fence_acquire();
+        pbuf_t* p = _recv_ring[tail & (_RECV_RING_SIZE - 1)].p;
+        _recv_ring_tail = tail + 1;
+        cyw43_arch_lwip_begin();
+        pbuf_free(p);
+        cyw43_arch_lwip_end();
+    }
+}
+
+/**
+ * @brief Append text to the scrollback of a slot (dropping the oldest text if full).
+ * @ingroup wire
+ */
+static void _scrollback_append(_mkmonitor_t* m, const char* text) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkmonitor_mutex);
+    while (*text) {
+        m->scrollback[m->sb_head] = *text++;
+        m->sb_head = (m->sb_head + 1) % MK_MONITOR_SCROLLBACK_SIZE;
+        if (m->sb_len < MK_MONITOR_SCROLLBACK_SIZE) {
+            m->sb_len++;
+        }
+    }
+    mutex_exit(&mkmonitor_mutex);
+    restore_interrupts(flags);
+}
+
+/**
+ * @brief Send a packet on the socket of a slot, and free it.
+ * @ingroup wire
+ *
+ * The packet is NULL if a PBUF couldn't be allocated for it. That is counted, and
+ * nothing is sent.
+ */
+static void _send(_mkmonitor_t* m, pbuf_t* p) {
+    if (!p) {
+        m->send_drops++;
+        return;
+    }
+    cyw43_arch_lwip_begin();
+    udp_send(m->pcb, p);
+    pbuf_free(p);
+    cyw43_arch_lwip_end();
+}
+
+/**
+ * @brief Send a CONNECT for the slot's wire. The ID is sent when it is ACK'ed.
+ * @ingroup wire
+ *
+ * The slot waits for the ACK (the same as the current wire). If it doesn't come
+ * in MKWIRE_ACK_TIMEOUT_MS the CONNECT is sent again, up to MKWIRE_ACK_RETRIES_MAX
+ * times, and then the socket is closed.
+ */
+static void _send_connect(_mkmonitor_t* m) {
+    m->seqno_send++;
+    m->id_pending = true;
+    m->link_state = WIRE_LINK_ACK_WAIT;
+    m->ts_connect_sent = now_ms();
+    // If it can't be sent the ACK times out and it is sent again
+    _send(m, mkwire_connect_req(m->wire));
+    _ack_timeout_schedule();
+}
+
+/**
+ * @brief Save (add or update the receive time of) a station on a monitored wire.
+ * @ingroup wire
+ *
+ * If the table is full, the station heard from least recently is replaced.
+ *
+ * @return The index of the station in the slot's table.
+ */
+static uint8_t _station_save(_mkmonitor_t* m, const char* station_id, uint32_t now) {
+    uint8_t found = _MKMONITOR_NONE;
+    uint8_t unused = _MKMONITOR_NONE;
+    uint8_t oldest = _MKMONITOR_NONE;
+    for (int i = 0; i < MK_MONITOR_STATIONS; i++) {
+        _mkmonitor_station_t* s = &m->stations[i];
+        if (!s->active) {
+            if (unused == _MKMONITOR_NONE) {
+                unused = i;
+            }
+        }
+        else if (strncmp(s->id, station_id, MK_MONITOR_STATION_ID_LEN) == 0) {
+            found = i;
+            break;
+        }
+        else if (oldest == _MKMONITOR_NONE || s->ts_recv < m->stations[oldest].ts_recv) {
+            oldest = i;
+        }
+    }
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkmonitor_mutex);
+    if (found == _MKMONITOR_NONE) {
+        found = (unused != _MKMONITOR_NONE ? unused : oldest);
+        if (found == m->sender) {
+            m->sender = _MKMONITOR_NONE;
+        }
+        m->stations[found].active = true;
+        strcpynt(m->stations[found].id, station_id, MK_MONITOR_STATION_ID_LEN);
+    }
+    m->stations[found].ts_recv = now;
+    mutex_exit(&mkmonitor_mutex);
+    restore_interrupts(flags);
+    return (found);
+}
+
+/**
+ * @brief Remove the stations of a slot that haven't been heard from in the stale time.
+ * @ingroup wire
+ */
+static void _stations_expire(_mkmonitor_t* m, uint32_t now) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkmonitor_mutex);
+    for (int i = 0; i < MK_MONITOR_STATIONS; i++) {
+        _mkmonitor_station_t* s = &m->stations[i];
+        if (s->active && (now - s->ts_recv) > _MKMONITOR_STATION_STALE_MS) {
+            s->active = false;
+            if (i == m->sender) {
+                m->sender = _MKMONITOR_NONE;
+            }
+        }
+    }
+    mutex_exit(&mkmonitor_mutex);
+    restore_interrupts(flags);
+}
+
+/**
+ * @brief Decoder text handler. Puts the text in the slot's scrollback.
+ * @ingroup wire
+ *
+ * @param handler_data The monitor slot
+ */
+static void _text_handler(const char* text, void* handler_data) {
+    _scrollback_append((_mkmonitor_t*)handler_data, text);
+}
@@ -0,0 +1,206 @@
+/**
+ * MorseKOB Wire monitoring.
+ *
+ * Monitors other wires while connected to the current wire. Each monitored wire
+ * has its own socket (the server tracks clients by IP:Port), a small station table,
+ * a Morse decoder, and a scrollback buffer for the decoded text. Only the current
+ * wire (mkwire) drives the sounder and the code window; the monitored wires are
+ * decoded silently. The number of wires and the sizes are fixed at compile time.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _MK_MONITOR_H_
+#define _MK_MONITOR_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of wires that can be monitored (in addition to the current wire).
+ * @ingroup wire
+ */
+#ifndef MK_MONITOR_WIRES
+#define MK_MONITOR_WIRES 2
+#endif
+
+/**
+ * @brief Number of stations tracked for each monitored wire.
+ * @ingroup wire
+ *
+ * If the table is full, the station heard from least recently is replaced.
+ */
+#ifndef MK_MONITOR_STATIONS
+#define MK_MONITOR_STATIONS 8
+#endif
+
+/**
+ * @brief Length that station IDs are kept to for monitored wires.
+ * @ingroup wire
+ */
+#define MK_MONITOR_STATION_ID_LEN 23
+
+/**
+ * @brief Size of the scrollback (decoded text) buffer for each monitored wire.
+ * @ingroup wire
+ */
+#ifndef MK_MONITOR_SCROLLBACK_SIZE
+#define MK_MONITOR_SCROLLBACK_SIZE 256
+#endif
+
+/**
+ * @brief Status and statistics of a monitored wire.
+ * @ingroup wire
+ */
+typedef struct _MKMONITOR_STATUS_ {
+    uint16_t wire;          // Wire number (0 if the slot isn't being used)
+    bool connected;         // Socket is bound and a CONNECT has been ACK'ed
+    bool ack_wait;          // Waiting for the ACK to a CONNECT
+    int stations;           // Active stations
+    char sender[MK_MONITOR_STATION_ID_LEN + 1]; // Current sender (empty if none)
+    uint32_t packets;       // Packets processed
+    uint32_t ack_timeouts;  // Times an ACK wasn't received in time
+    uint32_t send_drops;    // Packets not sent because a PBUF couldn't be allocated
+    uint32_t ring_drops;    // Packets dropped because the receive ring was full
+    uint32_t invalid;       // Packets dropped because they were invalid
+    uint32_t duplicates;    // Code packets dropped because they were duplicates (or old)
+    uint32_t proc_us_avg;   // Average time processing (and decoding) a packet in the backend
+    uint32_t proc_us_max;   // Longest time processing (and decoding) a packet in the backend
+} mkmonitor_status_t;
+
+/**
+ * @brief Send a CONNECT again (or give up) for the monitored wires whose ACK is overdue.
+ * @ingroup wire
+ *
+ * A wire that doesn't get an ACK after MKWIRE_ACK_RETRIES_MAX retries has its socket
+ * closed (it is tried again with the keep alive). Called when the backend gets a
+ * MSG_MKS_MONITOR_ACK_TIMEOUT message.
+ */
+extern void mkmonitor_ack_timeout();
+
+/**
+ * @brief Bind sockets for (connect) the monitored wires.
+ * @ingroup wire
+ *
+ * Called by mkwire when the current wire is connected. The sockets are bound
+ * one at a time.
+ *
+ * @param hostname The MorseKOB Server host name. This must remain valid.
+ * @param port The MorseKOB Server port.
+ */
+extern void mkmonitor_connect(const char* hostname, uint16_t port);
+
+/**
+ * @brief Send CONNECT on the sockets that have been bound, and bind the next monitored wire.
+ * @ingroup wire
+ *
+ * Called when the backend gets a MSG_WIRE_MONITOR_CONNECT message (posted when a
+ * socket has been bound).
+ */
+extern void mkmonitor_connect_next();
+
+/**
+ * @brief Flush the decoders of monitored wires that haven't received code for a while.
+ * @ingroup wire
+ *
+ * Called from the backend idle processing.
+ */
+extern void mkmonitor_decode_flush_check();
+
+/**
+ * @brief Disconnect from the monitored wires (they remain in the list to monitor).
+ * @ingroup wire
+ *
+ * Called by mkwire when the current wire is disconnected.
+ */
+extern void mkmonitor_disconnect();
+
+/**
+ * @brief Indicate if a wire is being monitored.
+ * @ingroup wire
+ *
+ * @param wire The wire number.
+ * @return true if the wire is being monitored.
+ */
+extern bool mkmonitor_is_monitored(uint16_t wire);
+
+/**
+ * @brief Send the ID on the monitored wires and drop stale stations.
+ * @ingroup wire
+ *
+ * Called by mkwire along with its keep alive. Monitored wires that
+ * aren't connected (a bind failed) are tried again.
+ */
+extern void mkmonitor_keep_alive_send();
+
+/**
+ * @brief Process the packets that have been received on the monitored wires.
+ * @ingroup wire
+ *
+ * Called when the backend gets a MSG_MKS_MONITOR_PACKET_RECEIVED message.
+ */
+extern void mkmonitor_recv_process();
+
+/**
+ * @brief Copy the scrollback (decoded text) of a monitored wire.
+ * @ingroup wire
+ *
+ * This can be called from the UI.
+ *
+ * @param index The monitor slot (0 to MK_MONITOR_WIRES - 1).
+ * @param buf The buffer to copy the text into.
+ * @param maxlen The maximum number of characters to copy (the buffer must be 1 larger).
+ * @return The length of the text copied.
+ */
+extern int mkmonitor_scrollback(int index, char* buf, int maxlen);
+
+/**
+ * @brief Get the status of a monitor slot.
+ * @ingroup wire
+ *
+ * This can be called from the UI.
+ *
+ * @param index The monitor slot (0 to MK_MONITOR_WIRES - 1).
+ * @param status Structure to fill in.
+ * @return true if the slot is monitoring a wire.
+ */
+extern bool mkmonitor_status(int index, mkmonitor_status_t* status);
+
+/**
+ * @brief Start or stop monitoring a wire.
+ * @ingroup wire
+ *
+ * Called when the backend gets a MSG_WIRE_MONITOR_TOGGLE message.
+ *
+ * @param wire The wire number. The current wire can't be monitored.
+ * @return true if the wire is now being monitored, false if not.
+ */
+extern bool mkmonitor_toggle(uint16_t wire);
+
+/**
+ * @brief Switch a monitored wire to a different wire.
+ * @ingroup wire
+ *
+ * Used by mkwire when it switches to a wire that is being monitored. The
+ * monitor slot is switched to the wire that is being left (using the same socket).
+ * Nothing is done if `wire` isn't being monitored.
+ *
+ * @param wire The monitored wire (that is becoming the current wire).
+ * @param new_wire The wire for the slot to monitor instead.
+ */
+extern void mkmonitor_wire_swap(uint16_t wire, uint16_t new_wire);
+
+/**
+ * @brief Initialize the wire monitor module.
+ * @ingroup wire
+ */
+extern void mkmonitor_module_init();
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _MK_MONITOR_H_
@@ -0,0 +1,242 @@
+/**
+ * MorseKOB Server stand-in.
+ *
+ * Code packets are built the way a station builds them - the code for the
+ * text is collected until the packet is (nearly) full - and are sent at the
+ * rate the code would be keyed (the duration of the code in the packet), plus
+ * the injected jitter.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "mksim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmt.h"
+#include "mkboard.h"
+#include "mks.h"
+#include "mkwire.h"
+#include "morse.h"
+#include "net.h"
+#include "util.h"
+
+#include "pico/cyw43_arch.h"
+
+#define _MKSIM_STATION_ID_MAX_LEN 15
+// The longest character (9 elements) is 18 code values, so stop filling a packet when there isn't room for that.
+#define _MKSIM_CHAR_CODE_MAX (2 * MORSE_MAX_DDS_IN_CHAR)
+
+static const char* _text = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 1234567890 = ";
+
+static cmt_msg_t _msg_send = { MSG_MKS_SIM_SEND };
+
+static bool _running = false;
+static mksim_params_t _params;
+static mksim_stats_t _stats;
+static uint32_t _ts_start;
+static uint32_t _ts_ids;            // ms time the IDs were last sent
+static int _sender;                 // Station sending
+static const char* _text_next;      // Next character the sender sends
+static char _station_ids[MKSIM_STATIONS_MAX][_MKSIM_STATION_ID_MAX_LEN + 1];
+static int32_t _seqno[MKSIM_STATIONS_MAX];
+static pbuf_t* _held = NULL;        // Packet being held to be sent out of order
+static int32_t _jitter_last;        // Delay of the last packet
+static uint64_t _latency_ms_total;
+static uint32_t _rand;
+
+/**
+ * @brief Pseudo-random number (xorshift32). Good enough for injecting errors.
+ * @ingroup wire
+ */
+static uint32_t _random() {
+    _rand ^= _rand << 13;
+    _rand ^= _rand >> 17;
+    _rand ^= _rand << 5;
+    return (_rand);
+}
+
+static bool _chance(uint8_t pct) {
+    return (pct && (_random() % 100) < pct);
+}
+
+/**
+ * @brief Build a packet for a station. Counts it as dropped (and returns NULL) if there isn't a PBUF for it.
+ * @ingroup wire
+ */
+static pbuf_t* _code_req(int station, const code_element_t* code, int n) {
+    pbuf_t* p = mkwire_code_req(_station_ids[station], _seqno[station], code, n);
+    if (!p) {
+        _stats.alloc_drops++;
+    }
+    return (p);
+}
+
+static void _inject(pbuf_t* p) {
+    if (p) {
+        _stats.packets++;
+        mkwire_recv_inject(p);
+    }
+}
+
+static void _send_ids() {
+    for (int i = 0; i < _params.stations; i++) {
+        _inject(_code_req(i, NULL, 0));
+    }
+}
+
+
+void mksim_decoded(const mcode_seq_t* mcode_seq) {
+    if (!_running || MCODE_SRC_WIRE != mcode_seq->source) {
+        return;
+    }
+    uint32_t latency = now_ms() - mcode_seq->ts_recv;
+    _stats.decoded++;
+    _latency_ms_total += latency;
+    if (latency > _stats.latency_ms_max) {
+        _stats.latency_ms_max = latency;
+    }
+    if (latency > _stats.latency_ms_limit) {
+        _stats.latency_over++;
+    }
+}
+
+bool mksim_running() {
+    return (_running);
+}
+
+void mksim_send() {
+    if (!_running) {
+        return;
+    }
+    if (mkwire_is_connected()) {
+        // The real server is in use.
+        mksim_stop();
+        return;
+    }
+    uint32_t now = now_ms();
+    if ((now - _ts_ids) >= MKS_KEEP_ALIVE_TIME) {
+        _ts_ids = now;
+        _send_ids();
+    }
+    // Fill a packet with code for the sender's text.
+    code_element_t code[MKS_PKT_MAX_CODE_LEN];
+    int n = 0;
+    int32_t span = 0;
+    int station = _sender;
+    while (*_text_next && (n + _MKSIM_CHAR_CODE_MAX) <= MKS_CODESEQ_MAX_LEN) {
+        mcode_seq_t* mcode_seq = morse_encode(*_text_next++);
+        if (mcode_seq) {
+            for (int i = 0; i < mcode_seq->len; i++) {
+                code_element_t c = mcode_seq->code_seq[i];
+                code[n++] = c;
+                span += (c < 0 ? -c : c);
+            }
+            mcode_seq_free(mcode_seq);
+        }
+        _stats.chars++;
+    }
+    if (!*_text_next) {
+        // Done with the text. The next station takes a turn.
+        _sender = (_sender + 1) % _params.stations;
+        _text_next = _text;
+    }
+    if (n > 0) {
+        _seqno[station]++;
+        _stats.code_packets++;
+        if (_chance(_params.loss_pct)) {
+            _stats.lost++;
+        }
+        else {
+            pbuf_t* p = _code_req(station, code, n);
+            if (p && !_held && _chance(_params.reorder_pct)) {
+                // Hold it, to send after the next one. The next one waits for this one's code
+                // to be played, so the limit allows for it.
+                _held = p;
+                _stats.reordered++;
+                uint32_t limit = MKSIM_LATENCY_LIMIT_MS + _params.jitter_ms + (uint32_t)span;
+                if (limit > _stats.latency_ms_limit) {
+                    _stats.latency_ms_limit = limit;
+                }
+            }
+            else {
+                _inject(p);
+                if (_chance(_params.dup_pct)) {
+                    _stats.duplicated++;
+                    _inject(_code_req(station, code, n));
+                }
+                if (_held) {
+                    pbuf_t* held = _held;
+                    _held = NULL;
+                    _inject(held);
+                }
+            }
+        }
+    }
+    // Send the next packet when the code in this one would have been keyed, moved by the jitter.
+    int32_t jitter = (_params.jitter_ms ? (int32_t)(_random() % (_params.jitter_ms + 1)) : 0);
+    int32_t delay = span + (jitter - _jitter_last);
+    _jitter_last = jitter;
+    schedule_msg_in_ms((delay > 0 ? delay : 1), &_msg_send);
+}
+
+void mksim_start(const mksim_params_t* params) {
+    if (_running) {
+        mksim_stop();
+    }
+    if (mkwire_is_connected()) {
+        error_printf(false, "MKSim - Can't run while connected to a wire.\n");
+        return;
+    }
+    _params = *params;
+    if (_params.stations < 1) {
+        _params.stations = 1;
+    }
+    else if (_params.stations > MKSIM_STATIONS_MAX) {
+        _params.stations = MKSIM_STATIONS_MAX;
+    }
+    _params.loss_pct = (_params.loss_pct > 100 ? 100 : _params.loss_pct);
+    _params.reorder_pct = (_params.reorder_pct > 100 ? 100 : _params.reorder_pct);
+    _params.dup_pct = (_params.dup_pct > 100 ? 100 : _params.dup_pct);
+    _params.jitter_ms = (_params.jitter_ms > MKSIM_JITTER_MAX_MS ? MKSIM_JITTER_MAX_MS : _params.jitter_ms);
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.latency_ms_limit = MKSIM_LATENCY_LIMIT_MS + _params.jitter_ms;
+    _latency_ms_total = 0;
+    _rand = ((uint32_t)now_us() | 1);
+    for (int i = 0; i < _params.stations; i++) {
+        snprintf(_station_ids[i], sizeof(_station_ids[i]), "SIM %d, MuKOB", i + 1);
+        _seqno[i] = (int32_t)(_random() & 0xFFFF);
+    }
+    _sender = 0;
+    _text_next = _text;
+    _jitter_last = 0;
+    _ts_start = now_ms();
+    _ts_ids = _ts_start;
+    _running = true;
+    _send_ids();
+    mksim_send();
+}
+
+void mksim_stats(mksim_stats_t* stats) {
+    memcpy(stats, &_stats, sizeof(mksim_stats_t));
+    stats->running = _running;
+    stats->elapsed_ms = (_running ? now_ms() - _ts_start : _stats.elapsed_ms);
+    stats->latency_ms_avg = (_stats.decoded ? (uint32_t)(_latency_ms_total / _stats.decoded) : 0);
+    stats->pass = (_stats.decoded > 0 && 0 == _stats.latency_over && 0 == _stats.alloc_drops);
+}
+
+void mksim_stop() {
+    if (_running) {
+        _running = false;
+        scheduled_msg_cancel(MSG_MKS_SIM_SEND);
+        _stats.elapsed_ms = now_ms() - _ts_start;
+        if (_held) {
+            cyw43_arch_lwip_begin();
+            pbuf_free(_held);
+            cyw43_arch_lwip_end();
+            _held = NULL;
+        }
+    }
+}
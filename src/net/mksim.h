@@ -0,0 +1,134 @@
+/**
+ * MorseKOB Server stand-in.
+ *
+ * Generates the traffic of a wire with a number of fake stations, for exercising
+ * the wire receive path (mkwire, the playout buffer, the station store, and the
+ * decoder) without a server. The stations take turns sending a fixed text, and
+ * send their IDs at the keep alive interval. Packet loss, reordering, duplication
+ * and jitter can be injected.
+ *
+ * The packets are put directly into the wire receive path, so this only runs
+ * while the wire isn't connected (it stops if the wire connects).
+ *
+ * The receive path timestamps each packet as it is put in. When a sequence reaches
+ * the decoder the backend reports it (`mksim_decoded`), and the receive to decode
+ * latency is measured. A run passes if the code was decoded, none of it took longer
+ * than the latency limit, and no packet was dropped for lack of a PBUF.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _MK_SIM_H_
+#define _MK_SIM_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "jbuf.h"
+#include "mks.h"
+
+#define MKSIM_STATIONS_MAX 4
+#define MKSIM_JITTER_MAX_MS 2000
+
+/**
+ * @brief The longest a sequence should take from being received to being decoded.
+ * @ingroup wire
+ *
+ * This is the longest playout delay plus the longest wait for a missing sequence.
+ * The jitter being injected is added to it, as packets bunched up by the jitter
+ * wait for the ones ahead of them to be played. So is the code time of the longest
+ * packet sent out of order, as the packet sent before it waits for it to be played.
+ */
+#define MKSIM_LATENCY_LIMIT_MS (JBUF_TARGET_MAX_MS + JBUF_REORDER_WAIT_MAX_MS)
+
+/**
+ * @brief Server stand-in parameters.
+ * @ingroup wire
+ */
+typedef struct _MKSIM_PARAMS_ {
+    uint8_t stations;       // Number of fake stations (1 to MKSIM_STATIONS_MAX)
+    uint8_t loss_pct;       // Percent of code packets that are dropped
+    uint8_t reorder_pct;    // Percent of code packets that are held and sent after the next one
+    uint8_t dup_pct;        // Percent of code packets that are sent twice
+    uint16_t jitter_ms;     // Maximum random delay of a packet (to MKSIM_JITTER_MAX_MS)
+} mksim_params_t;
+
+/**
+ * @brief Server stand-in statistics.
+ * @ingroup wire
+ */
+typedef struct _MKSIM_STATS_ {
+    bool running;
+    uint32_t elapsed_ms;    // Time running
+    uint32_t packets;       // Packets put in the receive path (including IDs and duplicates)
+    uint32_t code_packets;  // Code packets generated
+    uint32_t lost;          // Code packets dropped
+    uint32_t reordered;     // Code packets sent after the next one
+    uint32_t duplicated;    // Code packets sent twice
+    uint32_t chars;         // Characters sent
+    uint32_t alloc_drops;   // Packets not sent because a PBUF couldn't be allocated
+    uint32_t decoded;       // Code sequences that reached the decoder
+    uint32_t latency_ms_avg;    // Receive to decode latency
+    uint32_t latency_ms_max;
+    uint32_t latency_ms_limit;  // MKSIM_LATENCY_LIMIT_MS plus the jitter and the longest reordered packet's code
+    uint32_t latency_over;  // Sequences that took longer than the limit
+    bool pass;              // Code was decoded, all within the limit, and no PBUF drops
+} mksim_stats_t;
+
+/**
+ * @brief Record the latency of a sequence that reached the decoder.
+ * @ingroup wire
+ *
+ * This is called by the backend after a sequence is decoded. Only wire sequences
+ * received while the server stand-in is running are counted.
+ *
+ * @param mcode_seq The sequence.
+ */
+extern void mksim_decoded(const mcode_seq_t* mcode_seq);
+
+/**
+ * @brief Indicate if the server stand-in is running.
+ * @ingroup wire
+ */
+extern bool mksim_running();
+
+/**
+ * @brief Generate the next packet(s). Called when the backend gets a MSG_MKS_SIM_SEND message.
+ * @ingroup wire
+ */
+extern void mksim_send();
+
+/**
+ * @brief Start the server stand-in (restarting it if it is running).
+ * @ingroup wire
+ *
+ * This is done by the backend (MSG_MKS_SIM_START). The values are limited to their ranges.
+ *
+ * @param params The parameters.
+ */
+extern void mksim_start(const mksim_params_t* params);
+
+/**
+ * @brief Get the server stand-in statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void mksim_stats(mksim_stats_t* stats);
+
+/**
+ * @brief Stop the server stand-in.
+ * @ingroup wire
+ *
+ * This is done by the backend (MSG_MKS_SIM_STOP).
+ */
+extern void mksim_stop();
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _MK_SIM_H_
@@ -0,0 +1,35 @@
+/**
+ * MorseKOB Server packet formats.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "mkspkt.h"
+
+#include <string.h>
+
+int mkspkt_data_parse(const uint8_t* pkt, uint16_t len, char* station_id, int32_t* seqno, code_element_t* code) {
+    // Make sure that it contains all of the fields we use, and that they are sane.
+    if (len < MKSPKT_CODE_OFFSET_TEXT) {
+        return (-1);
+    }
+    int16_t bytes = mkspkt_i16(pkt, MKSPKT_CODE_OFFSET_BYTES);
+    int32_t n = mkspkt_i32(pkt, MKSPKT_CODE_OFFSET_N);
+    if (bytes < (MKSPKT_CODE_OFFSET_TEXT - MKSPKT_CODE_OFFSET_ID) || bytes > (len - MKSPKT_CODE_OFFSET_ID)
+        || n < 0 || n > MKS_PKT_MAX_CODE_LEN) {
+        return (-1);
+    }
+    *seqno = mkspkt_i32(pkt, MKSPKT_CODE_OFFSET_SEQNO);
+    // The ID field isn't required to be terminated, so it is copied (up to the end of the field).
+    const char* id = (const char*)(pkt + MKSPKT_CODE_OFFSET_ID);
+    int i;
+    for (i = 0; i < MKS_PKT_MAX_STRING_LEN && id[i]; i++) {
+        station_id[i] = id[i];
+    }
+    station_id[i] = '\0';
+    if (code) {
+        memcpy(code, pkt + MKSPKT_CODE_OFFSET_CODE_LIST, sizeof(code_element_t) * n);
+    }
+    return ((int)n);
+}
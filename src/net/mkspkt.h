@@ -0,0 +1,141 @@
+/**
+ * MorseKOB Server packet formats.
+ *
+ * The layouts of the packets exchanged with the MorseKOB Server, and the checking
+ * and unpacking of a received Data (Code or ID) packet. The unpacking only uses
+ * the packet bytes (no network or system state), so it can be tested on its own.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _MK_SPKT_H_
+#define _MK_SPKT_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#include "mks.h"
+
+/**
+ * @brief shortPacketFormat
+ * @ingroup wire
+ *
+ * ("<hh")  # cmd, wire
+ */
+typedef struct mkspkt_cmd_wire {
+    int16_t cmd;        // h (2)
+    int16_t wire;       // h (2)
+} mkspkt_cmd_wire_t;
+// Cmd+Wire Packet Member offsets:
+#define MKSPKT_CW_OFFSET_CMD 0
+#define MKSPKT_CW_OFFSET_WIRE 2
+
+/**
+ * @brief idPacketFormat
+ * @ingroup wire
+ *
+ * ("<hh 128s 4x i i 8x 208x 128s 8x")  # cmd, byts, id, seq, idflag, ver
+ */
+typedef struct mkspkt_id {
+    int16_t cmd;                                // h (2)
+    int16_t bytes;                              // h (2) = size from `id` to the end (492)
+    char id[MKS_PKT_MAX_STRING_LEN + 1];        // 128s
+    uint8_t pad1[4];                            // 4x
+    int32_t seqno;                              // i (4)
+    int32_t idflag;                             // i (4)
+    uint8_t pad2[8];                            // 8x
+    uint8_t pad3[208];                          // 208x
+    char version[MKS_PKT_MAX_STRING_LEN + 1];   // 128s
+    uint8_t pad4[8];                            // 8x
+    //                                          ==========
+    //                                           496 bytes
+} mkspkt_id_t;
+// ID Packet Member offsets:
+#define MKSPKT_ID_OFFSET_CMD 0
+#define MKSPKT_ID_OFFSET_BYTES 2
+#define MKSPKT_ID_OFFSET_ID 4
+#define MKSPKT_ID_OFFSET_PAD1 132
+#define MKSPKT_ID_OFFSET_SEQNO 136
+#define MKSPKT_ID_OFFSET_IDFLAG 140
+#define MKSPKT_ID_OFFSET_PAD2 144
+#define MKSPKT_ID_OFFSET_PAD3 152
+#define MKSPKT_ID_OFFSET_VERSION 360
+#define MKSPKT_ID_OFFSET_PAD4 488
+#define MKSPKT_ID_LEN 496
+
+/**
+ * @brief codePacketFormat
+ * @ingroup wire
+ *
+ * ("<hh 128s 4x i 12x 51i i 128s 8x")  # cmd, byts, id, seq, code list, n, txt
+ */
+typedef struct mkspkt_code {
+    int16_t cmd;                                // h (2)
+    int16_t bytes;                              // h (2) = size from `id` to the end (492)
+    char id[MKS_PKT_MAX_STRING_LEN + 1];        // 128s
+    uint8_t pad1[4];                            // 4x
+    int32_t seqno;                              // i (4)
+    uint8_t pad2[12];                           // 12x
+    int32_t code_list[MKS_PKT_MAX_CODE_LEN];    // 51i (204)
+    int32_t n;                                  // i (4)
+    char text[MKS_PKT_MAX_STRING_LEN + 1];      // 128s
+    uint8_t pad3[8];                            // 8x
+    //                                          ==========
+    //                                           496 bytes
+} mkspkt_code_t;
+// Code Packet Member offsets:
+#define MKSPKT_CODE_OFFSET_CMD 0
+#define MKSPKT_CODE_OFFSET_BYTES 2
+#define MKSPKT_CODE_OFFSET_ID 4
+#define MKSPKT_CODE_OFFSET_PAD1 132
+#define MKSPKT_CODE_OFFSET_SEQNO 136
+#define MKSPKT_CODE_OFFSET_PAD2 140
+#define MKSPKT_CODE_OFFSET_CODE_LIST 152
+#define MKSPKT_CODE_OFFSET_N 356
+#define MKSPKT_CODE_OFFSET_TEXT 360
+#define MKSPKT_CODE_OFFSET_PAD3 488
+#define MKSPKT_CODE_LEN 496
+
+/**
+ * @brief Get a 16 bit value from a received packet (little-endian, possibly unaligned).
+ * @ingroup wire
+ */
+static inline int16_t mkspkt_i16(const uint8_t* pkt, int offset) {
+    int16_t v;
+    memcpy(&v, pkt + offset, sizeof(int16_t));
+    return (v);
+}
+
+/**
+ * @brief Get a 32 bit value from a received packet (little-endian, possibly unaligned).
+ * @ingroup wire
+ */
+static inline int32_t mkspkt_i32(const uint8_t* pkt, int offset) {
+    int32_t v;
+    memcpy(&v, pkt + offset, sizeof(int32_t));
+    return (v);
+}
+
+/**
+ * @brief Check and unpack a Data (Code or ID) packet.
+ * @ingroup wire
+ *
+ * The packet doesn't need to be aligned. Everything used is copied out of it.
+ *
+ * @param pkt The packet data (contiguous).
+ * @param len The length of the packet data.
+ * @param station_id Buffer for the sending station's ID (MKS_PKT_MAX_STRING_LEN + 1 long).
+ * @param seqno Set to the packet sequence number.
+ * @param code Buffer to copy the code elements into (MKS_PKT_MAX_CODE_LEN long), or NULL to skip the copy.
+ * @return The number of code elements (0 for an ID packet), or -1 if the packet isn't valid.
+ */
+extern int mkspkt_data_parse(const uint8_t* pkt, uint16_t len, char* station_id, int32_t* seqno, code_element_t* code);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _MK_SPKT_H_
@@ -0,0 +1,463 @@
+/**
+ * MorseKOB active station store.
+ *
+ * The stations are found through an open-addressing hash index on the station ID,
+ * and are kept in a list ordered by the last time the station was heard from (most
+ * recent first), so stale stations can be expired from the end of the list.
+ * Unused entries are kept in a free list (through `lru_next`).
+ *
+ * The IDs are stored in the arena as: owner-handle byte, characters, NUL. When a
+ * station is removed its owner byte is marked free. When the arena fills, it is
+ * compacted by sliding the IDs that are still in use down over the freed ones.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "mkstation.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "cmt.h"
+#include "util.h"
+
+#include "pico/mutex.h"
+#include "hardware/sync.h"
+
+#define _MKSTATION_INDEX_SIZE 256 // Must be a power of 2 and at least twice the number of stations
+#define _MKSTATION_ARENA_FREE MK_STATION_NONE
+
+#if (MK_MAX_ACTIVE_STATIONS >= 255)
+#error "MK_MAX_ACTIVE_STATIONS must be less than 255"
+#endif
+#if (_MKSTATION_INDEX_SIZE < (2 * MK_MAX_ACTIVE_STATIONS))
+#error "_MKSTATION_INDEX_SIZE must be at least twice MK_MAX_ACTIVE_STATIONS"
+#endif
+#if (MK_STATION_ID_ARENA_SIZE < (MK_STATION_ID_MAX_LEN + 2) || MK_STATION_ID_ARENA_SIZE > 0xFFFF)
+#error "MK_STATION_ID_ARENA_SIZE must be able to hold the longest ID and be less than 64K"
+#endif
+
+/**
+ * Stations saved for a wire. Each station is stored as: info, ID, NUL (most
+ * recently heard from first).
+ */
+typedef struct _MKSTATION_WIRE_CACHE_ {
+    uint16_t wire;                      // 0 if the slot is free
+    uint16_t used;                      // Bytes of `data` used
+    uint32_t ts_saved;
+    uint8_t data[MK_STATION_WIRE_CACHE_SIZE];
+} _mkstation_wire_cache_t;
+
+typedef struct _MKSTATION_ENTRY_ {
+    mk_station_info_t info;
+    mk_station_seq_stats_t seq;
+    uint16_t hash;
+    uint16_t id_offset;                 // Offset of the ID in the arena
+    mk_station_handle_t lru_prev;       // Entry heard from more recently
+    mk_station_handle_t lru_next;       // Entry heard from less recently
+    bool active;
+} _mkstation_entry_t;
+
+static bool _initialized = false;
+// The UI reads IDs, which move when the arena is compacted.
+auto_init_mutex(mkstation_mutex);
+
+static _mkstation_entry_t _stations[MK_MAX_ACTIVE_STATIONS];
+static mk_station_handle_t _index[_MKSTATION_INDEX_SIZE];   // Hash index (linear probing) of ID to entry
+static char _id_arena[MK_STATION_ID_ARENA_SIZE];
+static uint16_t _arena_used;        // End of the IDs in the arena
+static uint16_t _arena_freed;       // Bytes of removed IDs (recovered by compaction)
+static mk_station_handle_t _lru_head;   // Most recently heard from
+static mk_station_handle_t _lru_tail;   // Least recently heard from
+static mk_station_handle_t _free;
+static int _count;
+static mkstation_stats_t _stats;
+static _mkstation_wire_cache_t _wire_cache[MK_STATION_WIRE_CACHE_WIRES];
+
+
+static void _post_station_msg(msg_id_t id, mk_station_handle_t handle) {
+    cmt_msg_t msg_send;
+    msg_send.id = id;
+    msg_send.data.station = handle;
+    postUIMsgBlocking(&msg_send);
+}
+
+/**
+ * @brief FNV-1a hash of a station ID, folded to 16 bits.
+ */
+static uint16_t _hash(const char* station_id, int len) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (uint8_t)station_id[i];
+        h *= 16777619u;
+    }
+    return ((uint16_t)(h ^ (h >> 16)));
+}
+
+static void _arena_compact() {
+    uint16_t rd = 0;
+    uint16_t wr = 0;
+    while (rd < _arena_used) {
+        mk_station_handle_t owner = (mk_station_handle_t)_id_arena[rd];
+        uint16_t n = strlen(&_id_arena[rd + 1]) + 2;
+        if (owner != _MKSTATION_ARENA_FREE) {
+            if (wr != rd) {
+                memmove(&_id_arena[wr], &_id_arena[rd], n);
+                _stations[owner].id_offset = wr + 1;
+            }
+            wr += n;
+        }
+        rd += n;
+    }
+    _arena_used = wr;
+    _arena_freed = 0;
+    _stats.compactions++;
+}
+
+static bool _arena_fits(int len) {
+    return ((_arena_used - _arena_freed) + len + 2 <= MK_STATION_ID_ARENA_SIZE);
+}
+
+/**
+ * @brief Store an ID in the arena for a station. Must be called with the lock held.
+ */
+static void _id_intern(mk_station_handle_t handle, const char* station_id, int len) {
+    if (_arena_used + len + 2 > MK_STATION_ID_ARENA_SIZE) {
+        _arena_compact();
+    }
+    _id_arena[_arena_used] = (char)handle;
+    memcpy(&_id_arena[_arena_used + 1], station_id, len);
+    _id_arena[_arena_used + 1 + len] = '\000';
+    _stations[handle].id_offset = _arena_used + 1;
+    _arena_used += len + 2;
+}
+
+static mk_station_handle_t _find(const char* station_id, int len, uint16_t hash) {
+    for (int i = 0; i < _MKSTATION_INDEX_SIZE; i++) {
+        mk_station_handle_t h = _index[(hash + i) & (_MKSTATION_INDEX_SIZE - 1)];
+        if (MK_STATION_NONE == h) {
+            break;
+        }
+        _mkstation_entry_t* se = &_stations[h];
+        const char* id = &_id_arena[se->id_offset];
+        if (se->hash == hash && strncmp(id, station_id, len) == 0 && id[len] == '\000') {
+            return (h);
+        }
+    }
+    return (MK_STATION_NONE);
+}
+
+static void _index_add(mk_station_handle_t handle) {
+    uint32_t slot = _stations[handle].hash & (_MKSTATION_INDEX_SIZE - 1);
+    while (_index[slot] != MK_STATION_NONE) {
+        slot = (slot + 1) & (_MKSTATION_INDEX_SIZE - 1);
+    }
+    _index[slot] = handle;
+}
+
+/**
+ * @brief Remove an entry from the hash index.
+ *
+ * Uses backward-shift deletion, so the probe sequences stay intact without tombstones.
+ */
+static void _index_remove(mk_station_handle_t handle) {
+    uint32_t mask = (_MKSTATION_INDEX_SIZE - 1);
+    uint32_t slot = _stations[handle].hash & mask;
+    while (_index[slot] != handle) {
+        slot = (slot + 1) & mask;
+    }
+    uint32_t next = (slot + 1) & mask;
+    while (_index[next] != MK_STATION_NONE) {
+        uint32_t home = _stations[_index[next]].hash & mask;
+        // Move the entry back if its home slot isn't between the hole and where it is.
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+            _index[slot] = _index[next];
+            slot = next;
+        }
+        next = (next + 1) & mask;
+    }
+    _index[slot] = MK_STATION_NONE;
+}
+
+static void _lru_unlink(mk_station_handle_t handle) {
+    _mkstation_entry_t* se = &_stations[handle];
+    if (se->lru_prev != MK_STATION_NONE) {
+        _stations[se->lru_prev].lru_next = se->lru_next;
+    }
+    else {
+        _lru_head = se->lru_next;
+    }
+    if (se->lru_next != MK_STATION_NONE) {
+        _stations[se->lru_next].lru_prev = se->lru_prev;
+    }
+    else {
+        _lru_tail = se->lru_prev;
+    }
+    se->lru_prev = MK_STATION_NONE;
+    se->lru_next = MK_STATION_NONE;
+}
+
+static void _lru_push(mk_station_handle_t handle) {
+    _mkstation_entry_t* se = &_stations[handle];
+    se->lru_prev = MK_STATION_NONE;
+    se->lru_next = _lru_head;
+    if (_lru_head != MK_STATION_NONE) {
+        _stations[_lru_head].lru_prev = handle;
+    }
+    _lru_head = handle;
+    if (_lru_tail == MK_STATION_NONE) {
+        _lru_tail = handle;
+    }
+}
+
+/**
+ * @brief Remove a station and let the UI know it has expired.
+ */
+static void _remove(mk_station_handle_t handle) {
+    _mkstation_entry_t* se = &_stations[handle];
+    _index_remove(handle);
+    _lru_unlink(handle);
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkstation_mutex);
+    _id_arena[se->id_offset - 1] = (char)_MKSTATION_ARENA_FREE;
+    _arena_freed += strlen(&_id_arena[se->id_offset]) + 2;
+    se->active = false;
+    mutex_exit(&mkstation_mutex);
+    restore_interrupts(flags);
+    se->lru_next = _free;
+    _free = handle;
+    _count--;
+    _post_station_msg(MSG_WIRE_STATION_EXPIRED, handle);
+}
+
+/**
+ * @brief Add a new station and let the UI know about it.
+ */
+static mk_station_handle_t _add(const char* station_id, int len, uint16_t hash, const mk_station_info_t* info) {
+    // Make room for it if needed (drop the least recently heard from).
+    while (MK_STATION_NONE == _free || !_arena_fits(len)) {
+        _stats.evictions++;
+        _remove(_lru_tail);
+    }
+    mk_station_handle_t h = _free;
+    _mkstation_entry_t* se = &_stations[h];
+    _free = se->lru_next;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkstation_mutex);
+    _id_intern(h, station_id, len);
+    se->hash = hash;
+    se->info = *info;
+    memset(&se->seq, 0, sizeof(mk_station_seq_stats_t));
+    se->active = true;
+    mutex_exit(&mkstation_mutex);
+    restore_interrupts(flags);
+    _index_add(h);
+    _lru_push(h);
+    _count++;
+    _post_station_msg(MSG_WIRE_STATION_ADDED, h);
+
+    return (h);
+}
+
+
+void mkstation_clear() {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkstation_mutex);
+    _free = MK_STATION_NONE;
+    for (int i = MK_MAX_ACTIVE_STATIONS - 1; i >= 0; i--) {
+        _mkstation_entry_t* se = &_stations[i];
+        memset(&se->info, 0, sizeof(mk_station_info_t));
+        memset(&se->seq, 0, sizeof(mk_station_seq_stats_t));
+        se->active = false;
+        se->lru_prev = MK_STATION_NONE;
+        se->lru_next = _free;
+        _free = (mk_station_handle_t)i;
+    }
+    for (int i = 0; i < _MKSTATION_INDEX_SIZE; i++) {
+        _index[i] = MK_STATION_NONE;
+    }
+    _lru_head = MK_STATION_NONE;
+    _lru_tail = MK_STATION_NONE;
+    _arena_used = 0;
+    _arena_freed = 0;
+    _count = 0;
+    mutex_exit(&mkstation_mutex);
+    restore_interrupts(flags);
+}
+
+void mkstation_expire(uint32_t now, uint32_t stale_ms) {
+    while (_lru_tail != MK_STATION_NONE && (now - _stations[_lru_tail].info.ts_ping) > stale_ms) {
+        _remove(_lru_tail);
+    }
+}
+
+mk_station_handle_t mkstation_find(const char* station_id) {
+    int len = strnlen(station_id, MK_STATION_ID_MAX_LEN);
+    return (_find(station_id, len, _hash(station_id, len)));
+}
+
+int mkstation_id(mk_station_handle_t handle, char* buf, int maxlen) {
+    int len = 0;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkstation_mutex);
+    if (handle < MK_MAX_ACTIVE_STATIONS && _stations[handle].active) {
+        len = strcpynt(buf, &_id_arena[_stations[handle].id_offset], maxlen);
+    }
+    else {
+        *buf = '\000';
+    }
+    mutex_exit(&mkstation_mutex);
+    restore_interrupts(flags);
+
+    return (len);
+}
+
+bool mkstation_info(mk_station_handle_t handle, mk_station_info_t* info) {
+    bool active = false;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkstation_mutex);
+    if (handle < MK_MAX_ACTIVE_STATIONS && _stations[handle].active) {
+        *info = _stations[handle].info;
+        active = true;
+    }
+    mutex_exit(&mkstation_mutex);
+    restore_interrupts(flags);
+
+    return (active);
+}
+
+void mkstation_received(mk_station_handle_t handle) {
+    if (handle < MK_MAX_ACTIVE_STATIONS && _stations[handle].active) {
+        _stations[handle].info.ts_recv = _stations[handle].info.ts_ping;
+    }
+}
+
+mk_station_handle_t mkstation_save(const char* station_id, uint32_t now) {
+    int len = strnlen(station_id, MK_STATION_ID_MAX_LEN);
+    uint16_t hash = _hash(station_id, len);
+    mk_station_handle_t h = _find(station_id, len, hash);
+    if (h != MK_STATION_NONE) {
+        // Existing station. Update it and move it to the front.
+        _lru_unlink(h);
+        _stations[h].info.ts_ping = now;
+        _lru_push(h);
+        return (h);
+    }
+    // New station.
+    mk_station_info_t info = { now, now, 0 };
+
+    return (_add(station_id, len, hash, &info));
+}
+
+void mkstation_seq_count(mk_station_handle_t handle, int duplicates, int reordered, int lost) {
+    if (handle < MK_MAX_ACTIVE_STATIONS && _stations[handle].active) {
+        uint32_t flags = save_and_disable_interrupts();
+        mutex_enter_blocking(&mkstation_mutex);
+        mk_station_seq_stats_t* seq = &_stations[handle].seq;
+        seq->duplicates += duplicates;
+        seq->reordered += reordered;
+        seq->lost += lost;
+        mutex_exit(&mkstation_mutex);
+        restore_interrupts(flags);
+    }
+}
+
+bool mkstation_seq_stats(mk_station_handle_t handle, mk_station_seq_stats_t* stats) {
+    bool active = false;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkstation_mutex);
+    if (handle < MK_MAX_ACTIVE_STATIONS && _stations[handle].active) {
+        *stats = _stations[handle].seq;
+        active = true;
+    }
+    mutex_exit(&mkstation_mutex);
+    restore_interrupts(flags);
+
+    return (active);
+}
+
+void mkstation_stats(mkstation_stats_t* stats) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&mkstation_mutex);
+    *stats = _stats;
+    stats->count = _count;
+    stats->arena_used = _arena_used;
+    stats->arena_free = MK_STATION_ID_ARENA_SIZE - (_arena_used - _arena_freed);
+    mutex_exit(&mkstation_mutex);
+    restore_interrupts(flags);
+}
+
+int mkstation_wire_restore(uint16_t wire, uint32_t now, uint32_t stale_ms) {
+    _mkstation_wire_cache_t* wc = NULL;
+    for (int i = 0; i < MK_STATION_WIRE_CACHE_WIRES; i++) {
+        if (wire == _wire_cache[i].wire) {
+            wc = &_wire_cache[i];
+            break;
+        }
+    }
+    if (!wc) {
+        return (0);
+    }
+    // Find where each station starts, then add them least recently heard from first (to rebuild the order).
+    uint16_t offsets[MK_MAX_ACTIVE_STATIONS];
+    int n = 0;
+    for (uint16_t off = 0; off < wc->used && n < MK_MAX_ACTIVE_STATIONS; n++) {
+        offsets[n] = off;
+        off += sizeof(mk_station_info_t) + strlen((const char*)&wc->data[off + sizeof(mk_station_info_t)]) + 1;
+    }
+    int restored = 0;
+    while (n-- > 0) {
+        mk_station_info_t info;
+        memcpy(&info, &wc->data[offsets[n]], sizeof(mk_station_info_t));
+        const char* station_id = (const char*)&wc->data[offsets[n] + sizeof(mk_station_info_t)];
+        int len = strlen(station_id);
+        uint16_t hash = _hash(station_id, len);
+        if ((now - info.ts_ping) <= stale_ms && MK_STATION_NONE == _find(station_id, len, hash)) {
+            _add(station_id, len, hash, &info);
+            restored++;
+        }
+    }
+    wc->wire = 0;
+
+    return (restored);
+}
+
+void mkstation_wire_save(uint16_t wire, uint32_t now) {
+    // Use the slot for the wire, or a free one, or the one saved longest ago.
+    _mkstation_wire_cache_t* wc = &_wire_cache[0];
+    for (int i = 0; i < MK_STATION_WIRE_CACHE_WIRES; i++) {
+        _mkstation_wire_cache_t* c = &_wire_cache[i];
+        if (wire == c->wire) {
+            wc = c;
+            break;
+        }
+        if (wc->wire != 0 && (0 == c->wire || (now - c->ts_saved) > (now - wc->ts_saved))) {
+            wc = c;
+        }
+    }
+    wc->wire = wire;
+    wc->ts_saved = now;
+    wc->used = 0;
+    for (mk_station_handle_t h = _lru_head; h != MK_STATION_NONE; h = _stations[h].lru_next) {
+        _mkstation_entry_t* se = &_stations[h];
+        const char* station_id = &_id_arena[se->id_offset];
+        int len = strlen(station_id);
+        if (wc->used + sizeof(mk_station_info_t) + len + 1 > MK_STATION_WIRE_CACHE_SIZE) {
+            break;
+        }
+        memcpy(&wc->data[wc->used], &se->info, sizeof(mk_station_info_t));
+        wc->used += sizeof(mk_station_info_t);
+        memcpy(&wc->data[wc->used], station_id, len + 1);
+        wc->used += len + 1;
+    }
+}
+
+void mkstation_module_init() {
+    assert(!_initialized);
+    _initialized = true;
+
+    memset(&_stats, 0, sizeof(mkstation_stats_t));
+    memset(_wire_cache, 0, sizeof(_wire_cache));
+    mkstation_clear();
+}
@@ -0,0 +1,260 @@
+/**
+ * MorseKOB active station store.
+ *
+ * Compact table of the stations active on the wire. Station IDs are interned
+ * (stored once, variable length) in a fixed arena, and stations are referred
+ * to by small integer handles (in messages and elsewhere) rather than by pointers
+ * into the table. The capacity is set at compile time.
+ *
+ * The table is maintained by the backend (through mkwire). The UI reads station
+ * information using the handles it receives in the station messages.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _MK_STATION_H_
+#define _MK_STATION_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Maximum number of active stations tracked (must be less than 255).
+ * @ingroup wire
+ */
+#ifndef MK_MAX_ACTIVE_STATIONS
+#define MK_MAX_ACTIVE_STATIONS 100
+#endif
+
+/**
+ * @brief Size of the arena that holds the station IDs.
+ * @ingroup wire
+ *
+ * Each ID uses its length plus two bytes. MorseKOB station IDs ("call, city, ST",
+ * often with a version) are typically 20 to 35 characters, so this allows 32 bytes
+ * per station. If the arena fills, the least recently heard from stations are
+ * dropped to make room.
+ *
+ * With the defaults the store uses about 6.6KB: 32 bytes of table and 32 bytes of
+ * arena per station (for 100 stations), and a 256 byte index.
+ */
+#ifndef MK_STATION_ID_ARENA_SIZE
+#define MK_STATION_ID_ARENA_SIZE (MK_MAX_ACTIVE_STATIONS * 32)
+#endif
+
+#define MK_STATION_ID_MAX_LEN 127
+
+/**
+ * @brief Number of wires whose stations are kept when switching wires.
+ * @ingroup wire
+ */
+#ifndef MK_STATION_WIRE_CACHE_WIRES
+#define MK_STATION_WIRE_CACHE_WIRES 3
+#endif
+
+/**
+ * @brief Bytes of station information kept for each wire when switching wires.
+ * @ingroup wire
+ *
+ * Each station uses its ID length plus 13 bytes. The most recently heard from
+ * stations that fit are kept.
+ */
+#ifndef MK_STATION_WIRE_CACHE_SIZE
+#define MK_STATION_WIRE_CACHE_SIZE 512
+#endif
+
+/**
+ * @brief Handle for an active station.
+ * @ingroup wire
+ *
+ * A handle stays the same as long as the station remains active. After a station
+ * expires its handle can be reused for a different station.
+ */
+typedef uint8_t mk_station_handle_t;
+#define MK_STATION_NONE ((mk_station_handle_t)0xFF)
+
+/**
+ * @brief Information about an active MorseKOB station.
+ * @ingroup wire
+ *
+ * @param ts_init millisecond timestamp when the station first connected
+ * @param ts_ping millisecond timestamp of the last ping from this station
+ * @param ts_recv millisecond timestamp of the last receipt from this station
+ */
+typedef struct _station_info_ {
+    uint32_t ts_init;
+    uint32_t ts_ping;
+    uint32_t ts_recv;
+} mk_station_info_t;
+
+/**
+ * @brief Code sequence counts for an active station.
+ * @ingroup wire
+ *
+ * These are kept while the station is active (they aren't kept when switching wires).
+ *
+ * @param duplicates code packets received more than once
+ * @param reordered code packets received out of order (and still played in order)
+ * @param lost code packets never received (or received too late to be played)
+ */
+typedef struct _station_seq_stats_ {
+    uint32_t duplicates;
+    uint32_t reordered;
+    uint32_t lost;
+} mk_station_seq_stats_t;
+
+/**
+ * @brief Station store statistics.
+ * @ingroup wire
+ */
+typedef struct _MKSTATION_STATS_ {
+    int count;                  // Active stations
+    int arena_used;             // Bytes of the ID arena in use (including freed, not yet compacted)
+    int arena_free;             // Bytes of the ID arena free after compaction
+    uint32_t compactions;       // Times the ID arena was compacted
+    uint32_t evictions;         // Stations dropped (before going stale) to make room
+} mkstation_stats_t;
+
+/**
+ * @brief Remove all of the stations.
+ * @ingroup wire
+ *
+ * This doesn't post any messages.
+ */
+extern void mkstation_clear();
+
+/**
+ * @brief Remove the stations that haven't been heard from in a given time.
+ * @ingroup wire
+ *
+ * A MSG_WIRE_STATION_EXPIRED message is posted to the UI for each station removed.
+ *
+ * @param now The current millisecond time.
+ * @param stale_ms The time since a station was heard from for it to be removed.
+ */
+extern void mkstation_expire(uint32_t now, uint32_t stale_ms);
+
+/**
+ * @brief Find an active station.
+ * @ingroup wire
+ *
+ * @param station_id The station ID.
+ * @return The handle of the station, or MK_STATION_NONE if it isn't active.
+ */
+extern mk_station_handle_t mkstation_find(const char* station_id);
+
+/**
+ * @brief Copy a station's ID.
+ * @ingroup wire
+ *
+ * @param handle The station handle.
+ * @param buf The buffer to copy the ID into.
+ * @param maxlen The maximum number of characters to copy (the buffer must be 1 larger).
+ * @return The length of the ID copied (0 if the handle isn't an active station).
+ */
+extern int mkstation_id(mk_station_handle_t handle, char* buf, int maxlen);
+
+/**
+ * @brief Get information about a station.
+ * @ingroup wire
+ *
+ * @param handle The station handle.
+ * @param info Structure to fill in.
+ * @return true if the handle is an active station.
+ */
+extern bool mkstation_info(mk_station_handle_t handle, mk_station_info_t* info);
+
+/**
+ * @brief Indicate that code was received from a station (update its receive time).
+ * @ingroup wire
+ *
+ * @param handle The station handle.
+ */
+extern void mkstation_received(mk_station_handle_t handle);
+
+/**
+ * @brief Save (add or update the ping time of) an active station.
+ * @ingroup wire
+ *
+ * If the station is new a MSG_WIRE_STATION_ADDED message is posted to the UI. If the
+ * store is full the least recently heard from station is dropped to make room
+ * (and a MSG_WIRE_STATION_EXPIRED message is posted for it). The dropped station's
+ * handle can be the one returned for the new station, so a handle kept for another
+ * station needs to be checked after a new station is saved.
+ *
+ * @param station_id The station ID.
+ * @param now The current millisecond time.
+ * @return The handle of the station.
+ */
+extern mk_station_handle_t mkstation_save(const char* station_id, uint32_t now);
+
+/**
+ * @brief Add to the code sequence counts of a station.
+ * @ingroup wire
+ *
+ * @param handle The station handle (nothing is done if it isn't an active station).
+ * @param duplicates Number of duplicates to add.
+ * @param reordered Number of out of order sequences to add.
+ * @param lost Number of lost sequences to add.
+ */
+extern void mkstation_seq_count(mk_station_handle_t handle, int duplicates, int reordered, int lost);
+
+/**
+ * @brief Get the code sequence counts of a station.
+ * @ingroup wire
+ *
+ * @param handle The station handle.
+ * @param stats Structure to fill in.
+ * @return true if the handle is an active station.
+ */
+extern bool mkstation_seq_stats(mk_station_handle_t handle, mk_station_seq_stats_t* stats);
+
+/**
+ * @brief Get the station store statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void mkstation_stats(mkstation_stats_t* stats);
+
+/**
+ * @brief Restore the stations saved for a wire (by `mkstation_wire_save`).
+ * @ingroup wire
+ *
+ * The stations that haven't gone stale are added (with their saved times), and a
+ * MSG_WIRE_STATION_ADDED message is posted to the UI for each one. This is meant
+ * to be used after the store has been cleared.
+ *
+ * @param wire The wire number.
+ * @param now The current millisecond time.
+ * @param stale_ms The time since a station was heard from for it to be stale.
+ * @return The number of stations restored.
+ */
+extern int mkstation_wire_restore(uint16_t wire, uint32_t now, uint32_t stale_ms);
+
+/**
+ * @brief Save the current stations for a wire, so they can be restored when switching back to it.
+ * @ingroup wire
+ *
+ * This replaces anything saved for the wire before. If all of the wire slots are in use,
+ * the one saved longest ago is replaced.
+ *
+ * @param wire The wire number.
+ * @param now The current millisecond time.
+ */
+extern void mkstation_wire_save(uint16_t wire, uint32_t now);
+
+/**
+ * @brief Initialize the station store module.
+ * @ingroup wire
+ */
+extern void mkstation_module_init();
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _MK_STATION_H_
@@ -12,19 +12,23 @@
 
 #include "config.h"
 #include "cmt.h"
+#include "jbuf.h"
 #include "mkboard.h"
+#include "mkcap.h"
+#include "mkmonitor.h"
 #include "mks.h"
+#include "mkspkt.h"
 #include "morse.h"
 #include "net.h"
 #include "util.h"
 
+#include "hardware/sync.h"
+#include "pico/cyw43_arch.h"
+
 #define _MK_STATION_STALE_TIME (50 * 1000)
-/** Static storage for the current sender - to avoid malloc during message receipt. */
-static mk_station_id_t _current_sender;
-/** Static storage for active stations - to avoid malloc during message receipt. */
-static mk_station_id_t _stations_heap[MK_MAX_ACTIVE_STATIONS];
-/** Pointers to active stations with a terminating null entry */
-static mk_station_id_t* _stations_list[MK_MAX_ACTIVE_STATIONS + 1];
+
+/** The station (handle) that code was last received from. */
+static mk_station_handle_t _current_sender = MK_STATION_NONE;
 
 static const char* _mks_commands[6] = {
     "*UNDEFINED*",
@@ -36,127 +40,123 @@ static const char* _mks_commands[6] = {
 };
 #define MAX_VALID_CMD 5
 
-/**
- * @brief shortPacketFormat
- * @ingroup wire
- *
- * ("<hh")  # cmd, wire
- */
-typedef struct mkspkt_cmd_wire {
-    int16_t cmd;        // h (2)
-    int16_t wire;       // h (2)
-} mkspkt_cmd_wire_t;
-// Cmd+Wire Packet Member offsets:
-#define MKSPKT_CW_OFFSET_CMD 0
-#define MKSPKT_CW_OFFSET_WIRE 2
-
-/**
- * @brief idPacketFormat
- * @ingroup wire
- *
- * ("<hh 128s 4x i i 8x 208x 128s 8x")  # cmd, byts, id, seq, idflag, ver
- */
-typedef struct mkspkt_id {
-    int16_t cmd;                                // h (2)
-    int16_t bytes;                              // h (2) = size from `id` to the end (492)
-    char id[MKS_PKT_MAX_STRING_LEN + 1];        // 128s
-    uint8_t pad1[4];                            // 4x
-    int32_t seqno;                              // i (4)
-    int32_t idflag;                             // i (4)
-    uint8_t pad2[8];                            // 8x
-    uint8_t pad3[208];                          // 208x
-    char version[MKS_PKT_MAX_STRING_LEN + 1];   // 128s
-    uint8_t pad4[8];                            // 8x
-    //                                          ==========
-    //                                           496 bytes
-} mkspkt_id_t;
-// ID Packet Member offsets:
-#define MKSPKT_ID_OFFSET_CMD 0
-#define MKSPKT_ID_OFFSET_BYTES 2
-#define MKSPKT_ID_OFFSET_ID 4
-#define MKSPKT_ID_OFFSET_PAD1 132
-#define MKSPKT_ID_OFFSET_SEQNO 136
-#define MKSPKT_ID_OFFSET_IDFLAG 140
-#define MKSPKT_ID_OFFSET_PAD2 144
-#define MKSPKT_ID_OFFSET_PAD3 152
-#define MKSPKT_ID_OFFSET_VERSION 360
-#define MKSPKT_ID_OFFSET_PAD4 488
-#define MKSPKT_ID_LEN 496
-
-/**
- * @brief codePacketFormat
- * @ingroup wire
- *
- * ("<hh 128s 4x i 12x 51i i 128s 8x")  # cmd, byts, id, seq, code list, n, txt
- */
-typedef struct mkspkt_code {
-    int16_t cmd;                                // h (2)
-    int16_t bytes;                              // h (2) = size from `id` to the end (492)
-    char id[MKS_PKT_MAX_STRING_LEN + 1];        // 128s
-    uint8_t pad1[4];                            // 4x
-    int32_t seqno;                              // i (4)
-    uint8_t pad2[12];                           // 12x
-    int32_t code_list[MKS_PKT_MAX_CODE_LEN];    // 51i (204)
-    int32_t n;                                  // i (4)
-    char text[MKS_PKT_MAX_STRING_LEN + 1];      // 128s
-    uint8_t pad3[8];                            // 8x
-    //                                          ==========
-    //                                           496 bytes
-} mkspkt_code_t;
-// Code Packet Member offsets:
-#define MKSPKT_CODE_OFFSET_CMD 0
-#define MKSPKT_CODE_OFFSET_BYTES 2
-#define MKSPKT_CODE_OFFSET_ID 4
-#define MKSPKT_CODE_OFFSET_PAD1 132
-#define MKSPKT_CODE_OFFSET_SEQNO 136
-#define MKSPKT_CODE_OFFSET_PAD2 140
-#define MKSPKT_CODE_OFFSET_CODE_LIST 152
-#define MKSPKT_CODE_OFFSET_N 356
-#define MKSPKT_CODE_OFFSET_TEXT 360
-#define MKSPKT_CODE_OFFSET_PAD3 488
-#define MKSPKT_CODE_LEN 496
-
 
 // *** Local function declarations...
 
 void _bind_handler(err_enum_t status, struct udp_pcb* udp_pcb);
 static void _clear_stations();
-static pbuf_t* _connect_req_builder();
-static pbuf_t* _disconnect_req_builder();
-static bool _keep_alive_timer_callback(repeating_timer_t* rt);
+static void _link_down();
 static void _mks_recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_addr_t* addr, u16_t port);
-static mk_station_id_t* _save_active_station(const char* station_id);
-static mk_station_id_t* _save_current_sender(const char* station_id);
+static void _mks_recv_data(const uint8_t* pkt, uint16_t len, uint32_t ts_arrival);
+static void _mks_recv_process(pbuf_t* p, uint64_t ts_us);
+static void _mks_send(pbuf_t* p);
+static void _pack_code_packet(mkspkt_code_t* code_pkt, const char* station_id, int32_t seqno, const code_element_t code[], int n);
+static void _pack_id_packet(mkspkt_id_t* id_pkt, int32_t seqno);
+static void _recv_ring_flush();
+static void _stations_expire(uint32_t now);
+static void _send_connect();
 static void _send_id();
-static void _send_id_2();
-static pbuf_t* _send_id_req_builder();
-static void _unpack_code_packet(mkspkt_code_t* code_pkt, const pbuf_t* p);
-static void _unpack_id_packet(mkspkt_id_t* id_pkt, const pbuf_t* p);
 static void _wire_connect();
+static void _wire_switch(uint16_t wire_no);
 
+static cmt_msg_t _msg_ack_timeout = { MSG_MKS_ACK_TIMEOUT };
+static cmt_msg_t _msg_code_playout = { MSG_WIRE_CODE_PLAYOUT };
 static cmt_msg_t _msg_current_sender = { MSG_WIRE_CURRENT_SENDER };
 static cmt_msg_t _msg_connect_state = { MSG_WIRE_CONNECTED_STATE };
 static cmt_msg_t _msg_keep_alive_send = { MSG_MKS_KEEP_ALIVE_SEND };
+static cmt_msg_t _msg_packet_received = { MSG_MKS_PACKET_RECEIVED };
 static cmt_msg_t _msg_wire_changed = { MSG_WIRE_CHANGED };
 
 static bool _initialized = false;
 static char _mkserver_host[NET_URL_MAX_LEN + 1];
 static uint16_t _mkserver_port = 0;
 static char _office_id[MKOBSERVER_STATION_ID_MAX_LEN + 1];
-static int32_t _seqno_recv = -1;
 static int32_t _seqno_send = 0;
 static uint16_t _wire_no = 1;
 
-static repeating_timer_t _keep_alive_timer;
-static volatile bool _send_keep_alive = false;
+/** Static storage for a received packet that isn't contiguous - to avoid malloc during message receipt. */
+static uint8_t _pkt_buf[MKSPKT_CODE_LEN];
+
+/**
+ * @brief Received packet waiting to be processed.
+ * @ingroup wire
+ */
+typedef struct _RECV_RING_ENTRY_ {
+    pbuf_t* p;
+    uint64_t ts_us;
+} _recv_ring_entry_t;
+#define _RECV_RING_SIZE 8 // Must be a power of 2
+/**
+ * Packets received (by the IRQ handler) waiting to be processed by the backend.
+ * Single producer (`_mks_recv`), single consumer (`mkwire_recv_process`), so no lock is needed.
+ */
+static _recv_ring_entry_t _recv_ring[_RECV_RING_SIZE];
+static volatile uint32_t _recv_ring_head = 0;  // Only changed by the IRQ handler
+static volatile uint32_t _recv_ring_tail = 0;  // Only changed by the backend
+static mkwire_recv_stats_t _recv_stats;
+static uint64_t _recv_irq_us_total = 0;
+static uint64_t _recv_proc_us_total = 0;
 
 static struct udp_pcb* _udp_pcb = NULL;
 static wire_connected_state_t _connected_state = WIRE_NOT_CONNECTED;
-static void (*_next_fn)(void) = NULL;
+static wire_link_state_t _link_state = WIRE_LINK_DOWN;
+static int _ack_retries = 0;            // Times the current CONNECT has been sent again
+static uint32_t _ts_connect_sent;       // When the current CONNECT was sent (for the RTT)
+static mkwire_link_stats_t _link_stats;
+static bool _wire_switching = false;    // Data for the previous wire is ignored until the new wire is ACK'ed
 
 
-const mk_station_id_t** mkwire_active_stations() {
-    return ((const mk_station_id_t **)_stations_list);
+void mkwire_ack_timeout() {
+    if (WIRE_LINK_ACK_WAIT != _link_state || !_udp_pcb) {
+        return;
+    }
+    _link_stats.ack_timeouts++;
+    if (_ack_retries < MKWIRE_ACK_RETRIES_MAX) {
+        _ack_retries++;
+        _send_connect();
+    }
+    else {
+        error_printf(false, "MKWire - No response from the server. Disconnecting.\n");
+        _link_stats.link_lost++;
+        mkwire_disconnect();
+    }
+}
+
+void mkwire_code_playout() {
+    int32_t wait_ms;
+    mcode_seq_t* mcode_seq;
+
+    scheduled_msg_cancel(MSG_WIRE_CODE_PLAYOUT);
+    while ((mcode_seq = jbuf_take(now_ms(), &wait_ms)) != NULL) {
+        // Post it to the backend to sound and decode
+        cmt_msg_t msg_send;
+        msg_send.id = MSG_MORSE_CODE_SEQUENCE;
+        msg_send.data.mcode_seq = mcode_seq;
+        // Don't wait. If the queue is full we just lose this one.
+        if (!postBEMsgNoWait(&msg_send)) {
+            mcode_seq_free(mcode_seq); // Free the sequence if we couldn't post it.
+        }
+    }
+    if (wait_ms > 0) {
+        // Come back when the next one is due.
+        schedule_msg_in_ms(wait_ms, &_msg_code_playout);
+    }
+}
+
+pbuf_t* mkwire_code_req(const char* station_id, int32_t seqno, const code_element_t* code, int n) {
+    mkspkt_code_t code_packet;
+    _pack_code_packet(&code_packet, station_id, seqno, code, n);
+    size_t msg_len = sizeof(mkspkt_code_t);
+    cyw43_arch_lwip_begin();
+    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(mkspkt_code_t), PBUF_POOL);
+    cyw43_arch_lwip_end();
+    if (!p) {
+        return (NULL);
+    }
+    uint8_t* req = (uint8_t*)p->payload;
+    memcpy(req, &code_packet, msg_len);
+
+    return (p);
 }
 
 void mkwire_connect(unsigned short wire_no) {
@@ -167,6 +167,21 @@ void mkwire_connect(unsigned short wire_no) {
     _wire_connect();
 }
 
+pbuf_t* mkwire_connect_req(uint16_t wire_no) {
+    mkspkt_cmd_wire_t connect_packet = { MKS_CMD_CONNECT, (int16_t)wire_no };
+    size_t msg_len = sizeof(mkspkt_cmd_wire_t);
+    cyw43_arch_lwip_begin();
+    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(mkspkt_cmd_wire_t), PBUF_POOL);
+    cyw43_arch_lwip_end();
+    if (!p) {
+        return (NULL);
+    }
+    uint8_t* req = (uint8_t*)p->payload;
+    memcpy(req, &connect_packet, msg_len);
+
+    return (p);
+}
+
 void mkwire_connect_toggle() {
     if (mkwire_is_connected()) {
         mkwire_disconnect();
@@ -180,33 +195,138 @@ wire_connected_state_t mkwire_connected_state() {
     return (_connected_state);
 }
 
-const char* mkwire_current_sender() {
-    return _current_sender.id;
+mk_station_handle_t mkwire_current_sender() {
+    return (_current_sender);
+}
+
+int mkwire_data_parse(const uint8_t* pkt, uint16_t len, char* station_id, int32_t* seqno, code_element_t* code) {
+    int n = mkspkt_data_parse(pkt, len, station_id, seqno, code);
+    if (n < 0) {
+        if (len < MKSPKT_CODE_OFFSET_TEXT) {
+            error_printf(false, "MKWIRE - Data packet too short: %hu\n", len);
+        }
+        else {
+            error_printf(false, "MKWIRE - Invalid data packet. Len: %hu Bytes: %hd N: %d\n", len,
+                mkspkt_i16(pkt, MKSPKT_CODE_OFFSET_BYTES), mkspkt_i32(pkt, MKSPKT_CODE_OFFSET_N));
+        }
+    }
+    return (n);
 }
 
 void mkwire_disconnect() {
     if (_udp_pcb) {
         // Send a disconnect message and free up the UDP connection.
-        pbuf_t* p = _disconnect_req_builder();
-        udp_send(_udp_pcb, p);
-        pbuf_free(p);
+        _mks_send(mkwire_disconnect_req());
         udp_remove(_udp_pcb);
         _udp_pcb = NULL;
         _connected_state = WIRE_NOT_CONNECTED;
     }
-    _send_keep_alive = false;
+    _link_down();
+    udp_socket_bind_cancel();
+    mkmonitor_disconnect();
+    _wire_switching = false;
+    _recv_ring_flush();
     _clear_stations();
     // Post a message to the UI letting it know we are disconnected
     _msg_connect_state.data.status = _connected_state;
     postUIMsgBlocking(&_msg_connect_state);
 }
 
+pbuf_t* mkwire_disconnect_req() {
+    mkspkt_cmd_wire_t disconnect_packet = { MKS_CMD_DISCONNECT, 0 };
+    size_t msg_len = sizeof(mkspkt_cmd_wire_t);
+    cyw43_arch_lwip_begin();
+    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(mkspkt_cmd_wire_t), PBUF_POOL);
+    cyw43_arch_lwip_end();
+    if (!p) {
+        return (NULL);
+    }
+    uint8_t* req = (uint8_t*)p->payload;
+    memcpy(req, &disconnect_packet, msg_len);
+
+    return (p);
+}
+
+pbuf_t* mkwire_id_req(int32_t seqno) {
+    mkspkt_id_t id_packet;
+    _pack_id_packet(&id_packet, seqno);
+    size_t msg_len = sizeof(mkspkt_id_t);
+    cyw43_arch_lwip_begin();
+    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(mkspkt_id_t), PBUF_POOL);
+    cyw43_arch_lwip_end();
+    if (!p) {
+        return (NULL);
+    }
+    uint8_t* req = (uint8_t*)p->payload;
+    memcpy(req, &id_packet, msg_len);
+
+    return (p);
+}
+
 bool mkwire_is_connected() {
     return (WIRE_CONNECTED == _connected_state);
 }
 
 void mkwire_keep_alive_send() {
-    _send_id();
+    scheduled_msg_cancel(MSG_MKS_KEEP_ALIVE_SEND);
+    if (!_udp_pcb) {
+        return;
+    }
+    if (WIRE_LINK_ACK_WAIT != _link_state) {
+        // (If still waiting for an ACK, the timeout will take care of it.)
+        _ack_retries = 0;
+        _send_connect();
+    }
+    // Also a good time to drop stations we haven't heard from in a while.
+    _stations_expire(now_ms());
+    mkmonitor_keep_alive_send();
+    // Come back for the next one.
+    schedule_msg_in_ms(MKS_KEEP_ALIVE_TIME, &_msg_keep_alive_send);
+}
+
+void mkwire_link_stats(mkwire_link_stats_t* stats) {
+    memcpy(stats, &_link_stats, sizeof(mkwire_link_stats_t));
+    stats->state = _link_state;
+}
+
+void mkwire_recv_process() {
+    while (_recv_ring_tail != _recv_ring_head) {
+        uint32_t tail = _recv_ring_tail;
+        __mem_fence_acquire();
+        _recv_ring_entry_t* entry = &_recv_ring[tail & (_RECV_RING_SIZE - 1)];
+        pbuf_t* p = entry->p;
+        uint64_t ts_us = entry->ts_us;
+        _recv_ring_tail = tail + 1;
+        uint64_t t_start = now_us();
+        _mks_recv_process(p, ts_us);
+        uint32_t t = (uint32_t)(now_us() - t_start);
+        _recv_stats.processed++;
+        _recv_proc_us_total += t;
+        if (t > _recv_stats.proc_us_max) {
+            _recv_stats.proc_us_max = t;
+        }
+    }
+}
+
+void mkwire_recv_inject(pbuf_t* p) {
+    if (!p) {
+        return;
+    }
+    // As if it came from lwIP (the receive callback is called with the lwIP lock held)
+    cyw43_arch_lwip_begin();
+    if (!_udp_pcb) {
+        _mks_recv(NULL, NULL, p, NULL, 0);
+    }
+    else {
+        pbuf_free(p);
+    }
+    cyw43_arch_lwip_end();
+}
+
+void mkwire_recv_stats(mkwire_recv_stats_t* stats) {
+    memcpy(stats, &_recv_stats, sizeof(mkwire_recv_stats_t));
+    stats->irq_us_avg = (_recv_stats.packets ? (uint32_t)(_recv_irq_us_total / _recv_stats.packets) : 0);
+    stats->proc_us_avg = (_recv_stats.processed ? (uint32_t)(_recv_proc_us_total / _recv_stats.processed) : 0);
 }
 
 void mkwire_set_office_id(char* office_id) {
@@ -219,14 +339,17 @@ uint16_t mkwire_wire_get() {
 
 void mkwire_wire_set(uint16_t wire_no) {
     if (wire_no > 0 && wire_no < 1000) {
-        _wire_no = wire_no;
         config_t* cfg = config_current_for_modification();
         cfg->wire = wire_no;
-        // If we are currently connected, disconnect and re-connect with the new wire.
-        if (mkwire_is_connected()) {
-            mkwire_disconnect();
-            _wire_connect();
+        // If we are currently connected, switch to the new wire (using the same connection).
+        if (wire_no != _wire_no) {
+            // If the new wire is being monitored, monitor the one being left instead.
+            mkmonitor_wire_swap(wire_no, _wire_no);
+        }
+        if (mkwire_is_connected() && wire_no != _wire_no) {
+            _wire_switch(wire_no);
         }
+        _wire_no = wire_no;
         _msg_wire_changed.data.wire = wire_no;
         postUIMsgBlocking(&_msg_wire_changed);
         config_indicate_changed();
@@ -236,13 +359,17 @@ void mkwire_wire_set(uint16_t wire_no) {
 void mkwire_module_init(char* mkobs_url, uint16_t port, char* office_id, uint16_t wire_no) {
     assert(!_initialized);
     _initialized = true;
-    bool success = add_repeating_timer_ms(MKS_KEEP_ALIVE_TIME, _keep_alive_timer_callback, NULL, &_keep_alive_timer);
-    if (!success) {
-        error_printf(false, "MKWire - Could not create repeating timer for keep alive.\n");
-    }
+    jbuf_module_init();
+    mkstation_module_init();
+    mkmonitor_module_init();
+    mkcap_module_init();
+    memset(&_link_stats, 0, sizeof(mkwire_link_stats_t));
+    _link_stats.rtt_ms = -1;
 
     strcpynt(_mkserver_host, mkobs_url, NET_URL_MAX_LEN);
     _mkserver_port = port;
+    // Resolve the server address now, so connecting doesn't have to wait for it.
+    net_dns_prefetch(_mkserver_host);
     mkwire_set_office_id(office_id);
     mkwire_wire_set(wire_no);
 }
@@ -263,8 +390,10 @@ void _bind_handler(err_enum_t status, struct udp_pcb* udp_pcb) {
         _clear_stations();
         // Set up to receive incoming messages from the MKServer.
         udp_recv(_udp_pcb, _mks_recv, NULL);  // Can pass user-data in 3rd arg if needed
-        // Post message to send our ID
+        // Post message to send our ID (this starts the keep alive)
         postBEMsgNoWait(&_msg_keep_alive_send);
+        // Connect the monitored wires (they use their own sockets)
+        mkmonitor_connect(_mkserver_host, _mkserver_port);
         // Post a message to the UI letting it know we are connected
         _msg_connect_state.data.status = _connected_state;
         postUIMsgBlocking(&_msg_connect_state);
@@ -272,26 +401,17 @@ void _bind_handler(err_enum_t status, struct udp_pcb* udp_pcb) {
 }
 
 /**
- * @brief Clear all of the stations and post a message with the cleared list.
+ * @brief Clear all of the stations and post a message indicating that they are cleared.
  * @ingroup wire
  */
 static void _clear_stations() {
-    for (int i = 0; i < MK_MAX_ACTIVE_STATIONS; i++) {
-        mk_station_id_t *stn = &_stations_heap[i];
-        stn->ts_init = 0;
-        stn->ts_ping = 0;
-        stn->ts_recv = 0;
-        *stn->id = '\000';
-        _stations_list[i] = (mk_station_id_t*)0;
-    }
-    _stations_list[MK_MAX_ACTIVE_STATIONS] = (mk_station_id_t*)0; // NULL to terminate list
+    mkstation_clear();
+    // Drop any code waiting to be played
+    jbuf_clear();
     // Clear current sender
-    *_current_sender.id = '\000';
-    _current_sender.ts_init = 0;
-    _current_sender.ts_ping = 0;
-    _current_sender.ts_recv = 0;
+    _current_sender = MK_STATION_NONE;
     // Post messages
-    _msg_current_sender.data.station_id = _current_sender.id;
+    _msg_current_sender.data.station = _current_sender;
     postUIMsgBlocking(&_msg_current_sender);
     cmt_msg_t msg_send;
     msg_send.id = MSG_WIRE_STATIONS_CLEARED;
@@ -299,19 +419,48 @@ static void _clear_stations() {
 }
 
 /**
- * @brief Repeating alarm callback handler.
- * Handles events from the repeating timer. If we are connected, post a message to send our ID.
- *
- * @see repeating_timer_callback_t
+ * @brief Handle an ACK from the server.
+ * @ingroup wire
  *
- * \param rt repeating time structure containing information about the repeating time. (not used)
- * \return true to continue repeating, false to stop.
+ * If it is the ACK for the CONNECT that was sent, the round trip time is
+ * measured (unless the CONNECT was sent more than once) and the ID is sent.
+ * Other ACKs (a late one for a CONNECT that was sent again) are ignored.
  */
-static bool _keep_alive_timer_callback(repeating_timer_t* rt) {
-    if (_send_keep_alive) {
-        postBEMsgNoWait(&_msg_keep_alive_send);
+static void _ack_received() {
+    if (WIRE_LINK_ACK_WAIT != _link_state) {
+        return;
+    }
+    scheduled_msg_cancel(MSG_MKS_ACK_TIMEOUT);
+    _link_stats.acks++;
+    if (0 == _ack_retries) {
+        int32_t rtt = (int32_t)(now_ms() - _ts_connect_sent);
+        if (_link_stats.rtt_ms < 0) {
+            _link_stats.rtt_ms_avg = rtt;
+            _link_stats.rtt_ms_min = rtt;
+            _link_stats.rtt_ms_max = rtt;
+        }
+        else {
+            // Smoothed the same way as TCP (1/8 of the new sample)
+            _link_stats.rtt_ms_avg += (rtt - _link_stats.rtt_ms_avg) / 8;
+            _link_stats.rtt_ms_min = (rtt < _link_stats.rtt_ms_min ? rtt : _link_stats.rtt_ms_min);
+            _link_stats.rtt_ms_max = (rtt > _link_stats.rtt_ms_max ? rtt : _link_stats.rtt_ms_max);
+        }
+        _link_stats.rtt_ms = rtt;
     }
-    return (true); // Repeat forever
+    _ack_retries = 0;
+    _link_state = WIRE_LINK_UP;
+    _send_id();
+}
+
+/**
+ * @brief Stop waiting for ACKs and sending keep alives.
+ * @ingroup wire
+ */
+static void _link_down() {
+    scheduled_msg_cancel(MSG_MKS_ACK_TIMEOUT);
+    scheduled_msg_cancel(MSG_MKS_KEEP_ALIVE_SEND);
+    _link_state = WIRE_LINK_DOWN;
+    _ack_retries = 0;
 }
 
 /**
@@ -321,18 +470,23 @@ static bool _keep_alive_timer_callback(repeating_timer_t* rt) {
  * PyKOB: codePacketFormat.pack(DAT, 492, self.officeID.encode('latin-1'), self.sentSeqNo, *codeBuf)
  *
  * @param code_pkt The Code Packet stucture to set values into
+ * @param station_id The station ID
+ * @param seqno The sequence number
  * @param code Array of int code values
  * @param n Number of code values
  */
-static void _pack_code_packet(mkspkt_code_t* code_pkt, int32_t code[], int n) {
+static void _pack_code_packet(mkspkt_code_t* code_pkt, const char* station_id, int32_t seqno, const code_element_t code[], int n) {
     // start with all zeros
-    memset(code_pkt, 0x00, sizeof(mkspkt_id_t));
+    memset(code_pkt, 0x00, sizeof(mkspkt_code_t));
     code_pkt->cmd = MKS_CMD_DATA;
     code_pkt->bytes = MKS_CODE_PKT_SIZE;
-    strcpynt(code_pkt->id, _office_id, MKS_PKT_MAX_STRING_LEN);
-    code_pkt->seqno = _seqno_send;
+    strcpynt(code_pkt->id, station_id, MKS_PKT_MAX_STRING_LEN);
+    code_pkt->seqno = seqno;
     code_pkt->n = n;
-    memcpy(code_pkt->code_list, code, sizeof(int32_t) * n);
+    if (n > 0) {
+        // (an ID is sent with no code list)
+        memcpy(code_pkt->code_list, code, sizeof(int32_t) * n);
+    }
 }
 
 /**
@@ -342,151 +496,30 @@ static void _pack_code_packet(mkspkt_code_t* code_pkt, int32_t code[], int n) {
  * PyKOB: idPacketFormat.pack(DAT, 492, self.officeID.encode('latin-1'), self.sentSeqNo, 1, self.version)
  *
  * @param id_pkt The ID Packet structure to set values into
+ * @param seqno The sequence number
  */
-static void _pack_id_packet(mkspkt_id_t *id_pkt) {
+static void _pack_id_packet(mkspkt_id_t *id_pkt, int32_t seqno) {
     // start with all zeros
     memset(id_pkt, 0x00, sizeof(mkspkt_id_t));
     id_pkt->cmd = MKS_CMD_DATA;
     id_pkt->bytes = MKS_ID_PKT_SIZE;
     strcpynt(id_pkt->id, _office_id, MKS_PKT_MAX_STRING_LEN);
-    id_pkt->seqno = _seqno_send;
+    id_pkt->seqno = seqno;
     id_pkt->idflag = MKS_ID_FLAG;
     strcpynt(id_pkt->version, MuKOB_VERSION_INFO, MKS_PKT_MAX_STRING_LEN);
 }
 
-static mk_station_id_t* _save_active_station(const char* station_id) {
-    mk_station_id_t* station = NULL;
-    mk_station_id_t* oldest_station = &_stations_heap[0];
-    uint32_t now = now_ms();
-    // Try to find an existing entry for it...
-    for (int i = 0; i < MK_MAX_ACTIVE_STATIONS; i++) {
-        mk_station_id_t* stn = &_stations_heap[i];
-        // update oldest
-        if (stn->ts_ping < oldest_station->ts_ping) {
-            oldest_station = stn;
-        }
-        if (strcmp(stn->id, station_id) == 0) {
-            // Found it
-            station = stn;
-            break;
-        }
-    }
-    if (!station) {
-        // Didn't find it. Replace the oldest entry.
-        station = oldest_station;
-        station->ts_init = now;
-        strcpynt(station->id, station_id, MKOBSERVER_STATION_ID_MAX_LEN);
-    }
-    station->ts_ping = now;
-    // Prune old stations and update the list of active stations
-    int li = 0;
-    for (int i = 0; i < MK_MAX_ACTIVE_STATIONS; i++) {
-        mk_station_id_t* stn = &_stations_heap[i];
-        if (now - stn->ts_ping > _MK_STATION_STALE_TIME) {
-            stn->ts_init = 0;
-            stn->ts_ping = 0;
-            stn->ts_recv = 0;
-            *stn->id = '\000';
-        }
-        if (stn->ts_ping > 0) {
-            *(_stations_list + li) = stn;
-            li++;
-        }
-    }
-    *(_stations_list + li) = (mk_station_id_t*)0; // NULL to terminate list
-
-    return (station);
-}
-
-static mk_station_id_t* _save_current_sender(const char* station_id) {
-    // First, save/update it as an active station.
-    mk_station_id_t* station = _save_active_station(station_id);
-    // Now make it the current sender.
-    strcpy(_current_sender.id, station->id);
-    station->ts_recv = station->ts_ping; // Update the station's receive ts
-    _current_sender.ts_init = station->ts_init;
-    _current_sender.ts_ping = station->ts_ping;
-    _current_sender.ts_recv = station->ts_recv;
-
-    return &_current_sender;
-}
-
 /**
- * @brief Unpack a received Code message into an mkspkt_code structure (Code Packet)
+ * @brief Remove the stations that we haven't heard from in the stale time.
  * @ingroup wire
- *
- * PyKOB: cp = .unpack(buf)codePacketFormat
- *        cmd, byts, stnID, seqNo, code = cp[0], cp[1], cp[2], cp[3], cp[4:]
- *        stnID, sep, fill = stnID.decode(encoding='latin-1').partition(NUL)
- *        n = code[51]
- * ("<hh 128s 4x i 12x 51i i 128s 8x")  # cmd, byts, id, seq, code list, n, txt
- *
- * @param code_pkt The Code Packet structure to set with data (the pads are ignored (not filled))
- * @param p The PBUF received from the MorseKOB Server (caller to assure it's not NULL)
- *          The caller is responsible for freeing it (they might have more they want to do with it)
  */
-static void _unpack_code_packet(mkspkt_code_t* code_pkt, const pbuf_t* p) {
-    memset(code_pkt, 0, sizeof(mkspkt_code_t));
-    pbuf_copy_partial(p, &code_pkt->cmd, sizeof(member_size(mkspkt_code_t, cmd)), MKSPKT_CODE_OFFSET_CMD);
-    pbuf_copy_partial(p, &code_pkt->bytes, sizeof(member_size(mkspkt_code_t, bytes)), MKSPKT_CODE_OFFSET_BYTES);
-    pbuf_copy_partial(p, &code_pkt->id, MKS_PKT_MAX_STRING_LEN, MKSPKT_CODE_OFFSET_ID);
-    pbuf_copy_partial(p, &code_pkt->seqno, sizeof(member_size(mkspkt_code_t, seqno)), MKSPKT_CODE_OFFSET_SEQNO);
-    pbuf_copy_partial(p, &code_pkt->code_list, sizeof(int32_t) * MKS_PKT_MAX_CODE_LEN, MKSPKT_CODE_OFFSET_CODE_LIST);
-    pbuf_copy_partial(p, &code_pkt->n, sizeof(member_size(mkspkt_code_t, n)), MKSPKT_CODE_OFFSET_N);
-    pbuf_copy_partial(p, &code_pkt->text, MKS_PKT_MAX_STRING_LEN, MKSPKT_CODE_OFFSET_TEXT);
-}
-
-/**
- * @brief Unpack a received ID message into an mkspkt_id structure (ID Packet)
- * @ingroup wire
- *
- * PyKOB: *Doesn't unpack an ID message. It unpacks code and treats it as an ID if
- *         the code length (n) is 0.
- * ("<hh 128s 4x i i 8x 208x 128s 8x")  # cmd, byts, id, seq, idflag, ver
- *
- * @param id_pkt The id_pkt Packet structure to set with data (the pads are ignored (not filled))
- * @param p The PBUF received from the MorseKOB Server (caller to assure it's not NULL)
- *          The caller is responsible for freeing it (they might have more they want to do with it)
- */
-static void _unpack_id_packet(mkspkt_id_t* id_pkt, const pbuf_t* p) {
-    memset(id_pkt, 0, sizeof(mkspkt_id_t));
-    pbuf_copy_partial(p, &id_pkt->cmd, sizeof(member_size(mkspkt_id_t, cmd)), MKSPKT_ID_OFFSET_CMD);
-    pbuf_copy_partial(p, &id_pkt->bytes, sizeof(member_size(mkspkt_id_t, bytes)), MKSPKT_ID_OFFSET_BYTES);
-    pbuf_copy_partial(p, &id_pkt->id, MKS_PKT_MAX_STRING_LEN, MKSPKT_ID_OFFSET_ID);
-    pbuf_copy_partial(p, &id_pkt->seqno, sizeof(member_size(mkspkt_id_t, seqno)), MKSPKT_ID_OFFSET_SEQNO);
-    pbuf_copy_partial(p, &id_pkt->idflag, sizeof(member_size(mkspkt_id_t, idflag)), MKSPKT_ID_OFFSET_IDFLAG);
-    pbuf_copy_partial(p, &id_pkt->version, MKS_PKT_MAX_STRING_LEN, MKSPKT_ID_OFFSET_VERSION);
-}
-
-static pbuf_t* _connect_req_builder() {
-    mkspkt_cmd_wire_t connect_packet = { MKS_CMD_CONNECT, (int16_t)_wire_no };
-    size_t msg_len = sizeof(mkspkt_cmd_wire_t);
-    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(mkspkt_cmd_wire_t), PBUF_POOL); // ZZZ was PBUF_RAM
-    uint8_t* req = (uint8_t*)p->payload;
-    memcpy(req, &connect_packet, msg_len);
-
-    return (p);
-}
-
-static pbuf_t* _disconnect_req_builder() {
-    mkspkt_cmd_wire_t disconnect_packet = { MKS_CMD_DISCONNECT, 0 };
-    size_t msg_len = sizeof(mkspkt_cmd_wire_t);
-    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(mkspkt_cmd_wire_t), PBUF_POOL); // ZZZ was PBUF_RAM
-    uint8_t* req = (uint8_t*)p->payload;
-    memcpy(req, &disconnect_packet, msg_len);
-
-    return (p);
-}
-
-static pbuf_t* _send_id_req_builder() {
-    mkspkt_id_t id_packet;
-    _pack_id_packet(&id_packet);
-    size_t msg_len = sizeof(mkspkt_id_t);
-    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(mkspkt_id_t), PBUF_POOL); // ZZZ was PBUF_RAM
-    uint8_t* req = (uint8_t*)p->payload;
-    memcpy(req, &id_packet, msg_len);
-
-    return (p);
+static void _stations_expire(uint32_t now) {
+    mk_station_info_t info;
+    mkstation_expire(now, _MK_STATION_STALE_TIME);
+    if (_current_sender != MK_STATION_NONE && !mkstation_info(_current_sender, &info)) {
+        // The current sender went stale (its handle can be reused).
+        _current_sender = MK_STATION_NONE;
+    }
 }
 
 /**
@@ -496,6 +529,10 @@ static pbuf_t* _send_id_req_builder() {
  * Note: This is called from an interrupt handler, and therefore care must be taken
  * to avoid operations that could cause a block.
  *
+ * To keep the interrupt latency low (the key is being sampled), this only puts the
+ * PBUF into the receive ring and lets the backend know. The backend processes the
+ * packet (`mkwire_recv_process`).
+ *
  * @param arg
  * @param pcb
  * @param p
@@ -503,100 +540,206 @@ static pbuf_t* _send_id_req_builder() {
  * @param port
  */
 static void _mks_recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_addr_t* ip_addr, u16_t port) {
+    uint64_t t_start = now_us();
     if (p != NULL) {
-        int16_t cmd;
-        pbuf_copy_partial(p, &cmd, sizeof(int16_t), 0);
-        uint16_t total_len = p->tot_len;
-        if (cmd > MAX_VALID_CMD) {
-            error_printf(false, "MKOB Server sent invalid command: %hi Message len: %hu\n", cmd, total_len);
+        uint32_t head = _recv_ring_head;
+        if (head - _recv_ring_tail < _RECV_RING_SIZE) {
+            _recv_ring_entry_t* entry = &_recv_ring[head & (_RECV_RING_SIZE - 1)];
+            entry->p = p;
+            entry->ts_us = t_start;
+            __mem_fence_release();
+            _recv_ring_head = head + 1;
+            postBEMsgNoWait(&_msg_packet_received);
         }
         else {
-            if (MKS_CMD_ACK == cmd) {
-                // ACK received, see if there is a followup function to call (send_id -> send_id2)...
-                if (_next_fn != NULL) {
-                    // Call our next function...
-                    void (*fn)(void) = _next_fn;
-                    _next_fn = NULL;
-                    (*fn)();
-                }
-            }
-            else if (MKS_CMD_DATA == cmd) {
-                // Data or ID
-                // Unpack as Data first, if 'n' is zero, then it is an ID
-                mkspkt_code_t code_pkt;
-                // Treat it as a code packet first.
-                _unpack_code_packet(&code_pkt, p);
-                if (code_pkt.n == 0) {
-                    // ID packet, let the UI know the Station ID
-                    mkspkt_id_t id_pkt;
-                    _unpack_id_packet(&id_pkt, p);
-                    // Update sequence number from sender, ignore others.
-                    if (strcmp(_current_sender.id, code_pkt.id) == 0) {
-                        _seqno_recv = code_pkt.seqno;
-                    }
-                    cmt_msg_t msg_send;
-                    msg_send.id = MSG_WIRE_STATION_ID_RCVD;
-                    msg_send.data.station_id = _save_active_station(code_pkt.id)->id;
-                    postUIMsgNoWait(&msg_send);
-                }
-                else if (code_pkt.n > 0 && code_pkt.seqno != _seqno_recv) {
-                    int code_len = (code_pkt.n <= MKS_PKT_MAX_CODE_LEN ? code_pkt.n : MKS_PKT_MAX_CODE_LEN);
-                    // It is a Code packet.
-                    // Let the UI know who the sender is.
-                    _msg_current_sender.data.station_id = _save_current_sender(code_pkt.id)->id;
-                    postUIMsgNoWait(&_msg_current_sender);
-                    // Process the code...
-                    mcode_seq_t* mcode_seq;
-                    if (code_pkt.seqno != (_seqno_recv + 1)) {
-                        // Sequence break (lost packet?)
-                        // Prepend a long break
-                        mcode_seq = mcode_seq_alloc(MCODE_SRC_WIRE, &mcode_long_break, 1);
-                        mcode_seq_append(mcode_seq, code_pkt.code_list, code_len);
-                    }
-                    else {
-                        mcode_seq = mcode_seq_alloc(MCODE_SRC_WIRE, code_pkt.code_list, code_len);
-                    }
-                    // Post it to the backend to decode
-                    cmt_msg_t msg_send;
-                    msg_send.id = MSG_MORSE_CODE_SEQUENCE;
-                    msg_send.data.mcode_seq = mcode_seq;
-                    // Don't wait. If the queue is full we just lose this one.
-                    if (!postBEMsgNoWait(&msg_send)) {
-                        mcode_seq_free(mcode_seq); // Free the sequence if we couldn't post it.
-                    }
-                    _seqno_recv = code_pkt.seqno;
-                }
-            }
-            else {
-                error_printf(false, "MKWIRE - Unknown CMD: %hd\n", cmd);
+            // Full. The backend is behind, so drop it.
+            _recv_stats.ring_drops++;
+            pbuf_free(p);
+        }
+    }
+    else {
+        error_printf(false, "MKOB Wire receive called without a message. Host:Port %d:%d\n", (ip_addr ? ip_addr->addr : 0), port);
+    }
+    uint32_t t = (uint32_t)(now_us() - t_start);
+    _recv_stats.packets++;
+    _recv_irq_us_total += t;
+    if (t > _recv_stats.irq_us_max) {
+        _recv_stats.irq_us_max = t;
+    }
+}
+
+/**
+ * @brief Process a packet received from the Morse KOB Server.
+ * @ingroup mkwire
+ *
+ * The packet fields are read in place from the PBUF payload when it is contiguous
+ * (the normal case). A chained PBUF is copied (once) into static storage.
+ *
+ * @param p The PBUF received (this frees it)
+ * @param ts_us The microsecond time the packet was received
+ */
+static void _mks_recv_process(pbuf_t* p, uint64_t ts_us) {
+    uint32_t ts_arrival = (uint32_t)(ts_us / 1000);
+    uint16_t total_len = p->tot_len;
+    uint16_t pkt_len = (total_len < sizeof(_pkt_buf) ? total_len : sizeof(_pkt_buf));
+    const uint8_t* pkt = (const uint8_t*)pbuf_get_contiguous(p, _pkt_buf, sizeof(_pkt_buf), pkt_len, 0);
+    if (pkt && mkcap_recording()) {
+        mkcap_record(false, ts_us, pkt, pkt_len);
+    }
+    int16_t cmd = (pkt && pkt_len >= sizeof(int16_t) ? mkspkt_i16(pkt, MKSPKT_CW_OFFSET_CMD) : -1);
+    if (cmd < 0 || cmd > MAX_VALID_CMD) {
+        _recv_stats.invalid++;
+        error_printf(false, "MKOB Server sent invalid command: %hi Message len: %hu\n", cmd, total_len);
+    }
+    else {
+        if (MKS_CMD_ACK == cmd) {
+            _ack_received();
+        }
+        else if (MKS_CMD_DATA == cmd) {
+            if (!_wire_switching) {
+                _mks_recv_data(pkt, pkt_len, ts_arrival);
             }
         }
-        pbuf_free(p);
+        else {
+            error_printf(false, "MKWIRE - Unknown CMD: %hd\n", cmd);
+        }
+    }
+    cyw43_arch_lwip_begin();
+    pbuf_free(p);
+    cyw43_arch_lwip_end();
+}
+
+/**
+ * @brief Handle a Data (Code or ID) packet received from the Morse KOB Server.
+ * @ingroup mkwire
+ *
+ * PyKOB: *Doesn't unpack an ID message. It unpacks code and treats it as an ID if
+ *         the code length (n) is 0.
+ * ("<hh 128s 4x i 12x 51i i 128s 8x")  # cmd, byts, id, seq, code list, n, txt
+ *
+ * @param pkt The packet data (contiguous)
+ * @param len The length of the packet data
+ * @param ts_arrival The millisecond time the packet was received
+ */
+static void _mks_recv_data(const uint8_t* pkt, uint16_t len, uint32_t ts_arrival) {
+    int32_t seqno;
+    char station_id[MKS_PKT_MAX_STRING_LEN + 1];
+    code_element_t code[MKS_PKT_MAX_CODE_LEN];  // The code list in the packet isn't aligned, so it is copied
+    int32_t n = mkwire_data_parse(pkt, len, station_id, &seqno, code);
+    if (n < 0) {
+        _recv_stats.invalid++;
+        return;
+    }
+    uint32_t now = now_ms();
+    // Drop stale stations first, so one coming back is treated as new.
+    _stations_expire(now);
+    mk_station_handle_t found = mkstation_find(station_id);
+    bool from_sender = (_current_sender != MK_STATION_NONE && found == _current_sender);
+    // Save/update the station (this lets the UI know if it is new)
+    mk_station_handle_t station = mkstation_save(station_id, now);
+    if (MK_STATION_NONE == found && _current_sender != MK_STATION_NONE) {
+        // A new station. If the store was full, the current sender could have been dropped
+        // to make room, and its handle given to this station.
+        mk_station_info_t info;
+        if (station == _current_sender || !mkstation_info(_current_sender, &info)) {
+            _current_sender = MK_STATION_NONE;
+        }
+    }
+    if (n == 0) {
+        // ID packet. Update sequence number from sender, ignore others.
+        if (from_sender) {
+            jbuf_sync_seqno(seqno);
+        }
     }
     else {
-        error_printf(false, "MKOB Wire receive called without a message. Host:Port %d:%d\n", ip_addr->addr, port);
+        // It is a Code packet.
+        bool new_sender = !from_sender;
+        _current_sender = station;
+        mkstation_received(station);
+        if (new_sender) {
+            // The station's receive time changed, which changes its order in the list.
+            cmt_msg_t msg_send;
+            msg_send.id = MSG_WIRE_STATION_UPDATED;
+            msg_send.data.station = station;
+            postUIMsgBlocking(&msg_send);
+        }
+        // Let the UI know who the sender is.
+        _msg_current_sender.data.station = station;
+        postUIMsgNoWait(&_msg_current_sender);
+        // Put the code list into an mcode sequence and hold it in the playout buffer
+        // (it handles order, duplicates, and breaks)
+        mcode_seq_t* mcode_seq = mcode_seq_alloc(MCODE_SRC_WIRE, code, n);
+        mcode_seq->ts_recv = ts_arrival;
+        if (jbuf_put(mcode_seq, seqno, station, new_sender, ts_arrival)) {
+            // Play anything that is due (and schedule the next).
+            mkwire_code_playout();
+        }
     }
 }
 
-// Continuation of the `_send_id` function. Called after 'ACK' is received.
-static void _send_id_2() {
+/**
+ * @brief Free any received packets that haven't been processed.
+ * @ingroup mkwire
+ */
+static void _recv_ring_flush() {
+    while (_recv_ring_tail != _recv_ring_head) {
+        uint32_t tail = _recv_ring_tail;
+        __mem_fence_acquire();
+        pbuf_t* p = _recv_ring[tail & (_RECV_RING_SIZE - 1)].p;
+        _recv_ring_tail = tail + 1;
+        cyw43_arch_lwip_begin();
+        pbuf_free(p);
+        cyw43_arch_lwip_end();
+    }
+}
+
+/**
+ * @brief Send a datagram to the server (capturing it if a capture is being recorded).
+ * @ingroup wire
+ *
+ * @param p The PBUF to send. It is freed. If it is NULL (a PBUF couldn't be allocated)
+ *          nothing is sent, and the ACK timeout or keep alive sends again.
+ */
+static void _mks_send(pbuf_t* p) {
+    if (!p) {
+        error_printf(false, "MKWIRE - No PBUF available to send.\n");
+        return;
+    }
+    if (mkcap_recording()) {
+        mkcap_record(true, now_us(), (const uint8_t*)p->payload, p->len);
+    }
+    cyw43_arch_lwip_begin();
+    udp_send(_udp_pcb, p);
+    pbuf_free(p);
+    cyw43_arch_lwip_end();
+}
+
+/**
+ * @brief Send a CONNECT (the first step of sending our ID) and start the ACK timeout.
+ * @ingroup wire
+ *
+ * The ID is sent when the ACK is received (`_ack_received`).
+ */
+static void _send_connect() {
     if (_udp_pcb) {
         _seqno_send++;
-        pbuf_t* p = _send_id_req_builder();
-        udp_send(_udp_pcb, p);
-        pbuf_free(p);
-        _send_keep_alive = true;
+        _link_state = WIRE_LINK_ACK_WAIT;
+        _ts_connect_sent = now_ms();
+        _mks_send(mkwire_connect_req(_wire_no));
+        scheduled_msg_cancel(MSG_MKS_ACK_TIMEOUT);
+        schedule_msg_in_ms(MKWIRE_ACK_TIMEOUT_MS, &_msg_ack_timeout);
     }
 }
 
+/**
+ * @brief Send our ID. Called after the ACK for the CONNECT is received.
+ * @ingroup wire
+ */
 static void _send_id() {
+    _wire_switching = false;
     if (_udp_pcb) {
-        // Send a connect message and indicate that _send_id_2 should be called when 'ACK' is received.
         _seqno_send++;
-        pbuf_t* p = _connect_req_builder();
-        _next_fn = _send_id_2;
-        udp_send(_udp_pcb, p);
-        pbuf_free(p);
+        _mks_send(mkwire_id_req(_seqno_send));
     }
 }
 
@@ -611,3 +754,25 @@ static void _wire_connect() {
         error_printf(false, "MK Wire Connect failed: %d\n", status);
     }
 }
+
+/**
+ * @brief Switch to a different wire while connected.
+ * @ingroup wire
+ *
+ * The server tracks clients by IP:Port, so the bound socket is kept and a
+ * DISCONNECT followed by the CONNECT->ACK->ID exchange is sent on it. The
+ * stations of the wire being left are saved, and the ones saved for the new
+ * wire (if any) are shown right away.
+ */
+static void _wire_switch(uint16_t wire_no) {
+    uint32_t now = now_ms();
+    _mks_send(mkwire_disconnect_req());
+    _wire_switching = true;
+    _recv_ring_flush();
+    mkstation_wire_save(_wire_no, now);
+    _clear_stations();
+    _wire_no = wire_no;
+    mkstation_wire_restore(wire_no, now, _MK_STATION_STALE_TIME);
+    _ack_retries = 0;
+    _send_connect();
+}
@@ -12,6 +12,8 @@ extern "C" {
 #endif
 
 #include "cmt.h"
+#include "mks.h"
+#include "mkstation.h"
 
 #include <stdbool.h>
 #include "pico/types.h"
@@ -26,30 +28,85 @@ typedef enum _WIRE_CONNECTED_STATE_ {
 } wire_connected_state_t;
 
 /**
- * @brief Structure for an active MorseKOB station.
+ * @brief State of the link with the MorseKOB Server.
  * @ingroup wire
  *
- * @param id Name of the station
- * @param ts_init millisecond timestamp when the station first connected
- * @param ts_ping millisecond timestamp of the last ping from this station
- * @param ts_recv millisecond timestamp of the last receipt from this station
+ * The link is down when the wire isn't connected (and from when the socket is bound
+ * until the first CONNECT is sent).
  */
-typedef struct _station_id_ {
-    char id[MKS_PKT_MAX_STRING_LEN + 1];
-    uint32_t ts_init;
-    uint32_t ts_ping;
-    uint32_t ts_recv;
-} mk_station_id_t;
-#define MK_MAX_ACTIVE_STATIONS 32
+typedef enum _WIRE_LINK_STATE_ {
+    WIRE_LINK_DOWN,         // No socket
+    WIRE_LINK_ACK_WAIT,     // CONNECT sent, waiting for the ACK
+    WIRE_LINK_UP,           // ACK received and ID sent
+} wire_link_state_t;
 
+/**
+ * @brief Time to wait for an ACK to a CONNECT before sending it again.
+ * @ingroup wire
+ */
+#define MKWIRE_ACK_TIMEOUT_MS 2000
+/**
+ * @brief Number of times a CONNECT is sent again before giving up (and disconnecting).
+ * @ingroup wire
+ */
+#define MKWIRE_ACK_RETRIES_MAX 3
+
+/**
+ * @brief Wire link statistics.
+ * @ingroup wire
+ *
+ * The round trip time is measured from a CONNECT to its ACK (not when
+ * the CONNECT had to be sent again, as the ACK could be for either).
+ */
+typedef struct _MKWIRE_LINK_STATS_ {
+    wire_link_state_t state;
+    int32_t rtt_ms;         // Last round trip time (-1 if none has been measured)
+    int32_t rtt_ms_avg;     // Smoothed round trip time
+    int32_t rtt_ms_min;
+    int32_t rtt_ms_max;
+    uint32_t acks;          // ACKs received for a CONNECT
+    uint32_t ack_timeouts;  // Times an ACK wasn't received in time
+    uint32_t link_lost;     // Times the link was dropped because the server didn't respond
+} mkwire_link_stats_t;
 
 /**
- * @brief Get a list of the active stations.
+ * @brief Wire receive statistics.
  * @ingroup wire
  *
- * @return const mk_station_id_t** List of pointers to station ID structures.
+ * The interrupt handler times are for the handler as it is now (queueing the
+ * packet for the backend). The handler that processed the whole packet isn't
+ * instrumented, so there is no 'before' to compare with.
  */
-extern const mk_station_id_t** mkwire_active_stations();
+typedef struct _MKWIRE_RECV_STATS_ {
+    uint32_t packets;       // Packets received (receive interrupt handler calls)
+    uint32_t processed;     // Packets processed by the backend
+    uint32_t ring_drops;    // Packets dropped because the receive ring was full
+    uint32_t invalid;       // Packets dropped because they were invalid
+    uint32_t irq_us_avg;    // Average time in the receive interrupt handler
+    uint32_t irq_us_max;    // Longest time in the receive interrupt handler
+    uint32_t proc_us_avg;   // Average time processing a packet in the backend (of `processed`)
+    uint32_t proc_us_max;   // Longest time processing a packet in the backend
+} mkwire_recv_stats_t;
+
+
+/**
+ * @brief Handle the ACK timeout (the server hasn't responded to a CONNECT).
+ * @ingroup wire
+ *
+ * The CONNECT is sent again, up to MKWIRE_ACK_RETRIES_MAX times, then the wire is
+ * disconnected. Called when the backend gets a MSG_MKS_ACK_TIMEOUT message.
+ */
+extern void mkwire_ack_timeout();
+
+/**
+ * @brief Release code that is due to be played from the playout (jitter) buffer.
+ * @ingroup wire
+ *
+ * Code received from the wire is held in a playout buffer to smooth out the
+ * network timing. This posts the code that is due to the backend for sounding and
+ * decoding, and schedules itself to run again when the next code is due.
+ */
+extern void mkwire_code_playout();
 
 /*!
  * @brief Disconnect from the currently connected MorseKOB Wire.
@@ -57,6 +114,59 @@ extern const mk_station_id_t** mkwire_active_stations();
  */
 extern void mkwire_disconnect();
 
+/**
+ * @brief Build a Code packet.
+ * @ingroup wire
+ *
+ * @param station_id The ID of the sending station.
+ * @param seqno The sequence number for the packet.
+ * @param code The code elements.
+ * @param n The number of code elements (at most MKS_PKT_MAX_CODE_LEN). A packet with no code is an ID.
+ * @return The PBUF with the packet (the caller must free it), or NULL if a PBUF couldn't be allocated.
+ */
+extern struct pbuf* mkwire_code_req(const char* station_id, int32_t seqno, const code_element_t* code, int n);
+
+/**
+ * @brief Build a CONNECT request packet.
+ * @ingroup wire
+ *
+ * @param wire_no The wire number to connect to.
+ * @return The PBUF with the request (the caller must free it), or NULL if a PBUF couldn't be allocated.
+ */
+extern struct pbuf* mkwire_connect_req(uint16_t wire_no);
+
+/**
+ * @brief Check and unpack a Data (Code or ID) packet received from the Morse KOB Server.
+ * @ingroup wire
+ *
+ * This is `mkspkt_data_parse` with an error printed if the packet isn't valid.
+ *
+ * @param pkt The packet data (contiguous).
+ * @param len The length of the packet data.
+ * @param station_id Buffer for the sending station's ID (MKS_PKT_MAX_STRING_LEN + 1 long).
+ * @param seqno Set to the packet sequence number.
+ * @param code Buffer to copy the code elements into (MKS_PKT_MAX_CODE_LEN long), or NULL to skip the copy.
+ * @return The number of code elements (0 for an ID packet), or -1 if the packet isn't valid.
+ */
+extern int mkwire_data_parse(const uint8_t* pkt, uint16_t len, char* station_id, int32_t* seqno, code_element_t* code);
+
+/**
+ * @brief Build a DISCONNECT request packet.
+ * @ingroup wire
+ *
+ * @return The PBUF with the request (the caller must free it), or NULL if a PBUF couldn't be allocated.
+ */
+extern struct pbuf* mkwire_disconnect_req();
+
+/**
+ * @brief Build an ID packet for the local Station/Office ID.
+ * @ingroup wire
+ *
+ * @param seqno The sequence number for the packet.
+ * @return The PBUF with the packet (the caller must free it), or NULL if a PBUF couldn't be allocated.
+ */
+extern struct pbuf* mkwire_id_req(int32_t seqno);
+
 /*!
  * @brief Connect to a MorseKOB Wire.
  * @ingroup wire
@@ -83,12 +193,12 @@ extern void mkwire_connect_toggle();
 extern wire_connected_state_t mkwire_connected_state();
 
 /**
- * @brief The current sender or NULL.
+ * @brief The current sender.
  * @ingroup wire
  *
- * @return const char*
+ * @return mk_station_handle_t The current sender's station handle, or MK_STATION_NONE
  */
-extern const char* mkwire_current_sender();
+extern mk_station_handle_t mkwire_current_sender();
 
 /*!
  * @brief Initialize the MorseKOB Wire subsystem.
@@ -112,9 +222,19 @@ extern bool mkwire_is_connected();
  * @brief Send the station ID to the MorseKOB Server if currently connected.
  * @ingroup wire
  *
+ * Called when the backend gets a MSG_MKS_KEEP_ALIVE_SEND message. While connected,
+ * this schedules the message again for the next keep alive (MKS_KEEP_ALIVE_TIME).
  */
 extern void mkwire_keep_alive_send();
 
+/**
+ * @brief Get the wire link state and statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void mkwire_link_stats(mkwire_link_stats_t* stats);
+
 /**
  * @brief Handle a message containing a pbuf packet received from a Morse KOB Server.
  *
@@ -138,6 +258,34 @@ extern void mkwire_set_office_id(char* office_id);
  */
 extern uint16_t mkwire_wire_get();
 
+/**
+ * @brief Process the packets that have been received.
+ * @ingroup wire
+ *
+ * Packets are queued by the receive interrupt handler and are processed
+ * by the backend when it gets a MSG_MKS_PACKET_RECEIVED message.
+ */
+extern void mkwire_recv_process();
+
+/**
+ * @brief Put a packet into the receive path as if it had come from the server.
+ * @ingroup wire
+ *
+ * This is for the server stand-in (mksim). It is only done when the wire isn't
+ * connected (otherwise the packet is freed), as the receive ring has a single producer.
+ *
+ * @param p The PBUF (this takes ownership of it). NULL is ignored.
+ */
+extern void mkwire_recv_inject(struct pbuf* p);
+
+/**
+ * @brief Get the wire receive statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void mkwire_recv_stats(mkwire_recv_stats_t* stats);
+
 /**
  * @brief Set the wire number (without connecting).
  * @ingroup wire
@@ -6,10 +6,13 @@
  *
  */
 #include "net.h"
+#include "cmt.h"
 #include "mkboard.h"
+#include "oppool.h"
 #include "util.h"
 
-#include "hardware/rtc.h"
+#include "pico/mutex.h"
+#include "hardware/sync.h"
 #include "pico/time.h"
 
 #define ADDR_PORT_SEP ':'
@@ -19,16 +22,76 @@ static char _wifi_password[NET_PASSWORD_MAX_LEN];
 
 static bool _wifi_connected = false;
 
+typedef enum _WIFI_MGR_STATE_ {
+    _WIFI_IDLE,             // Not connected, and not trying to connect
+    _WIFI_CONNECTING,
+    _WIFI_CONNECTED,
+    _WIFI_RETRY_WAIT,       // Waiting to retry after a failure
+} _wifi_mgr_state_t;
+
+static _wifi_mgr_state_t _wifi_state = _WIFI_IDLE;
+static int _wifi_link_status = CYW43_LINK_DOWN;
+static uint32_t _wifi_connect_ts;       // When the connection attempt was started
+static uint32_t _wifi_retry_ts;         // When to retry
+static uint32_t _wifi_retry_ms = WIFI_RETRY_MIN_MS;
+static uint32_t _wifi_check_ts;
+
+/** A bind waiting for WiFi to connect. */
+typedef struct _udp_bind_pending {
+    bool pending;
+    char hostname[NET_HOSTNAME_MAX_LEN + 1];
+    uint16_t port;
+    udp_bind_handler_fn bind_handler;
+} udp_bind_pending_t;
+
+static udp_bind_pending_t _bind_pending;
+
+/**
+ * Resolved address cache.
+ *
+ * lwIP doesn't pass the record TTL to the found callback, so an address is
+ * used for NET_DNS_CACHE_TTL_MS and refreshed (in the background) when it
+ * is used during the last quarter of that time.
+ */
+typedef struct _dns_cache_entry {
+    char hostname[NET_DNS_CACHE_NAME_MAX_LEN + 1];  // Empty if the entry is free
+    bool resolved;
+    ip_addr_t ipaddr;
+    uint32_t ts_resolved;
+    uint32_t ts_used;
+} dns_cache_entry_t;
+
+static dns_cache_entry_t _dns_cache[NET_DNS_CACHE_ENTRIES];
+// The lwIP DNS callbacks run on the core that owns the CYW43, lookups and prefetches on the backend core.
+auto_init_mutex(dns_cache_mutex);
+
 // Forward definitions...
-static void _ntp_response_handler(err_enum_t status, pbuf_t* p, void* handler_data);
+static dns_cache_entry_t* _dns_cache_entry(const char* hostname, uint32_t now);
+static void _dns_cache_found(const char* hostname, const ip_addr_t* ipaddr, void* arg);
+static bool _dns_cache_lookup(const char* hostname, ip_addr_t* ipaddr);
+static void _dns_cache_refresh();
+static void _dns_cache_resolve(const char* hostname);
+static void _dns_cache_store(const char* hostname, const ip_addr_t* ipaddr);
 static void _udp_bind_dns_found(const char* hostname, const ip_addr_t* ipaddr, void* arg);
 static int64_t _udp_bind_dns_timeout_handler(alarm_id_t id, void* request_state);
 static void _udp_sop_dns_found(const char* hostname, const ip_addr_t* ipaddr, void* arg);
 static void _udp_sop_recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_addr_t* addr, u16_t port);
 static int64_t _udp_sop_timeout_handler(alarm_id_t id, void* request_state);
+static err_enum_t _udp_socket_bind_start(const char* hostname, uint16_t port, udp_bind_handler_fn bind_handler);
+static void _wifi_connect_start(uint32_t now);
+static void _wifi_leave(void);
+static void _wifi_retry_wait(uint32_t now);
+static void _wifi_update(uint32_t now, bool post);
 
+/**
+ * Context for a UDP operation (bind or single operation).
+ *
+ * There is a context for each slot of the operation pool (see oppool.h). The DNS,
+ * receive, and timeout callbacks are given a pool handle rather than a pointer, so
+ * that only the first of the callbacks for a step of the operation gets the context.
+ */
 typedef struct _udp_op_context {
-    err_enum_t status;
+    bool from_cache;            // The address came from the DNS cache
     ip_addr_t ipaddr;
     uint16_t port;
     struct udp_pcb* udp_pcb;
@@ -40,20 +103,19 @@ typedef struct _udp_op_context {
     udp_bind_handler_fn bind_handler;
 } udp_op_context_t;
 
+typedef oppool_handle_t udp_op_handle_t;
+
+static udp_op_context_t _op_contexts[OPPOOL_SIZE];
+
+static udp_op_context_t* _op_context_alloc(udp_op_handle_t* handle);
+static udp_op_context_t* _op_context_claim(udp_op_handle_t handle, udp_op_handle_t* next);
+static void _op_context_free(udp_op_context_t* op_context);
+
 #define ANY_LOCAL_PORT 0 // Used in udp_bind
 
 #define DNS_TIMEOUT (5 * 1000)
 #define UDP_SO_FAILSAFE_TO (60 * 1000)
 
-#define NTP_SERVER "pool.ntp.org"
-#define NTP_PORT 123
-#define NTP_TIMEOUT (10 * 1000)
-#define NTP_MSG_LEN 48
-#define NTP_DELTA 2208988800 // seconds between 1 Jan 1900 and 1 Jan 1970
-typedef struct _ntp_handler_data {
-    float tz_offset;
-} ntp_handler_data_t;
-
 
 // ====================================================================
 // Public functions
@@ -95,88 +157,106 @@ uint16_t port_from_hostport(const char* host_and_port, uint16_t port_default) {
 }
 
 err_enum_t udp_socket_bind(const char* hostname, uint16_t port, udp_bind_handler_fn bind_handler) {
-    err_enum_t status = ERR_INPROGRESS;
-
+    _bind_pending.pending = false;
     if (!wifi_connect()) {
-        return ERR_CONN;
-    }
-    udp_op_context_t* op_context = malloc(sizeof(udp_op_context_t));
-    if (!op_context) {
-        error_printf(false, "UDP Single Operation - failed to allocate context\n");
-        return ERR_MEM;
-    }
-
-    op_context->port = port;
-    op_context->bind_handler = bind_handler;
-
-    // Set up a timeout so we can call the bind handler even if the DNS lookup fails.
-    op_context->timeout_alarm_id = add_alarm_in_ms(DNS_TIMEOUT, _udp_bind_dns_timeout_handler, op_context, true);
-    debug_printf(true, "Set udp_socket_bind DNS timeout: %d  (%ums)\n", op_context->timeout_alarm_id, DNS_TIMEOUT);
-    cyw43_arch_lwip_begin();
-    {
-        status = dns_gethostbyname_addrtype(hostname, &op_context->ipaddr, _udp_bind_dns_found, op_context, LWIP_DNS_ADDRTYPE_IPV4_IPV6);
-    }
-    cyw43_arch_lwip_end();
-
-    if (status == ERR_OK) {
-        // The address is ready. Continue with our processing...
-        op_context->status = status;
-        _udp_bind_dns_found(hostname, &op_context->ipaddr, (void*)op_context);
-    }
-    else if (status != ERR_INPROGRESS) { // ERR_INPROGRESS means expect a callback
-        error_printf(false, "DNS request failed\n");
-        op_context->status = status;
+        // Hold it until WiFi is connected.
+        if (strlen(hostname) > NET_HOSTNAME_MAX_LEN) {
+            error_printf(false, "UDP Bind - hostname too long: '%s'\n", hostname);
+            return ERR_ARG;
+        }
+        strcpynt(_bind_pending.hostname, hostname, NET_HOSTNAME_MAX_LEN);
+        _bind_pending.port = port;
+        _bind_pending.bind_handler = bind_handler;
+        _bind_pending.pending = true;
+        return ERR_INPROGRESS;
     }
-
-    return (status);
+    return (_udp_socket_bind_start(hostname, port, bind_handler));
 }
 
+void udp_socket_bind_cancel() {
+    _bind_pending.pending = false;
+}
 err_enum_t udp_single_operation(const char* hostname, uint16_t port, pbuf_t* p, uint32_t timeout_ms, udp_sop_result_handler_fn result_handler, void* handler_data) {
     err_enum_t status = ERR_INPROGRESS;
 
     if (!wifi_connect()) {
         return ERR_CONN;
     }
-    udp_op_context_t* op_context = malloc(sizeof(udp_op_context_t));
+    udp_op_handle_t handle;
+    udp_op_context_t* op_context = _op_context_alloc(&handle);
     if (!op_context) {
-        error_printf(false, "UDP Single Operation - failed to allocate context\n");
+        error_printf(false, "UDP Single Operation - no operation context available\n");
         return ERR_MEM;
     }
 
     op_context->port = port;
+    op_context->udp_pcb = NULL;
     op_context->timeout_ms = timeout_ms;
     op_context->p = p;
     op_context->op_result_handler = result_handler;
     op_context->result_handler_data = handler_data;
 
-    cyw43_arch_lwip_begin();
-    {
-        status = dns_gethostbyname_addrtype(hostname, &op_context->ipaddr, _udp_sop_dns_found, op_context, LWIP_DNS_ADDRTYPE_IPV4_IPV6);
+    // Set up a timeout so we can call the result handler even if the DNS lookup doesn't complete.
+    op_context->timeout_alarm_id = add_alarm_in_ms(DNS_TIMEOUT, _udp_sop_timeout_handler, (void*)(uintptr_t)handle, true);
+    op_context->from_cache = _dns_cache_lookup(hostname, &op_context->ipaddr);
+    if (op_context->from_cache) {
+        status = ERR_OK;
+    }
+    else {
+        cyw43_arch_lwip_begin();
+        {
+            status = dns_gethostbyname_addrtype(hostname, &op_context->ipaddr, _udp_sop_dns_found, (void*)(uintptr_t)handle, LWIP_DNS_ADDRTYPE_IPV4_IPV6);
+        }
+        cyw43_arch_lwip_end();
     }
-    cyw43_arch_lwip_end();
 
     if (status == ERR_OK) {
-        // The address is ready (maybe it was in octet format). Call the bind handler...
-        op_context->status = status;
-        _udp_sop_dns_found(hostname, &op_context->ipaddr, op_context);
+        // The address is ready (maybe it was in octet format). Continue with our processing...
+        _udp_sop_dns_found(hostname, &op_context->ipaddr, (void*)(uintptr_t)handle);
     }
     else if (status != ERR_INPROGRESS) { // ERR_INPROGRESS means expect a callback
         error_printf(false, "UDP Single Operation DNS request failed\n");
-        free(op_context);
+        if (_op_context_claim(handle, NULL)) {
+            cancel_alarm(op_context->timeout_alarm_id);
+            _op_context_free(op_context);
+        }
     }
 
     return (status);
 }
 
 bool wifi_connect() {
-    if (!_wifi_connected) {
-        if (cyw43_arch_wifi_connect_timeout_ms(_wifi_ssid, _wifi_password, CYW43_AUTH_WPA2_AES_PSK, 10000)) {
-            error_printf(false, "failed to connect\n");
-            return (false);
+    if (_WIFI_IDLE == _wifi_state) {
+        _wifi_connect_start(now_ms());
+    }
+    return (_wifi_connected);
+}
+
+bool wifi_connect_wait(uint32_t timeout_ms) {
+    uint32_t start = now_ms();
+    wifi_connect();
+    while (!_wifi_connected && (now_ms() - start) < timeout_ms) {
+        sleep_ms(WIFI_CHECK_PERIOD_MS);
+        _wifi_update(now_ms(), false);
+    }
+    return (_wifi_connected);
+}
+
+void wifi_connection_check() {
+    uint32_t now = now_ms();
+    if ((now - _wifi_check_ts) < WIFI_CHECK_PERIOD_MS) {
+        return;
+    }
+    _wifi_check_ts = now;
+    _wifi_update(now, true);
+    if (_wifi_connected && _bind_pending.pending) {
+        // WiFi is up. Start the bind that was waiting for it.
+        _bind_pending.pending = false;
+        err_enum_t status = _udp_socket_bind_start(_bind_pending.hostname, _bind_pending.port, _bind_pending.bind_handler);
+        if (!(ERR_OK == status || ERR_INPROGRESS == status)) {
+            _bind_pending.bind_handler(status, NULL);
         }
-        _wifi_connected = true;
     }
-    return (true);
 }
 
 bool wifi_connected() {
@@ -188,90 +268,170 @@ void wifi_set_creds(const char* ssid, const char* pw) {
     strcpynt(_wifi_password, pw, NET_PASSWORD_MAX_LEN);
 }
 
-err_enum_t network_update_rtc(float tz_offset) {
-    // Build the NTP request message...
-    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, NTP_MSG_LEN, PBUF_POOL);
-    uint8_t* req = (uint8_t*)p->payload;
-    memset(req, 0, NTP_MSG_LEN);
-    req[0] = 0x1b; // NTP Request: Version=3 Mode=3 (client)
-    ntp_handler_data_t* handler_data = (ntp_handler_data_t*)malloc(sizeof(ntp_handler_data_t));
-    handler_data->tz_offset = tz_offset;
-
-    err_enum_t status = udp_single_operation(NTP_SERVER, NTP_PORT, p, NTP_TIMEOUT, _ntp_response_handler, (void*)handler_data);
-    if (status != ERR_OK && status != ERR_INPROGRESS) {
-        // Operation initialization failed. Need to free the PBUF we created...
-        pbuf_free(p);
+err_enum_t net_dns_prefetch(const char* hostname) {
+    bool fresh = false;
+    uint32_t now = now_ms();
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&dns_cache_mutex);
+    dns_cache_entry_t* entry = _dns_cache_entry(hostname, now);
+    if (entry) {
+        entry->ts_used = now;
+        fresh = (entry->resolved && (now - entry->ts_resolved) < NET_DNS_CACHE_TTL_MS);
     }
-    return (status);
+    mutex_exit(&dns_cache_mutex);
+    restore_interrupts(flags);
+    if (!entry) {
+        return (ERR_ARG);
+    }
+    if (!fresh && _wifi_connected) {
+        _dns_cache_resolve(hostname);
+    }
+    return (ERR_OK);
 }
 
-
 // ====================================================================
 // Internal functions
 // ====================================================================
 
 
-// Called with pre-processed results of NTP operation
-static void _ntp_set_datetime(err_enum_t status, time_t* seconds_from_epoch, float tz_offset) {
-    if (status == ERR_OK && seconds_from_epoch) {
-        // Adjust by the tz_offset - hours from GMT
-        time_t offset = (time_t)(3600.0 * tz_offset);
-        *seconds_from_epoch += offset;
-        // Get a UTC structure time
-        struct tm* utc = gmtime(seconds_from_epoch);
-        // Set the board's time
-        datetime_t tm;
-        tm.day = utc->tm_mday;
-        tm.month = utc->tm_mon + 1;
-        tm.year = utc->tm_year + 1900;
-        tm.dotw = utc->tm_wday;
-        tm.hour = utc->tm_hour;
-        tm.min = utc->tm_min;
-        tm.sec = utc->tm_sec;
-        // Adjust for timezone
-
-        rtc_set_datetime(&tm);
+// Find the cache entry for a host, or take one for it (the least recently used) - the cache must be locked
+static dns_cache_entry_t* _dns_cache_entry(const char* hostname, uint32_t now) {
+    if (strlen(hostname) > NET_DNS_CACHE_NAME_MAX_LEN) {
+        return (NULL);
     }
+    dns_cache_entry_t* lru = &_dns_cache[0];
+    for (int i = 0; i < NET_DNS_CACHE_ENTRIES; i++) {
+        dns_cache_entry_t* entry = &_dns_cache[i];
+        if (strcmp(entry->hostname, hostname) == 0) {
+            return (entry);
+        }
+        if (!*entry->hostname || (*lru->hostname && (now - entry->ts_used) > (now - lru->ts_used))) {
+            lru = entry;
+        }
+    }
+    strcpynt(lru->hostname, hostname, NET_DNS_CACHE_NAME_MAX_LEN);
+    lru->resolved = false;
+    lru->ts_used = now;
+
+    return (lru);
 }
 
-// NTP data received (udp_incoming_data_handler_fn)
-static void _ntp_response_handler(err_enum_t status, pbuf_t* p, void* handler_data) {
-    if (p) {
-        uint8_t mode = pbuf_get_at(p, 0) & 0x7;
-        uint8_t stratum = pbuf_get_at(p, 1);
-        ntp_handler_data_t* ntp_handler_data = (ntp_handler_data_t*)handler_data;
-        float tz_offset = ntp_handler_data->tz_offset;
+// Called back with a DNS result for a cache refresh or prefetch (dns_found_callback)
+static void _dns_cache_found(const char* hostname, const ip_addr_t* ipaddr, void* arg) {
+    if (ipaddr) {
+        _dns_cache_store(hostname, ipaddr);
+    }
+}
 
-        if (status != ERR_OK) {
-            _ntp_set_datetime(status, NULL, tz_offset);
-        }
-        else if (status == ERR_OK && mode == 0x4 && stratum != 0) {
-            uint8_t seconds_buf[4] = { 0 };
-            pbuf_copy_partial(p, seconds_buf, sizeof(seconds_buf), 40);
-            uint32_t seconds_since_1900 = seconds_buf[0] << 24 | seconds_buf[1] << 16 | seconds_buf[2] << 8 | seconds_buf[3];
-            uint32_t seconds_since_1970 = seconds_since_1900 - NTP_DELTA;
-            time_t seconds_from_epoch = seconds_since_1970;
-            _ntp_set_datetime(status, &seconds_from_epoch, tz_offset);
-        }
-        else {
-            error_printf(false, "invalid NTP response\n");
-            _ntp_set_datetime(ERR_VAL, NULL, tz_offset);
+// Get an address from the cache. Returns false if the host isn't in the cache or its address is stale.
+static bool _dns_cache_lookup(const char* hostname, ip_addr_t* ipaddr) {
+    bool fresh = false;
+    bool refresh = false;
+    uint32_t now = now_ms();
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&dns_cache_mutex);
+    for (int i = 0; i < NET_DNS_CACHE_ENTRIES; i++) {
+        dns_cache_entry_t* entry = &_dns_cache[i];
+        if (entry->resolved && strcmp(entry->hostname, hostname) == 0) {
+            uint32_t age = now - entry->ts_resolved;
+            if (age < NET_DNS_CACHE_TTL_MS) {
+                fresh = true;
+                refresh = (age > ((NET_DNS_CACHE_TTL_MS / 4) * 3));
+                *ipaddr = entry->ipaddr;
+                entry->ts_used = now;
+            }
+            break;
         }
-        if (p->ref > 0) {
-            pbuf_free(p);
+    }
+    mutex_exit(&dns_cache_mutex);
+    restore_interrupts(flags);
+    if (refresh) {
+        _dns_cache_resolve(hostname);
+    }
+    return (fresh);
+}
+
+// Resolve the cached hosts that don't have a current address
+static void _dns_cache_refresh() {
+    char hostname[NET_DNS_CACHE_NAME_MAX_LEN + 1];
+    uint32_t now = now_ms();
+    for (int i = 0; i < NET_DNS_CACHE_ENTRIES; i++) {
+        dns_cache_entry_t* entry = &_dns_cache[i];
+        uint32_t flags = save_and_disable_interrupts();
+        mutex_enter_blocking(&dns_cache_mutex);
+        bool stale = (*entry->hostname && (!entry->resolved || (now - entry->ts_resolved) > ((NET_DNS_CACHE_TTL_MS / 4) * 3)));
+        strcpy(hostname, entry->hostname);
+        mutex_exit(&dns_cache_mutex);
+        restore_interrupts(flags);
+        if (stale) {
+            _dns_cache_resolve(hostname);
         }
     }
-    if (handler_data) {
-        free(handler_data);
+}
+
+// Start a DNS lookup to update the cache
+static void _dns_cache_resolve(const char* hostname) {
+    ip_addr_t ipaddr;
+    err_enum_t status;
+    cyw43_arch_lwip_begin();
+    {
+        status = dns_gethostbyname_addrtype(hostname, &ipaddr, _dns_cache_found, NULL, LWIP_DNS_ADDRTYPE_IPV4_IPV6);
+    }
+    cyw43_arch_lwip_end();
+    if (status == ERR_OK) {
+        _dns_cache_store(hostname, &ipaddr);
+    }
+}
+
+// Save a resolved address in the cache
+static void _dns_cache_store(const char* hostname, const ip_addr_t* ipaddr) {
+    uint32_t now = now_ms();
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&dns_cache_mutex);
+    dns_cache_entry_t* entry = _dns_cache_entry(hostname, now);
+    if (entry) {
+        entry->ipaddr = *ipaddr;
+        entry->resolved = true;
+        entry->ts_resolved = now;
     }
+    mutex_exit(&dns_cache_mutex);
+    restore_interrupts(flags);
+}
+
+// Get a free operation context from the pool (NULL if none are free)
+static udp_op_context_t* _op_context_alloc(udp_op_handle_t* handle) {
+    int i = oppool_alloc(handle);
+
+    return (i < 0 ? NULL : &_op_contexts[i]);
+}
+
+// Claim the current step of an operation. Returns NULL if the handle is stale (the step was already taken).
+// If `next` isn't NULL it is set to the handle for the callbacks of the next step.
+static udp_op_context_t* _op_context_claim(udp_op_handle_t handle, udp_op_handle_t* next) {
+    int i = oppool_claim(handle, next);
+
+    return (i < 0 ? NULL : &_op_contexts[i]);
+}
+
+// Return an operation context to the pool (any handles to it become stale)
+static void _op_context_free(udp_op_context_t* op_context) {
+    oppool_free((int)(op_context - _op_contexts));
 }
 
 // Called back with a DNS result (dns_found_callback)
 static void _udp_bind_dns_found(const char* hostname, const ip_addr_t* ipaddr, void* arg) {
-    udp_op_context_t* op_context = (udp_op_context_t*)arg;
+    udp_op_context_t* op_context = _op_context_claim((udp_op_handle_t)(uintptr_t)arg, NULL);
+    if (!op_context) {
+        // The lookup already timed out (and the bind handler was called).
+        debug_printf(false, "UDP Bind DNS result after timeout ignored for hostname: '%s'\n", hostname);
+        return;
+    }
     udp_bind_handler_fn bind_handler = op_context->bind_handler;
     err_enum_t status = ERR_OK;
     struct udp_pcb* udp_pcb = NULL;
+    if (ipaddr && !op_context->from_cache) {
+        _dns_cache_store(hostname, ipaddr);
+    }
 
     // Cancel the pending timeout for the DNS operation.
     if (op_context->timeout_alarm_id != 0) {
@@ -309,19 +469,22 @@ static void _udp_bind_dns_found(const char* hostname, const ip_addr_t* ipaddr, v
     }
 
     // All done. Free resources and call their bind handler.
-    free(op_context);
+    _op_context_free(op_context);
     bind_handler(status, udp_pcb);
 }
 
 // Called on timeout of DNS lookup (alarm_callback_t)
 static int64_t _udp_bind_dns_timeout_handler(alarm_id_t id, void* request_state) {
-    udp_op_context_t* op_context = (udp_op_context_t*)request_state;
+    udp_op_context_t* op_context = _op_context_claim((udp_op_handle_t)(uintptr_t)request_state, NULL);
+    if (!op_context) {
+        // The DNS result came in first.
+        return 0;
+    }
     udp_bind_handler_fn bind_handler = op_context->bind_handler;
 
-    cancel_alarm(id);
     error_printf(false, "UDP Bind DNS request failed with timeout (id:%d timeout_id:%d)\n", id, op_context->timeout_alarm_id);
 
-    free(op_context);
+    _op_context_free(op_context);
 
     bind_handler(ERR_TIMEOUT, NULL);
 
@@ -330,7 +493,16 @@ static int64_t _udp_bind_dns_timeout_handler(alarm_id_t id, void* request_state)
 
 // Called back by the DNS lookup from a UDP_SINGLE_OPERATION call.
 static void _udp_sop_dns_found(const char* hostname, const ip_addr_t* ipaddr, void* arg) {
-    udp_op_context_t* op_context = (udp_op_context_t*)arg;
+    udp_op_handle_t handle;
+    udp_op_context_t* op_context = _op_context_claim((udp_op_handle_t)(uintptr_t)arg, &handle);
+    if (!op_context) {
+        // The lookup already timed out (and the result handler was called).
+        debug_printf(false, "UDP Op - DNS result after timeout ignored for hostname: '%s'\n", hostname);
+        return;
+    }
+    // Cancel the pending timeout for the DNS lookup.
+    cancel_alarm(op_context->timeout_alarm_id);
+    op_context->timeout_alarm_id = 0;
 
     pbuf_t* p = op_context->p;
     udp_sop_result_handler_fn op_result_handler = op_context->op_result_handler;
@@ -338,21 +510,25 @@ static void _udp_sop_dns_found(const char* hostname, const ip_addr_t* ipaddr, vo
 
     err_enum_t status = ERR_ABRT;
     if (ipaddr) {
+        if (!op_context->from_cache) {
+            _dns_cache_store(hostname, ipaddr);
+        }
         op_context->ipaddr = *ipaddr;
         // set up for receiving the result message and send the outgoing message
         op_context->udp_pcb = udp_new();
         if (op_context->udp_pcb) {
             // set up to receive a response and create a timeout.
-            udp_recv(op_context->udp_pcb, _udp_sop_recv, op_context);
+            udp_recv(op_context->udp_pcb, _udp_sop_recv, (void*)(uintptr_t)handle);
             status = udp_bind(op_context->udp_pcb, IP_ANY_TYPE, 0);
             if (status == ERR_OK) {
                 status = udp_sendto(op_context->udp_pcb, op_context->p, ipaddr, op_context->port);
                 if (status == ERR_OK) {
                     // Free this outgoing message PBUF
                     pbuf_free(p);
+                    op_context->p = NULL;
                     // Set up a timeout so we can free things up and call the handler even we don't receive a response.
                     uint32_t toms = (op_context->timeout_ms > 0 ? op_context->timeout_ms : UDP_SO_FAILSAFE_TO);
-                    op_context->timeout_alarm_id = add_alarm_in_ms(toms, _udp_sop_timeout_handler, op_context, true);
+                    op_context->timeout_alarm_id = add_alarm_in_ms(toms, _udp_sop_timeout_handler, (void*)(uintptr_t)handle, true);
                     debug_printf(true, "Set udp_single_operation timeout: %d  (%ums)\n", op_context->timeout_alarm_id, toms);
 
                     return;
@@ -375,14 +551,22 @@ static void _udp_sop_dns_found(const char* hostname, const ip_addr_t* ipaddr, vo
         error_printf(false, "UDP Op - DNS request failed for hostname: '%s'\n", hostname);
     }
     // If we get here it means that there was a problem. Free resources.
-    free(op_context);
+    if (op_context->udp_pcb) {
+        udp_remove(op_context->udp_pcb);
+    }
+    _op_context_free(op_context);
     // Call thier handler and give them thier PBUF back. They are set up to free one anyway.
     op_result_handler(status, p, handler_data);
 }
 
 // UDP operation data received for a single operation (udp_recv_fn)
 static void _udp_sop_recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_addr_t* addr, u16_t port) {
-    udp_op_context_t* op_context = (udp_op_context_t*)arg;
+    udp_op_context_t* op_context = _op_context_claim((udp_op_handle_t)(uintptr_t)arg, NULL);
+    if (!op_context) {
+        // The operation already timed out.
+        pbuf_free(p);
+        return;
+    }
 
     udp_sop_result_handler_fn op_result_handler = op_context->op_result_handler;
 
@@ -398,7 +582,7 @@ static void _udp_sop_recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_ad
     uint16_t rport = op_context->port;
     void* handler_data = op_context->result_handler_data;
 
-    free(op_context);
+    _op_context_free(op_context);
     udp_remove(pcb);
 
     // Do a sanity check on the response.
@@ -412,9 +596,12 @@ static void _udp_sop_recv(void* arg, struct udp_pcb* pcb, pbuf_t* p, const ip_ad
 
 // Called on timeout of a single operation (no message received) (alarm_callback_t)
 static int64_t _udp_sop_timeout_handler(alarm_id_t id, void* request_state) {
-    udp_op_context_t* op_context = (udp_op_context_t*)request_state;
+    udp_op_context_t* op_context = _op_context_claim((udp_op_handle_t)(uintptr_t)request_state, NULL);
+    if (!op_context) {
+        // The DNS result or the response came in first.
+        return 0;
+    }
 
-    cancel_alarm(id);
     error_printf(false, "UDP - Single operation, timeout waiting for response (id:%d timeout_id:%d)\n", id, op_context->timeout_alarm_id);
 
     pbuf_t* p = op_context->p;
@@ -422,11 +609,130 @@ static int64_t _udp_sop_timeout_handler(alarm_id_t id, void* request_state) {
 
     void* handler_data = op_context->result_handler_data;
     // Free the resources
-    udp_remove(op_context->udp_pcb);
-    free(op_context);
+    if (op_context->udp_pcb) {
+        udp_remove(op_context->udp_pcb);
+    }
+    _op_context_free(op_context);
 
-    // Call thier handler and give them thier PBUF back. They are set up to free one anyway.
+    // Call thier handler and give them thier PBUF back (if it wasn't sent). They are set up to free one anyway.
     op_result_handler(ERR_TIMEOUT, p, handler_data);
 
     return 0; // Don't reschedule this alarm.
 }
+
+// Start a UDP socket bind (WiFi is connected)
+static err_enum_t _udp_socket_bind_start(const char* hostname, uint16_t port, udp_bind_handler_fn bind_handler) {
+    err_enum_t status = ERR_INPROGRESS;
+
+    udp_op_handle_t handle;
+    udp_op_context_t* op_context = _op_context_alloc(&handle);
+    if (!op_context) {
+        error_printf(false, "UDP Bind - no operation context available\n");
+        return ERR_MEM;
+    }
+
+    op_context->port = port;
+    op_context->bind_handler = bind_handler;
+
+    // Set up a timeout so we can call the bind handler even if the DNS lookup fails.
+    op_context->timeout_alarm_id = add_alarm_in_ms(DNS_TIMEOUT, _udp_bind_dns_timeout_handler, (void*)(uintptr_t)handle, true);
+    debug_printf(true, "Set udp_socket_bind DNS timeout: %d  (%ums)\n", op_context->timeout_alarm_id, DNS_TIMEOUT);
+    op_context->from_cache = _dns_cache_lookup(hostname, &op_context->ipaddr);
+    if (op_context->from_cache) {
+        status = ERR_OK;
+    }
+    else {
+        cyw43_arch_lwip_begin();
+        {
+            status = dns_gethostbyname_addrtype(hostname, &op_context->ipaddr, _udp_bind_dns_found, (void*)(uintptr_t)handle, LWIP_DNS_ADDRTYPE_IPV4_IPV6);
+        }
+        cyw43_arch_lwip_end();
+    }
+
+    if (status == ERR_OK) {
+        // The address is ready. Continue with our processing...
+        _udp_bind_dns_found(hostname, &op_context->ipaddr, (void*)(uintptr_t)handle);
+    }
+    else if (status != ERR_INPROGRESS) { // ERR_INPROGRESS means expect a callback
+        error_printf(false, "DNS request failed\n");
+        if (_op_context_claim(handle, NULL)) {
+            cancel_alarm(op_context->timeout_alarm_id);
+            _op_context_free(op_context);
+        }
+    }
+
+    return (status);
+}
+
+// Start connecting to WiFi
+static void _wifi_connect_start(uint32_t now) {
+    if (!*_wifi_ssid) {
+        // Not configured.
+        return;
+    }
+    if (cyw43_arch_wifi_connect_async(_wifi_ssid, _wifi_password, CYW43_AUTH_WPA2_AES_PSK)) {
+        error_printf(false, "WiFi - Could not start connecting\n");
+        _wifi_retry_wait(now);
+        return;
+    }
+    _wifi_state = _WIFI_CONNECTING;
+    _wifi_connect_ts = now;
+}
+
+// Leave the network (and stop a join that is in progress), so that a retry starts clean
+static void _wifi_leave(void) {
+    cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+}
+
+// Wait to retry connecting, doubling the wait for the next time
+static void _wifi_retry_wait(uint32_t now) {
+    _wifi_connected = false;
+    _wifi_state = _WIFI_RETRY_WAIT;
+    _wifi_retry_ts = now + _wifi_retry_ms;
+    _wifi_retry_ms = (_wifi_retry_ms < (WIFI_RETRY_MAX_MS / 2) ? (_wifi_retry_ms * 2) : WIFI_RETRY_MAX_MS);
+}
+
+// Check the link status and move the connection along
+static void _wifi_update(uint32_t now, bool post) {
+    int link_status = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+    if (link_status != _wifi_link_status) {
+        _wifi_link_status = link_status;
+        if (post) {
+            cmt_msg_t msg;
+            msg.id = MSG_WIFI_CONN_STATUS_UPDATE;
+            msg.data.status = link_status;
+            postUIMsgNoWait(&msg);
+        }
+    }
+    switch (_wifi_state) {
+        case _WIFI_CONNECTING:
+            if (CYW43_LINK_UP == link_status) {
+                _wifi_connected = true;
+                _wifi_state = _WIFI_CONNECTED;
+                _wifi_retry_ms = WIFI_RETRY_MIN_MS;
+                // Resolve the cached hosts that need it now, rather than when they are used.
+                _dns_cache_refresh();
+            }
+            else if (link_status < 0 || (now - _wifi_connect_ts) > WIFI_CONNECT_TIMEOUT_MS) {
+                // CYW43_LINK_FAIL, CYW43_LINK_NONET, CYW43_LINK_BADAUTH, or taking too long
+                error_printf(false, "WiFi - Failed to connect (%d). Retry in %ums\n", link_status, _wifi_retry_ms);
+                _wifi_leave();
+                _wifi_retry_wait(now);
+            }
+            break;
+        case _WIFI_CONNECTED:
+            if (link_status != CYW43_LINK_UP) {
+                error_printf(false, "WiFi - Connection lost (%d). Retry in %ums\n", link_status, _wifi_retry_ms);
+                _wifi_leave();
+                _wifi_retry_wait(now);
+            }
+            break;
+        case _WIFI_RETRY_WAIT:
+            if ((int32_t)(now - _wifi_retry_ts) >= 0) {
+                _wifi_connect_start(now);
+            }
+            break;
+        case _WIFI_IDLE:
+            break;
+    }
+}
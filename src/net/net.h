@@ -25,6 +25,16 @@
 #define NET_SSID_MAX_LEN 32
 #define NET_PASSWORD_MAX_LEN 128
 #define NET_URL_MAX_LEN 2048
+#define NET_HOSTNAME_MAX_LEN 255
+
+#define NET_DNS_CACHE_ENTRIES 4
+#define NET_DNS_CACHE_NAME_MAX_LEN 63           // Longer host names aren't cached
+#define NET_DNS_CACHE_TTL_MS (10 * 60 * 1000)   // How long a resolved address is used
+
+#define WIFI_CHECK_PERIOD_MS 250            // How often the link status is checked
+#define WIFI_CONNECT_TIMEOUT_MS (15 * 1000) // Time allowed for a connection attempt
+#define WIFI_RETRY_MIN_MS (1 * 1000)        // First wait before retrying a failed connection
+#define WIFI_RETRY_MAX_MS (64 * 1000)       // Limit for the (doubling) wait before retrying
 
 typedef struct pbuf pbuf_t;
 
@@ -66,18 +76,25 @@ int host_from_hostport(char* buf, uint32_t maxlen, const char* host_and_port);
 uint16_t port_from_hostport(const char* host_and_port, uint16_t port_default);
 
 /**
- * @brief Make a NTP network call and use the result to update the board's RTC.
+ * @brief Resolve a host name in the background, keeping the address in the DNS cache.
  * @ingroup wire
  *
- * @param tz_offset Hours offset from UTC. For a timezone like UTC−09:30, use a value of -9.5
- * @returns ERR_OK (0) on success
+ * This doesn't wait. The host is kept in the cache (until it is replaced by others
+ * that are used more recently), and its address is resolved again when it expires
+ * and when WiFi (re)connects, so a UDP operation or bind with it won't wait for DNS.
+ *
+ * @param hostname The fully qualified name of the host.
+ * @returns ERR_OK if the host is in the cache, ERR_ARG if the name is too long to be cached.
  */
-err_enum_t network_update_rtc(float tz_offset);
+err_enum_t net_dns_prefetch(const char* hostname);
 
 /**
  * @brief Send a UDP message and process the response message.
  * @ingroup wire
  *
+ * If WiFi isn't connected, the bind is held until it is (and a connection is
+ * started if needed). Only one bind is held - a later one replaces it.
+ *
  * @param hostname The fully qualified name of the host. This will be used to do a DNS lookup to obtain an IP address.
  * @param port A port number to use when sending the request.
  * @param bind_handler A function to be called after the hostname is resolved and a UDP socket is bound.
@@ -86,6 +103,12 @@ err_enum_t network_update_rtc(float tz_offset);
  */
 err_enum_t udp_socket_bind(const char* hostname, uint16_t port, udp_bind_handler_fn bind_handler);
 
+/**
+ * @brief Cancel a bind that is waiting for WiFi to connect.
+ * @ingroup wire
+ */
+void udp_socket_bind_cancel();
+
 /**
  * @brief Perform a single UDP operation, consisting of sending a message and getting a response message.
  * @ingroup wire
@@ -106,10 +129,37 @@ err_enum_t udp_single_operation(const char* hostname, uint16_t port, pbuf_t* p,
  * @brief Connect to WiFi (if needed).
  * @ingroup wire
  *
- * @returns true if connected, false if failed to connect.
+ * This doesn't wait. If not connected (or connecting) a connection is started,
+ * and is then followed by `wifi_connection_check`. A connection that is waiting
+ * to retry (after a failure) isn't started early.
+ *
+ * @returns true if connected, false if not (yet) connected.
  */
 bool wifi_connect();
 
+/**
+ * @brief Connect to WiFi, waiting for the connection.
+ * @ingroup wire
+ *
+ * This is only for use during start-up, before the message loops are running
+ * (status messages aren't posted).
+ *
+ * @param timeout_ms The maximum time to wait.
+ * @returns true if connected.
+ */
+bool wifi_connect_wait(uint32_t timeout_ms);
+
+/**
+ * @brief Check the WiFi link and manage the connection. Called from the back-end idle processing.
+ * @ingroup wire
+ *
+ * The link status is checked (at most every WIFI_CHECK_PERIOD_MS), and a
+ * MSG_WIFI_CONN_STATUS_UPDATE is posted to the UI when it changes. A connection that fails
+ * or is lost is retried, waiting longer after each failure (up to WIFI_RETRY_MAX_MS). When
+ * the link comes up, a bind that is waiting for it is started.
+ */
+void wifi_connection_check();
+
 /**
  * @brief Status of WiFi connection.
  * @ingroup wire
@@ -0,0 +1,376 @@
+/**
+ * NTP client and wall clock.
+ *
+ * For each sample: t1 is the local time the request was sent, t2 is the time the
+ * server received it, t3 is the time the server sent the response, and t4 is the
+ * local time it was received. The offset (NTP time - local time) is
+ * ((t2 - t1) + (t3 - t4)) / 2, and the round trip delay is (t4 - t1) - (t3 - t2).
+ * The local send time is put in the request's transmit timestamp, the server
+ * returns it as the originate timestamp, so responses can be matched to requests.
+ *
+ * The wall clock is: base_wall + d + (d * freq) + slewed, where d is the local time
+ * since base_local, and slewed is the part of the correction (slew) that has been
+ * applied by then, at _NTP_SLEW_PPM. A correction rebases the clock to the time
+ * of the batch, so the clock is continuous (and monotonic) unless it is stepped.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "ntp.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mkboard.h"
+#include "net.h"
+#include "util.h"
+
+#include "hardware/rtc.h"
+#include "hardware/sync.h"
+#include "pico/cyw43_arch.h"
+#include "pico/mutex.h"
+#include "pico/time.h"
+
+#define _NTP_PORT 123
+#define _NTP_TIMEOUT_MS (5 * 1000)
+#define _NTP_MSG_LEN 48
+#define _NTP_DELTA 2208988800u          // Seconds between 1 Jan 1900 and 1 Jan 1970
+#define _NTP_SAMPLE_SPACING_MS 2000     // Time between the requests of a batch (servers ask for at least 2 seconds)
+#define _NTP_RETRY_MS (30 * 1000)       // Time until a batch that failed is tried again
+#define _NTP_STEP_US 128000             // Errors larger than this are stepped rather than slewed (as ntpd does)
+#define _NTP_SLEW_PPM 500               // Rate that a correction is slewed at
+#define _NTP_FREQ_MAX_PPB 500000        // Limit for the drift correction
+#define _NTP_FREQ_INTERVAL_MIN_US (60 * 1000000LL) // Shortest time between batches used to measure the drift
+#define _NTP_POLL_UP_US 2000            // Poll less often if the error is less than this
+#define _NTP_POLL_DOWN_US 20000         // Poll more often if the error is more than this
+#define _NTP_RTC_SET_WINDOW_US 100000   // Set the RTC within this of the start of a second
+
+typedef struct _NTP_SAMPLE_ {
+    int64_t offset_us;
+    int32_t delay_us;
+    uint64_t local_us;          // Local time the offset applies to (the middle of the round trip)
+} _ntp_sample_t;
+
+static bool _initialized = false;
+// The clock is read from both cores.
+auto_init_mutex(ntp_mutex);
+
+// Clock (guarded by the lock)
+static bool _synced = false;
+static uint64_t _base_local_us;
+static int64_t _base_wall_us;
+static int32_t _freq_ppb;
+static int64_t _slew_us;
+
+// Batch
+static _ntp_sample_t _samples[NTP_BATCH_SAMPLES];
+static volatile int _nsamples;
+static int _nsent;
+static bool _batch_active = false;
+static volatile bool _request_pending = false;
+static volatile uint64_t _t1_us;            // Local time the pending request was sent
+static uint32_t _ts_sent_ms;
+static uint32_t _ts_batch_ms;               // When the next batch is due
+
+// Drift measurement
+static bool _prev_valid = false;
+static uint64_t _prev_local_us;
+static int64_t _prev_wall_us;
+
+static bool _rtc_set_pending = false;
+static ntp_stats_t _stats;
+
+
+/**
+ * @brief Wall clock time for a local time. Must be called with the lock held (and the clock set).
+ */
+static int64_t _wall_at(uint64_t local_us) {
+    int64_t d = (int64_t)(local_us - _base_local_us);
+    int64_t w = _base_wall_us + d + ((d * _freq_ppb) / 1000000000);
+    int64_t s = (d > 0 ? (d * _NTP_SLEW_PPM) / 1000000 : 0);
+    if (_slew_us >= 0) {
+        w += (s < _slew_us ? s : _slew_us);
+    }
+    else {
+        w -= (s < -_slew_us ? s : -_slew_us);
+    }
+    return (w);
+}
+
+/**
+ * @brief Convert an NTP timestamp (seconds since 1900 and fraction, big-endian) to microseconds since 1970.
+ */
+static int64_t _ntp_ts_to_us(const uint8_t* ts) {
+    uint32_t secs = (uint32_t)ts[0] << 24 | (uint32_t)ts[1] << 16 | (uint32_t)ts[2] << 8 | ts[3];
+    uint32_t frac = (uint32_t)ts[4] << 24 | (uint32_t)ts[5] << 16 | (uint32_t)ts[6] << 8 | ts[7];
+    return (((int64_t)(secs - _NTP_DELTA) * 1000000) + (((uint64_t)frac * 1000000) >> 32));
+}
+
+/**
+ * @brief Correct the clock with a measured wall time.
+ *
+ * @param local_us The local time of the measurement.
+ * @param wall_us The wall time (from NTP) at that local time.
+ * @return The error that was found (0 if the clock wasn't set).
+ */
+static int64_t _clock_correct(uint64_t local_us, int64_t wall_us) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&ntp_mutex);
+    int64_t current = (_synced ? _wall_at(local_us) : wall_us);
+    int64_t err = wall_us - current;
+    bool step = (!_synced || llabs(err) > _NTP_STEP_US);
+    // Measure the drift of the local timer from the change in the NTP time since the last batch.
+    if (!step && _prev_valid && (int64_t)(local_us - _prev_local_us) >= _NTP_FREQ_INTERVAL_MIN_US) {
+        int64_t dl = (int64_t)(local_us - _prev_local_us);
+        int64_t dw = wall_us - _prev_wall_us;
+        int64_t freq = ((dw - dl) * 1000000000) / dl;
+        _freq_ppb += (int32_t)((freq - _freq_ppb) / 4);
+        if (_freq_ppb > _NTP_FREQ_MAX_PPB) {
+            _freq_ppb = _NTP_FREQ_MAX_PPB;
+        }
+        else if (_freq_ppb < -_NTP_FREQ_MAX_PPB) {
+            _freq_ppb = -_NTP_FREQ_MAX_PPB;
+        }
+    }
+    _prev_valid = true;
+    _prev_local_us = local_us;
+    _prev_wall_us = wall_us;
+    _base_local_us = local_us;
+    if (step) {
+        _base_wall_us = wall_us;
+        _slew_us = 0;
+        _synced = true;
+        _stats.steps++;
+    }
+    else {
+        // Continue from where the clock is, and slew out the error.
+        _base_wall_us = current;
+        _slew_us = err;
+    }
+    mutex_exit(&ntp_mutex);
+    restore_interrupts(flags);
+
+    return (err);
+}
+
+/**
+ * @brief Process the samples of a completed batch.
+ */
+static void _batch_process(uint32_t now) {
+    int n = _nsamples;
+    if (0 == n) {
+        _ts_batch_ms = now + _NTP_RETRY_MS;
+        return;
+    }
+    // Use the samples with the smallest delays (the others were held up along the way, so are less accurate).
+    for (int i = 1; i < n; i++) {
+        _ntp_sample_t s = _samples[i];
+        int j = i - 1;
+        while (j >= 0 && _samples[j].delay_us > s.delay_us) {
+            _samples[j + 1] = _samples[j];
+            j--;
+        }
+        _samples[j + 1] = s;
+    }
+    int use = (n + 1) / 2;
+    int64_t offset = 0;
+    int64_t local = 0;
+    for (int i = 0; i < use; i++) {
+        offset += _samples[i].offset_us;
+        local += (int64_t)(_samples[i].local_us - _samples[0].local_us);
+    }
+    offset /= use;
+    uint64_t local_us = _samples[0].local_us + (uint64_t)(local / use);
+    bool was_synced = _synced;
+    int64_t err = _clock_correct(local_us, (int64_t)local_us + offset);
+    // Poll less often when the clock is staying close, more often when it isn't.
+    if (was_synced && llabs(err) < _NTP_POLL_UP_US && _stats.poll_s < NTP_POLL_MAX_S) {
+        _stats.poll_s *= 2;
+    }
+    else if (llabs(err) > _NTP_POLL_DOWN_US && _stats.poll_s > NTP_POLL_MIN_S) {
+        _stats.poll_s /= 2;
+    }
+    _stats.offset_us = err;
+    _stats.delay_us = _samples[0].delay_us;
+    _stats.batches++;
+    _stats.ts_sync_ms = now;
+    _ts_batch_ms = now + (_stats.poll_s * 1000);
+    _rtc_set_pending = true;
+}
+
+/**
+ * @brief Set the RTC from the wall clock, if it is at the start of a second.
+ */
+static void _rtc_set_check(float tz_offset) {
+    int64_t wall_us = (int64_t)ntp_clock_us();
+    if (0 == wall_us) {
+        return;
+    }
+    wall_us += (int64_t)(3600.0 * 1000000.0 * tz_offset);
+    if ((wall_us % 1000000) >= _NTP_RTC_SET_WINDOW_US) {
+        // Wait for the start of a second, so the RTC isn't set up to a second behind.
+        return;
+    }
+    _rtc_set_pending = false;
+    time_t secs = (time_t)(wall_us / 1000000);
+    struct tm* t = gmtime(&secs);
+    datetime_t dt;
+    dt.day = t->tm_mday;
+    dt.month = t->tm_mon + 1;
+    dt.year = t->tm_year + 1900;
+    dt.dotw = t->tm_wday;
+    dt.hour = t->tm_hour;
+    dt.min = t->tm_min;
+    dt.sec = t->tm_sec;
+    rtc_set_datetime(&dt);
+}
+
+// NTP response received (or timed out) (udp_sop_result_handler_fn)
+static void _response_handler(err_enum_t status, pbuf_t* p, void* handler_data) {
+    uint64_t t4 = time_us_64();
+    bool valid = false;
+    if (ERR_OK == status && p && p->tot_len >= _NTP_MSG_LEN) {
+        uint8_t msg[_NTP_MSG_LEN];
+        pbuf_copy_partial(p, msg, _NTP_MSG_LEN, 0);
+        uint8_t mode = msg[0] & 0x7;
+        uint8_t stratum = msg[1];
+        uint64_t orig;
+        memcpy(&orig, &msg[24], sizeof(orig));
+        if (mode == 0x4 && stratum != 0 && orig == _t1_us && _nsamples < NTP_BATCH_SAMPLES) {
+            int64_t t1 = (int64_t)_t1_us;
+            int64_t t2 = _ntp_ts_to_us(&msg[32]);
+            int64_t t3 = _ntp_ts_to_us(&msg[40]);
+            _ntp_sample_t* s = &_samples[_nsamples];
+            s->offset_us = ((t2 - t1) + (t3 - (int64_t)t4)) / 2;
+            s->delay_us = (int32_t)(((int64_t)t4 - t1) - (t3 - t2));
+            s->local_us = (uint64_t)(t1 + (((int64_t)t4 - t1) / 2));
+            _nsamples++;
+            _stats.samples++;
+            valid = true;
+        }
+    }
+    if (!valid) {
+        _stats.failures++;
+    }
+    if (p && p->ref > 0) {
+        pbuf_free(p);
+    }
+    _request_pending = false;
+}
+
+/**
+ * @brief Send the next request of the batch.
+ */
+static void _request_send(uint32_t now) {
+    _nsent++;
+    _ts_sent_ms = now;
+    pbuf_t* p = pbuf_alloc(PBUF_TRANSPORT, _NTP_MSG_LEN, PBUF_POOL);
+    if (!p) {
+        _stats.failures++;
+        return;
+    }
+    uint8_t* req = (uint8_t*)p->payload;
+    memset(req, 0, _NTP_MSG_LEN);
+    req[0] = 0x1b; // NTP Request: Version=3 Mode=3 (client)
+    // Put the local time in the transmit timestamp. The server returns it as the originate timestamp.
+    uint64_t t1 = time_us_64();
+    memcpy(&req[40], &t1, sizeof(t1));
+    _t1_us = t1;
+    // Set pending first, as the response could be handled before this returns.
+    _request_pending = true;
+    err_enum_t status = udp_single_operation(NTP_SERVER, _NTP_PORT, p, _NTP_TIMEOUT_MS, _response_handler, NULL);
+    if (status != ERR_OK && status != ERR_INPROGRESS) {
+        // Operation initialization failed. Need to free the PBUF we created...
+        _request_pending = false;
+        _stats.failures++;
+        pbuf_free(p);
+    }
+}
+
+
+uint64_t ntp_clock_us() {
+    uint64_t wall_us = 0;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&ntp_mutex);
+    if (_synced) {
+        wall_us = (uint64_t)_wall_at(time_us_64());
+    }
+    mutex_exit(&ntp_mutex);
+    restore_interrupts(flags);
+
+    return (wall_us);
+}
+
+bool ntp_clock_synced() {
+    return (_synced);
+}
+
+void ntp_poll(float tz_offset) {
+    uint32_t now = now_ms();
+
+    if (_rtc_set_pending) {
+        _rtc_set_check(tz_offset);
+    }
+    if (_request_pending) {
+        return;
+    }
+    if (!_batch_active) {
+        if ((int32_t)(now - _ts_batch_ms) < 0) {
+            return;
+        }
+        if (!wifi_connected()) {
+            _ts_batch_ms = now + _NTP_RETRY_MS;
+            return;
+        }
+        _batch_active = true;
+        _nsamples = 0;
+        _nsent = 0;
+    }
+    // The first batch is a single sample, so the clock is set quickly. The full batches refine it.
+    int batch_samples = (_synced ? NTP_BATCH_SAMPLES : 1);
+    if (_nsent < batch_samples) {
+        if (0 == _nsent || (now - _ts_sent_ms) >= _NTP_SAMPLE_SPACING_MS) {
+            _request_send(now);
+        }
+        return;
+    }
+    _batch_active = false;
+    _batch_process(now);
+}
+
+bool ntp_sync_wait(float tz_offset, uint32_t timeout_ms) {
+    uint32_t start = now_ms();
+    while ((now_ms() - start) < timeout_ms) {
+        ntp_poll(tz_offset);
+        if (_synced && !_rtc_set_pending) {
+            return (true);
+        }
+        sleep_ms(5);
+    }
+    return (_synced);
+}
+
+void ntp_stats(ntp_stats_t* stats) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&ntp_mutex);
+    memcpy(stats, &_stats, sizeof(ntp_stats_t));
+    stats->synced = _synced;
+    stats->freq_ppb = _freq_ppb;
+    stats->slew_us = _slew_us;
+    mutex_exit(&ntp_mutex);
+    restore_interrupts(flags);
+}
+
+void ntp_module_init() {
+    assert(!_initialized);
+    _initialized = true;
+
+    memset(&_stats, 0, sizeof(ntp_stats_t));
+    _stats.poll_s = NTP_POLL_MIN_S;
+    _ts_batch_ms = now_ms();
+    // Resolve the server now, so the requests aren't held up by DNS (which would add to the delay).
+    net_dns_prefetch(NTP_SERVER);
+}
@@ -0,0 +1,115 @@
+/**
+ * NTP client and wall clock.
+ *
+ * Keeps a microsecond resolution (UTC) wall clock, based on the local microsecond
+ * timer (`time_us_64`), in step with NTP. The NTP server is polled in batches
+ * of a few samples. The offset and round trip delay are computed for each sample,
+ * and the samples with the smallest delays are averaged. The drift of the local
+ * timer against NTP is tracked between batches and corrected for. Small corrections
+ * are slewed (applied gradually) so the clock doesn't jump, and the clock is only
+ * stepped when it is first set or is far off.
+ *
+ * The RTC (which has a resolution of a second) is set from the wall clock (with
+ * the timezone offset applied) on a second boundary after each batch.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _NTP_H_
+#define _NTP_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define NTP_SERVER "pool.ntp.org"
+
+/**
+ * @brief Number of samples (requests) in a batch.
+ * @ingroup wire
+ */
+#define NTP_BATCH_SAMPLES 4
+
+#define NTP_POLL_MIN_S 64           // Shortest time between batches
+#define NTP_POLL_MAX_S 1024         // Longest time between batches
+#define NTP_SYNC_WAIT_MS 3000       // Time to wait for the clock to be set at startup
+
+/**
+ * @brief NTP client statistics.
+ * @ingroup wire
+ */
+typedef struct _NTP_STATS_ {
+    bool synced;                // The wall clock has been set
+    int64_t offset_us;          // Error of the wall clock found by the last batch (before correcting)
+    int32_t delay_us;           // Round trip delay of the best sample of the last batch
+    int32_t freq_ppb;           // Drift correction for the local timer (parts per billion)
+    int64_t slew_us;            // Correction that is being slewed
+    uint32_t poll_s;            // Time between batches
+    uint32_t batches;           // Batches completed
+    uint32_t samples;           // Samples received
+    uint32_t failures;          // Requests that failed or timed out (or had an invalid response)
+    uint32_t steps;             // Times the clock was stepped (rather than slewed)
+    uint32_t ts_sync_ms;        // When the last batch completed
+} ntp_stats_t;
+
+/**
+ * @brief Get the wall clock time.
+ * @ingroup wire
+ *
+ * This can be called from either core.
+ *
+ * @return Microseconds since 1 Jan 1970 UTC, or 0 if the clock hasn't been set.
+ */
+extern uint64_t ntp_clock_us();
+
+/**
+ * @brief Indicate if the wall clock has been set from NTP.
+ * @ingroup wire
+ */
+extern bool ntp_clock_synced();
+
+/**
+ * @brief Run the NTP client.
+ * @ingroup wire
+ *
+ * This sends the requests of a batch (a couple of seconds apart) when one is due,
+ * processes the batch when it is complete, and sets the RTC. It is called from
+ * the backend idle processing.
+ *
+ * @param tz_offset Hours offset from UTC for the RTC. For a timezone like UTC−09:30, use a value of -9.5
+ */
+extern void ntp_poll(float tz_offset);
+
+/**
+ * @brief Set the wall clock (and the RTC) and wait for it to be done.
+ * @ingroup wire
+ *
+ * This is for use during startup, before the message system is running (it sleeps).
+ *
+ * @param tz_offset Hours offset from UTC for the RTC.
+ * @param timeout_ms The longest time to wait.
+ * @return true if the clock is set.
+ */
+extern bool ntp_sync_wait(float tz_offset, uint32_t timeout_ms);
+
+/**
+ * @brief Get the NTP client statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void ntp_stats(ntp_stats_t* stats);
+
+/**
+ * @brief Initialize the NTP client module.
+ * @ingroup wire
+ */
+extern void ntp_module_init();
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _NTP_H_
@@ -0,0 +1,93 @@
+/**
+ * Pool of operation contexts with generation-tagged handles.
+ *
+ * A handle is the slot's generation (upper bits) and index (low 8 bits).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#include "oppool.h"
+
+#include "pico/mutex.h"
+#include "hardware/sync.h"
+
+#if (OPPOOL_SIZE > 0xFF)
+#error "OPPOOL_SIZE must fit in the 8 bit handle index"
+#endif
+
+typedef struct _OPPOOL_SLOT_ {
+    bool in_use;
+    uint16_t gen;
+} _oppool_slot_t;
+
+// The DNS callback runs on the core that owns the CYW43, the alarms on the core that set them.
+auto_init_mutex(oppool_mutex);
+
+static _oppool_slot_t _slots[OPPOOL_SIZE];
+
+static inline oppool_handle_t _handle(int i) {
+    return (((oppool_handle_t)_slots[i].gen << 8) | (oppool_handle_t)i);
+}
+
+
+int oppool_alloc(oppool_handle_t* handle) {
+    int index = -1;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&oppool_mutex);
+    for (int i = 0; i < OPPOOL_SIZE; i++) {
+        if (!_slots[i].in_use) {
+            _slots[i].in_use = true;
+            *handle = _handle(i);
+            index = i;
+            break;
+        }
+    }
+    mutex_exit(&oppool_mutex);
+    restore_interrupts(flags);
+
+    return (index);
+}
+
+int oppool_claim(oppool_handle_t handle, oppool_handle_t* next) {
+    int index = -1;
+    int i = (int)(handle & 0xFF);
+    uint16_t gen = (uint16_t)(handle >> 8);
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&oppool_mutex);
+    if (i < OPPOOL_SIZE && _slots[i].in_use && _slots[i].gen == gen) {
+        _slots[i].gen++;
+        if (next) {
+            *next = _handle(i);
+        }
+        index = i;
+    }
+    mutex_exit(&oppool_mutex);
+    restore_interrupts(flags);
+
+    return (index);
+}
+
+void oppool_free(int index) {
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&oppool_mutex);
+    _slots[index].gen++;
+    _slots[index].in_use = false;
+    mutex_exit(&oppool_mutex);
+    restore_interrupts(flags);
+}
+
+int oppool_in_use() {
+    int n = 0;
+    uint32_t flags = save_and_disable_interrupts();
+    mutex_enter_blocking(&oppool_mutex);
+    for (int i = 0; i < OPPOOL_SIZE; i++) {
+        if (_slots[i].in_use) {
+            n++;
+        }
+    }
+    mutex_exit(&oppool_mutex);
+    restore_interrupts(flags);
+
+    return (n);
+}
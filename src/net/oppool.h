@@ -0,0 +1,83 @@
+/**
+ * Pool of operation contexts with generation-tagged handles.
+ *
+ * A fixed number of operations (a UDP bind or single operation) can be in progress
+ * at once. Each has a slot in the pool. Callbacks for an operation (DNS result,
+ * receive, and timeout) are given a handle (the slot index and a generation number)
+ * rather than a pointer to the slot. The generation is advanced when a callback
+ * claims a step of the operation, and when the slot is freed. So, of two callbacks
+ * racing for the same step (a DNS result that arrives after the timeout, or the
+ * timeout after the DNS result), only the first gets the slot. The other finds its
+ * handle stale and does nothing. A handle for a freed slot stays stale when the
+ * slot is reused.
+ *
+ * The pool only manages the slots. The user keeps the context for each slot
+ * (indexed by the slot index). The pool can be used from either core and from
+ * IRQ handlers (alarm callbacks).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+*/
+#ifndef _MK_OPPOOL_H_
+#define _MK_OPPOOL_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of operations that can be in progress at once.
+ * @ingroup wire
+ */
+#define OPPOOL_SIZE 4
+
+/**
+ * @brief Handle for the current step of an operation (slot index and generation).
+ * @ingroup wire
+ */
+typedef uint32_t oppool_handle_t;
+
+/**
+ * @brief Get a free slot.
+ * @ingroup wire
+ *
+ * @param handle Set to the handle for the first step of the operation.
+ * @return The slot index, or -1 if none are free.
+ */
+extern int oppool_alloc(oppool_handle_t* handle);
+
+/**
+ * @brief Claim the current step of an operation.
+ * @ingroup wire
+ *
+ * The handle (and any copies of it) becomes stale.
+ *
+ * @param handle The handle for the step.
+ * @param next If not NULL, set to the handle for the callbacks of the next step.
+ * @return The slot index, or -1 if the handle is stale (the step was already claimed or the slot was freed).
+ */
+extern int oppool_claim(oppool_handle_t handle, oppool_handle_t* next);
+
+/**
+ * @brief Return a slot to the pool.
+ * @ingroup wire
+ *
+ * Any handles for it become stale.
+ *
+ * @param index The slot index.
+ */
+extern void oppool_free(int index);
+
+/**
+ * @brief The number of slots in use.
+ * @ingroup wire
+ */
+extern int oppool_in_use();
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _MK_OPPOOL_H_
@@ -11,6 +11,42 @@
 #include "system_defs.h"
 #include "spi_ops.h"
 
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+static int _display_dma_chan = -1;
+static volatile bool _display_dma_active = false;
+static bool _display_spi_16 = false;
+
+/**
+ * DMA IRQ handler (shared) for the display channel. Signals that the DMA is done
+ * (the SPI may still be sending the last frames from its FIFO).
+ */
+static void _display_dma_irq_handler(void) {
+    if (_display_dma_chan >= 0 && dma_channel_get_irq1_status(_display_dma_chan)) {
+        dma_channel_acknowledge_irq1(_display_dma_chan);
+        _display_dma_active = false;
+    }
+}
+
+/**
+ * Start a DMA transfer of 16 bit values to the display.
+ */
+static void _display_dma_start(const uint16_t* src, size_t len, bool incr) {
+    spi_display_dma_wait();
+    if (!_display_spi_16) {
+        spi_set_format(SPI_DISPLAY_DEVICE, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+        _display_spi_16 = true;
+    }
+    dma_channel_config c = dma_channel_get_default_config(_display_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_dreq(&c, spi_get_dreq(SPI_DISPLAY_DEVICE, true));
+    channel_config_set_read_increment(&c, incr);
+    channel_config_set_write_increment(&c, false);
+    _display_dma_active = true;
+    dma_channel_configure(_display_dma_chan, &c, &spi_get_hw(SPI_DISPLAY_DEVICE)->dr, src, len, true);
+}
+
 /**
  * Make sure we have control of the SPI for one or more operations.
  * `spi_end` must be called when the SPI is done being used.
@@ -85,6 +121,48 @@ extern int spi_display_write16_buf(const uint16_t* buf, size_t len) {
     return (spi_write16_buf(SPI_DISPLAY_DEVICE, buf, len));
 }
 
+extern bool spi_display_dma_busy(void) {
+    return (_display_dma_active || (_display_spi_16 && spi_is_busy(SPI_DISPLAY_DEVICE)));
+}
+
+extern void spi_display_dma_init(void) {
+    if (_display_dma_chan >= 0) {
+        return;
+    }
+    _display_dma_chan = dma_claim_unused_channel(true);
+    // The SD card uses DMA_IRQ_0, so use IRQ 1 (shared, in case anything else wants it)
+    irq_add_shared_handler(DMA_IRQ_1, _display_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    dma_channel_set_irq1_enabled(_display_dma_chan, true);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+extern void spi_display_dma_wait(void) {
+    while (_display_dma_active) {
+        tight_loop_contents();
+    }
+    if (_display_spi_16) {
+        // Let the last frames go out of the FIFO
+        while (spi_is_busy(SPI_DISPLAY_DEVICE)) {
+            tight_loop_contents();
+        }
+        // Nothing was read during the transfer, so drain the RX FIFO and clear the overrun.
+        while (spi_is_readable(SPI_DISPLAY_DEVICE)) {
+            (void)spi_get_hw(SPI_DISPLAY_DEVICE)->dr;
+        }
+        spi_get_hw(SPI_DISPLAY_DEVICE)->icr = SPI_SSPICR_RORIC_BITS;
+        spi_set_format(SPI_DISPLAY_DEVICE, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+        _display_spi_16 = false;
+    }
+}
+
+extern void spi_display_fill16_dma(const uint16_t* value, size_t len) {
+    _display_dma_start(value, len, false);
+}
+
+extern void spi_display_write16_buf_dma(const uint16_t* buf, size_t len) {
+    _display_dma_start(buf, len, true);
+}
+
 extern void spi_touch_begin() {
     spi_begin(SPI_TOUCH_DEVICE);
     gpio_put(SPI_CS_TOUCH, SPI_CS_ENABLE);
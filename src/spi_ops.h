@@ -56,6 +56,22 @@ extern int spi_write16_buf(spi_inst_t* spi, const uint16_t* buf, size_t len);
 extern int spi_display_write16_buf(const uint16_t* buf, size_t len);
 extern int spi_touch_write16_buf(const uint16_t* buf, size_t len);
 
+/**
+ * DMA transfers to the display.
+ *
+ * The SPI is switched to 16 bit frames and a DMA channel feeds it from the buffer
+ * (or repeats a single value for a fill). These return once the transfer is started.
+ * The end of the DMA is signalled by an interrupt. `spi_display_dma_wait` waits for it
+ * and for the SPI to finish shifting out the last frames, then puts the SPI back
+ * to 8 bit frames. The buffer (or fill value) must not be changed until then, and
+ * the chip select must be held.
+ */
+extern bool spi_display_dma_busy(void);
+extern void spi_display_dma_init(void);
+extern void spi_display_dma_wait(void);
+extern void spi_display_fill16_dma(const uint16_t* value, size_t len);
+extern void spi_display_write16_buf_dma(const uint16_t* buf, size_t len);
+
 #ifdef __cplusplus
  }
 #endif
@@ -0,0 +1,193 @@
+/**
+ * Cooperative Multi-Tasking messages for the host.
+ *
+ * A posted message is copied into the queue, as the SDK queue does. A blocking post
+ * to a full queue would never return on one thread, so it is a failure (panic).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "cmt_host.h"
+
+#include <string.h>
+
+#include "mkboard.h"
+#include "multicore.h"
+
+#define _SCHEDULED_MESSAGES_MAX 16
+#define _SMD_FREE_INDICATOR (-1)
+
+typedef struct _host_queue_ {
+    cmt_msg_t msgs[CMT_HOST_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t tail;
+} _host_queue_t;
+
+typedef struct _scheduled_msg_data_ {
+    int32_t remaining;
+    cmt_msg_t* client_msg;
+} _scheduled_msg_data_t;
+
+static bool _queue_get(_host_queue_t* q, cmt_msg_t* msg);
+static bool _queue_post(_host_queue_t* q, cmt_msg_t* msg);
+static void _scheduled_init();
+
+uint64_t host_clock_us = 0;
+
+static _host_queue_t _be_queue;     // Core 0
+static _host_queue_t _ui_queue;     // Core 1
+static _scheduled_msg_data_t _scheduled_message_datas[_SCHEDULED_MESSAGES_MAX];
+static bool _scheduled_initialized = false;
+
+
+static bool _queue_get(_host_queue_t* q, cmt_msg_t* msg) {
+    if (q->tail == q->head) {
+        return (false);
+    }
+    memcpy(msg, &q->msgs[q->tail % CMT_HOST_QUEUE_SIZE], sizeof(cmt_msg_t));
+    q->tail++;
+    return (true);
+}
+
+static bool _queue_post(_host_queue_t* q, cmt_msg_t* msg) {
+    if ((q->head - q->tail) >= CMT_HOST_QUEUE_SIZE) {
+        return (false);
+    }
+    msg->t = now_ms();
+    memcpy(&q->msgs[q->head % CMT_HOST_QUEUE_SIZE], msg, sizeof(cmt_msg_t));
+    q->head++;
+    return (true);
+}
+
+static void _scheduled_init() {
+    if (!_scheduled_initialized) {
+        for (int i = 0; i < _SCHEDULED_MESSAGES_MAX; i++) {
+            _scheduled_message_datas[i].remaining = _SMD_FREE_INDICATOR;
+            _scheduled_message_datas[i].client_msg = NULL;
+        }
+        _scheduled_initialized = true;
+    }
+}
+
+void cmt_host_reset(void) {
+    _scheduled_initialized = false;
+    _scheduled_init();
+    _be_queue.head = _be_queue.tail = 0;
+    _ui_queue.head = _ui_queue.tail = 0;
+}
+
+void cmt_host_tick_ms(void) {
+    _scheduled_init();
+    host_clock_us += 1000;
+    for (int i = 0; i < _SCHEDULED_MESSAGES_MAX; i++) {
+        _scheduled_msg_data_t* smd = &_scheduled_message_datas[i];
+        if (smd->remaining > 0) {
+            if (0 == --smd->remaining) {
+                post_to_core0_blocking(smd->client_msg);
+                smd->remaining = _SMD_FREE_INDICATOR;
+            }
+        }
+    }
+}
+
+// *** CMT ***
+
+int cmt_sched_msg_waiting() {
+    int waiting = 0;
+    _scheduled_init();
+    for (int i = 0; i < _SCHEDULED_MESSAGES_MAX; i++) {
+        if (_scheduled_message_datas[i].remaining > 0) {
+            waiting++;
+        }
+    }
+    return (waiting);
+}
+
+void schedule_msg_in_ms(int32_t ms, cmt_msg_t* msg) {
+    _scheduled_init();
+    for (int i = 0; i < _SCHEDULED_MESSAGES_MAX; i++) {
+        _scheduled_msg_data_t* smd = &_scheduled_message_datas[i];
+        if (_SMD_FREE_INDICATOR == smd->remaining) {
+            smd->client_msg = msg;
+            smd->remaining = (ms > 0 ? ms : 1);
+            return;
+        }
+    }
+    panic("CMT - No SM Data slot available for use.");
+}
+
+void scheduled_msg_cancel(msg_id_t sched_msg_id) {
+    _scheduled_init();
+    for (int i = 0; i < _SCHEDULED_MESSAGES_MAX; i++) {
+        _scheduled_msg_data_t* smd = &_scheduled_message_datas[i];
+        if (smd->client_msg && smd->client_msg->id == sched_msg_id) {
+            smd->remaining = _SMD_FREE_INDICATOR;
+        }
+    }
+}
+
+bool scheduled_message_exists(msg_id_t sched_msg_id) {
+    _scheduled_init();
+    for (int i = 0; i < _SCHEDULED_MESSAGES_MAX; i++) {
+        _scheduled_msg_data_t* smd = &_scheduled_message_datas[i];
+        if (smd->remaining > 0 && smd->client_msg && smd->client_msg->id == sched_msg_id) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+// *** Multicore message queues ***
+
+void get_core0_msg_blocking(cmt_msg_t* msg) {
+    if (!_queue_get(&_be_queue, msg)) {
+        panic("CMT - Backend queue empty (a blocking get would never return).");
+    }
+}
+
+bool get_core0_msg_nowait(cmt_msg_t* msg) {
+    return (_queue_get(&_be_queue, msg));
+}
+
+void get_core1_msg_blocking(cmt_msg_t* msg) {
+    if (!_queue_get(&_ui_queue, msg)) {
+        panic("CMT - UI queue empty (a blocking get would never return).");
+    }
+}
+
+bool get_core1_msg_nowait(cmt_msg_t* msg) {
+    return (_queue_get(&_ui_queue, msg));
+}
+
+void post_to_core0_blocking(cmt_msg_t* msg) {
+    if (!_queue_post(&_be_queue, msg)) {
+        panic("CMT - Backend queue full (a blocking post would never return).");
+    }
+}
+
+bool post_to_core0_nowait(cmt_msg_t* msg) {
+    return (_queue_post(&_be_queue, msg));
+}
+
+void post_to_core1_blocking(cmt_msg_t* msg) {
+    if (!_queue_post(&_ui_queue, msg)) {
+        panic("CMT - UI queue full (a blocking post would never return).");
+    }
+}
+
+bool post_to_core1_nowait(cmt_msg_t* msg) {
+    return (_queue_post(&_ui_queue, msg));
+}
+
+void post_to_cores_blocking(cmt_msg_t* msg) {
+    post_to_core0_blocking(msg);
+    post_to_core1_blocking(msg);
+}
+
+uint16_t post_to_cores_nowait(cmt_msg_t* msg) {
+    uint16_t posted = 0;
+    posted += (post_to_core0_nowait(msg) ? 1 : 0);
+    posted += (post_to_core1_nowait(msg) ? 1 : 0);
+    return (posted);
+}
@@ -0,0 +1,39 @@
+/**
+ * Cooperative Multi-Tasking messages for the host.
+ *
+ * Implements the CMT message posting and scheduled messages (`cmt.h` and
+ * `multicore.h`) on one thread, with a clock that the test moves. The backend
+ * (core 0) and UI (core 1) each have a queue, which the test reads and dispatches
+ * (`get_core0_msg_nowait`, `get_core1_msg_nowait`) the way the message loops do. Scheduled
+ * messages are posted to the backend when their time comes, as the test moves
+ * the clock a millisecond at a time.
+ *
+ * The modules using it are built with MUKOB_HOST_CLOCK, so their time (`now_us`,
+ * `now_ms`) is this clock.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _CMT_HOST_H_
+#define _CMT_HOST_H_
+
+#include <stdint.h>
+
+#include "cmt.h"
+
+#define CMT_HOST_QUEUE_SIZE 64
+
+/**
+ * @brief Move the clock forward a millisecond, posting the scheduled messages that are due.
+ * @ingroup cmt
+ */
+extern void cmt_host_tick_ms(void);
+
+/**
+ * @brief Empty the queues and cancel the scheduled messages.
+ * @ingroup cmt
+ */
+extern void cmt_host_reset(void);
+
+#endif // _CMT_HOST_H_
@@ -0,0 +1,160 @@
+/**
+ * Fuzz driver for the Data packet parser (`mkspkt_data_parse`).
+ *
+ * Built with `-DMUKOB_LIBFUZZER` (and clang `-fsanitize=fuzzer`) this is a libFuzzer
+ * target. Otherwise it has a `main` that runs a fixed number of mutations of valid
+ * Code and ID packets, and random data, so it can run as a test.
+ *
+ * Each input is parsed from a buffer of exactly its length, at an odd address, and
+ * the results are checked: a valid count, a terminated station ID that fits its
+ * field, and nothing written past the code elements. Use the sanitizers
+ * (MUKOB_HOST_SANITIZE) to catch reads past the end of the packet.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mkspkt.h"
+
+#define _GUARD 0x5A5A5A5A
+#define _ITERATIONS 200000
+#define _PKT_BUF_MAX 600
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    char station_id[MKS_PKT_MAX_STRING_LEN + 2];
+    code_element_t code[MKS_PKT_MAX_CODE_LEN + 1];
+    int32_t seqno;
+
+    if (size > UINT16_MAX) {
+        return (0);
+    }
+    // Exactly the size of the input, and not aligned
+    uint8_t* buf = malloc(size + 1);
+    uint8_t* pkt = buf + 1;
+    memcpy(pkt, data, size);
+    memset(station_id, 0x7F, sizeof(station_id));
+    for (int i = 0; i <= MKS_PKT_MAX_CODE_LEN; i++) {
+        code[i] = _GUARD;
+    }
+    int n = mkspkt_data_parse(pkt, (uint16_t)size, station_id, &seqno, code);
+    HT_CHECK(n >= -1 && n <= MKS_PKT_MAX_CODE_LEN);
+    if (n >= 0) {
+        HT_CHECK(size >= MKSPKT_CODE_OFFSET_TEXT);
+        HT_CHECK(memchr(station_id, 0, MKS_PKT_MAX_STRING_LEN + 1) != NULL);
+        HT_CHECK(seqno == mkspkt_i32(pkt, MKSPKT_CODE_OFFSET_SEQNO));
+        for (int i = n; i <= MKS_PKT_MAX_CODE_LEN; i++) {
+            HT_CHECK(code[i] == _GUARD);
+        }
+    }
+    else {
+        // Nothing is written for an invalid packet
+        for (int i = 0; i <= MKS_PKT_MAX_CODE_LEN; i++) {
+            HT_CHECK(code[i] == _GUARD);
+        }
+    }
+    free(buf);
+    if (_ht_failures) {
+        abort();
+    }
+    return (0);
+}
+
+#ifndef MUKOB_LIBFUZZER
+
+static uint32_t _rand_state = 0x1F2E3D4C;
+
+static uint32_t _rand(void) {
+    // xorshift32
+    _rand_state ^= _rand_state << 13;
+    _rand_state ^= _rand_state >> 17;
+    _rand_state ^= _rand_state << 5;
+    return (_rand_state);
+}
+
+/*
+ * Build a valid Code packet (n elements, 0 for an ID packet).
+ */
+static void _pack(mkspkt_code_t* pkt, int n) {
+    memset(pkt, 0, sizeof(mkspkt_code_t));
+    pkt->cmd = MKS_CMD_DATA;
+    pkt->bytes = MKS_CODE_PKT_SIZE;
+    strcpy(pkt->id, "ES, Bremerton, WA, MuKOB v0.1");
+    pkt->seqno = 1234;
+    for (int i = 0; i < n; i++) {
+        pkt->code_list[i] = ((i & 1) ? 60 : -60);
+    }
+    pkt->n = n;
+}
+
+int main(void) {
+    static const int32_t n_special[] = { -1, 0, 1, MKS_PKT_MAX_CODE_LEN, MKS_PKT_MAX_CODE_LEN + 1, INT32_MAX, INT32_MIN };
+    static const int16_t bytes_special[] = { -1, 0, 355, 356, 492, 493, INT16_MAX, INT16_MIN };
+    uint8_t buf[_PKT_BUF_MAX];
+    mkspkt_code_t pkt;
+    int valid = 0;
+
+    // Valid packets parse
+    _pack(&pkt, 0);
+    HT_CHECK_EQ(0, mkspkt_data_parse((const uint8_t*)&pkt, sizeof(pkt), (char*)buf, (int32_t*)(buf + 200), NULL));
+    _pack(&pkt, 5);
+    HT_CHECK_EQ(5, mkspkt_data_parse((const uint8_t*)&pkt, sizeof(pkt), (char*)buf, (int32_t*)(buf + 200), NULL));
+    HT_CHECK(strcmp((char*)buf, pkt.id) == 0);
+
+    for (int i = 0; i < _ITERATIONS && !_ht_failures; i++) {
+        size_t size;
+        switch (_rand() % 4) {
+            case 0:
+                // Random data, random length
+                size = _rand() % _PKT_BUF_MAX;
+                for (size_t j = 0; j < size; j++) {
+                    buf[j] = (uint8_t)_rand();
+                }
+                break;
+            case 1:
+                // Valid packet, truncated or extended
+                _pack(&pkt, _rand() % (MKS_PKT_MAX_CODE_LEN + 1));
+                memcpy(buf, &pkt, sizeof(pkt));
+                size = _rand() % _PKT_BUF_MAX;
+                break;
+            case 2:
+                // Valid packet, edge values for the counts
+                _pack(&pkt, _rand() % (MKS_PKT_MAX_CODE_LEN + 1));
+                pkt.n = n_special[_rand() % (sizeof(n_special) / sizeof(n_special[0]))];
+                pkt.bytes = bytes_special[_rand() % (sizeof(bytes_special) / sizeof(bytes_special[0]))];
+                memcpy(buf, &pkt, sizeof(pkt));
+                size = sizeof(pkt) - (_rand() % 2) * (_rand() % 140);
+                break;
+            default:
+                // Valid packet, bytes flipped (including an unterminated ID)
+                _pack(&pkt, _rand() % (MKS_PKT_MAX_CODE_LEN + 1));
+                memcpy(buf, &pkt, sizeof(pkt));
+                size = sizeof(pkt);
+                for (int j = _rand() % 16; j >= 0; j--) {
+                    buf[_rand() % size] = (uint8_t)_rand();
+                }
+                if (_rand() % 4 == 0) {
+                    memset(buf + MKSPKT_CODE_OFFSET_ID, 'X', MKS_PKT_MAX_STRING_LEN + 1);
+                }
+                break;
+        }
+        LLVMFuzzerTestOneInput(buf, size);
+        char station_id[MKS_PKT_MAX_STRING_LEN + 1];
+        int32_t seqno;
+        if (mkspkt_data_parse(buf, (uint16_t)size, station_id, &seqno, NULL) >= 0) {
+            valid++;
+        }
+    }
+    printf("%d inputs, %d valid\n", _ITERATIONS, valid);
+    HT_CHECK(valid > 0);
+
+    return (HT_RESULT());
+}
+
+#endif // MUKOB_LIBFUZZER
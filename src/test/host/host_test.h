@@ -0,0 +1,31 @@
+/**
+ * Host test checks.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+#include <stdio.h>
+
+static int _ht_failures;
+
+/**
+ * Check that a condition is true, printing the location if it isn't.
+ */
+#define HT_CHECK(cond) do { if (!(cond)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); _ht_failures++; } } while (0)
+
+/**
+ * Check that two integers are equal, printing both if they aren't.
+ */
+#define HT_CHECK_EQ(expected, actual) do { long _e = (long)(expected), _a = (long)(actual); \
+    if (_e != _a) { printf("%s:%d: %s: expected %ld, got %ld\n", __FILE__, __LINE__, #actual, _e, _a); _ht_failures++; } } while (0)
+
+/**
+ * The result to return from `main`.
+ */
+#define HT_RESULT() (printf("%s\n", (_ht_failures ? "FAIL" : "PASS")), (_ht_failures ? 1 : 0))
+
+#endif // _HOST_TEST_H_
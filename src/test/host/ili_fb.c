@@ -0,0 +1,327 @@
+/**
+ * ILI LCD host framebuffer backend.
+ *
+ * The operations are turned into the controller commands and parameter bytes that
+ * the SPI driver sends, and the commands are decoded the way the controller does,
+ * so the command, parameter, window, and scroll counts in `ili_stats` match the
+ * target for the same operations.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "ili_fb.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ili9341_spi.h"
+
+#define _WIDTH ILI9341_WIDTH
+#define _HEIGHT ILI9341_HEIGHT
+
+static void _command(uint8_t cmd, const uint8_t* data, size_t count);
+static void _pixels_write(const rgb16_t* pixels, size_t count, bool repeat);
+static uint16_t _u16(const uint8_t* data);
+static void _window_set(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/** @brief Frame memory (the controller's GRAM). */
+static rgb16_t _gram[_HEIGHT][_WIDTH];
+static rgb16_t _line_buf[_WIDTH];
+
+// Memory write window and position
+static uint16_t _x1, _x2, _y1, _y2;
+static uint16_t _wx, _wy;
+// Last window sent (like the driver, the window is only sent when it changes)
+static uint16_t _old_x1 = 0xffff, _old_x2 = 0xffff;
+static uint16_t _old_y1 = 0xffff, _old_y2 = 0xffff;
+// Vertical scroll registers
+static uint16_t _tfa, _vsa = _HEIGHT, _bfa;
+static uint16_t _vsp;
+static bool _scroll_mode = false;
+static bool _display_on = false;
+
+static bool _screen_dirty = true;
+static ili_disp_info_t _ili_disp_info;
+static ili_stats_t _stats;
+
+/*
+ * Decode a command and its parameters, as the controller would.
+ */
+static void _command(uint8_t cmd, const uint8_t* data, size_t count) {
+    _stats.commands++;
+    _stats.param_bytes += count;
+    switch (cmd) {
+        case ILI_CASET:
+            if (count >= 4) {
+                _x1 = _u16(data);
+                _x2 = _u16(data + 2);
+            }
+            break;
+        case ILI_PASET:
+            if (count >= 4) {
+                _y1 = _u16(data);
+                _y2 = _u16(data + 2);
+            }
+            break;
+        case ILI_RAMWR:
+            _wx = _x1;
+            _wy = _y1;
+            break;
+        case ILI_VSCRDEF:
+            // The areas have to add up to the height, otherwise the result is undefined (ignore it)
+            if (count >= 6 && (_u16(data) + _u16(data + 2) + _u16(data + 4)) == _HEIGHT) {
+                _tfa = _u16(data);
+                _vsa = _u16(data + 2);
+                _bfa = _u16(data + 4);
+                _stats.scroll_top_fixed = _tfa;
+                _stats.scroll_height = _vsa;
+                _stats.scroll_bottom_fixed = _bfa;
+            }
+            break;
+        case ILI_VSCRSADD:
+            if (count >= 2) {
+                _vsp = _u16(data);
+                _scroll_mode = true;
+                _stats.scroll_start = _vsp;
+            }
+            break;
+        case ILI_NORON:
+            _scroll_mode = false;
+            break;
+        case ILI_DISPON:
+            _display_on = true;
+            break;
+        case ILI_DISPOFF:
+            _display_on = false;
+            break;
+    }
+}
+
+/*
+ * Write pixels into the window (one value repeated for a fill). The position wraps
+ * at the end of the window, as the controller's does.
+ */
+static void _pixels_write(const rgb16_t* pixels, size_t count, bool repeat) {
+    for (size_t i = 0; i < count; i++) {
+        if (_wx < _WIDTH && _wy < _HEIGHT) {
+            _gram[_wy][_wx] = (repeat ? *pixels : pixels[i]);
+        }
+        if (++_wx > _x2) {
+            _wx = _x1;
+            if (++_wy > _y2) {
+                _wy = _y1;
+            }
+        }
+    }
+    _stats.pixel_bytes += count * sizeof(rgb16_t);
+    _stats.pixel_writes++;
+    _screen_dirty = true;
+}
+
+/*
+ * 16 bit parameter (sent high byte first).
+ */
+static uint16_t _u16(const uint8_t* data) {
+    return ((uint16_t)((data[0] << 8) | data[1]));
+}
+
+static void _window_set(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    uint16_t x2 = (x + w - 1), y2 = (y + h - 1);
+    uint8_t data[4];
+    if (x != _old_x1 || x2 != _old_x2) {
+        data[0] = x >> 8; data[1] = x & 0xFF; data[2] = x2 >> 8; data[3] = x2 & 0xFF;
+        _command(ILI_CASET, data, 4);
+        _old_x1 = x;
+        _old_x2 = x2;
+        _stats.windows_set++;
+    }
+    if (y != _old_y1 || y2 != _old_y2) {
+        data[0] = y >> 8; data[1] = y & 0xFF; data[2] = y2 >> 8; data[3] = y2 & 0xFF;
+        _command(ILI_PASET, data, 4);
+        _old_y1 = y;
+        _old_y2 = y2;
+        _stats.windows_set++;
+    }
+    _command(ILI_RAMWR, NULL, 0);
+}
+
+
+rgb16_t ili_fb_pixel(uint16_t x, uint16_t y) {
+    if (x >= _WIDTH || y >= _HEIGHT) {
+        return (0);
+    }
+    return (_gram[ili_fb_row(y)][x]);
+}
+
+bool ili_fb_ppm_write(const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        return (false);
+    }
+    fprintf(f, "P6\n%d %d\n255\n", _WIDTH, _HEIGHT);
+    for (uint16_t y = 0; y < _HEIGHT; y++) {
+        for (uint16_t x = 0; x < _WIDTH; x++) {
+            rgb16_t p = ili_fb_pixel(x, y);
+            // Scale each component to 8 bits (repeating the high bits in the low ones)
+            uint8_t r5 = (p >> 11) & 0x1F, g6 = (p >> 5) & 0x3F, b5 = p & 0x1F;
+            uint8_t rgb[3] = { (r5 << 3) | (r5 >> 2), (g6 << 2) | (g6 >> 4), (b5 << 3) | (b5 >> 2) };
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    return (fclose(f) == 0);
+}
+
+uint16_t ili_fb_row(uint16_t y) {
+    if (!_scroll_mode || y < _tfa || y >= (_tfa + _vsa)) {
+        return (y);
+    }
+    // A start in a fixed area is the same as the start (or end) of the scroll area
+    uint16_t vsp = (_vsp < _tfa ? _tfa : (_vsp >= (_tfa + _vsa) ? (_tfa + _vsa - 1) : _vsp));
+    uint16_t row = vsp + (y - _tfa);
+    if (row >= (_tfa + _vsa)) {
+        row -= _vsa;
+    }
+    return (row);
+}
+
+void ili_colors_show() {
+    rgb16_t c;
+    ili_screen_clr(0, false);
+    _window_set(0, 0, 32 * 4, 4);
+    for (int row = 0; row < 4; row++) {
+        for (int r = 0; r < 32 * 4; r++) {
+            c = (r / 4) << 11;
+            _pixels_write(&c, 1, true);
+        }
+    }
+    _window_set(0, 4, 32 * 4, 4);
+    for (int row = 0; row < 4; row++) {
+        for (int g = 0; g < 32 * 4; g++) {
+            c = (g / 2) << 5;
+            _pixels_write(&c, 1, true);
+        }
+    }
+    _window_set(0, 8, 32 * 4, 4);
+    for (int row = 0; row < 4; row++) {
+        for (int b = 0; b < 32 * 4; b++) {
+            c = (b / 4);
+            _pixels_write(&c, 1, true);
+        }
+    }
+}
+
+void ili_dma_enable(bool enable) {
+    // The writes are always done as they are made
+    (void)enable;
+}
+
+bool ili_paint_busy() {
+    return (false);
+}
+
+void ili_paint_wait() {
+}
+
+void ili_send_command(uint8_t cmd) {
+    _command(cmd, NULL, 0);
+}
+
+void ili_send_command_wd(uint8_t cmd, uint8_t* data, size_t count) {
+    _command(cmd, data, count);
+}
+
+rgb16_t* ili_get_line_buf() {
+    return (_line_buf);
+}
+
+ili_disp_info_t* ili_info(void) {
+    _ili_disp_info.lcd_id4_ic_model1 = ILI9341_ID_MODEL1;
+    _ili_disp_info.lcd_id4_ic_model2 = ILI9341_ID_MODEL2;
+    return (&_ili_disp_info);
+}
+
+uint16_t ili_screen_height() {
+    return (_HEIGHT);
+}
+
+void ili_screen_on(bool on) {
+    _command((on ? ILI_DISPON : ILI_DISPOFF), NULL, 0);
+}
+
+void ili_screen_paint(const rgb16_t* rgb_pixel_data, uint16_t pixels) {
+    _pixels_write(rgb_pixel_data, pixels, false);
+}
+
+uint16_t ili_screen_width() {
+    return (_WIDTH);
+}
+
+void ili_scroll_exit(void) {
+    _command(ILI_DISPOFF, NULL, 0);
+    _command(ILI_NORON, NULL, 0);
+    _command(ILI_DISPON, NULL, 0);
+    _window_set(0, 0, _WIDTH, _HEIGHT);
+}
+
+void ili_scroll_set_area(uint16_t top_fixed_lines, uint16_t bottom_fixed_lines) {
+    uint16_t scroll_lines = _HEIGHT - (top_fixed_lines + bottom_fixed_lines);
+    uint8_t def[6] = {
+        top_fixed_lines >> 8, top_fixed_lines & 0xFF,
+        scroll_lines >> 8, scroll_lines & 0xFF,
+        bottom_fixed_lines >> 8, bottom_fixed_lines & 0xFF,
+    };
+    uint8_t start[2] = { top_fixed_lines >> 8, top_fixed_lines & 0xFF };
+    _command(ILI_VSCRDEF, def, sizeof(def));
+    _command(ILI_VSCRSADD, start, sizeof(start));
+}
+
+void ili_scroll_set_start(uint16_t row) {
+    uint8_t start[2] = { row >> 8, row & 0xFF };
+    _command(ILI_VSCRSADD, start, sizeof(start));
+    _stats.scroll_starts++;
+}
+
+void ili_window_set_area(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    _window_set(x, y, w, h);
+}
+
+void ili_window_set_fullscreen(void) {
+    _window_set(0, 0, _WIDTH, _HEIGHT);
+}
+
+void ili_line_paint(uint16_t line, rgb16_t* buf) {
+    if (line >= _HEIGHT) {
+        return;
+    }
+    _window_set(0, line, _WIDTH, 1);
+    _pixels_write(buf, _WIDTH, false);
+}
+
+void ili_screen_clr(rgb16_t color, bool force) {
+    if (force || _screen_dirty) {
+        _window_set(0, 0, _WIDTH, _HEIGHT);
+        _pixels_write(&color, (size_t)_WIDTH * _HEIGHT, true);
+        _screen_dirty = false;
+    }
+    else if (_old_x1 != 0 || _old_y1 != 0 || _old_x2 != (_WIDTH - 1) || _old_y2 != (_HEIGHT - 1)) {
+        _window_set(0, 0, _WIDTH, _HEIGHT);
+    }
+}
+
+void ili_stats(ili_stats_t* stats) {
+    memcpy(stats, &_stats, sizeof(ili_stats_t));
+}
+
+ili_controller_type ili_module_init(void) {
+    // The controller comes out of reset with no scrolling and the display off
+    memset(_gram, 0, sizeof(_gram));
+    _tfa = 0;
+    _vsa = _HEIGHT;
+    _bfa = 0;
+    _vsp = 0;
+    _scroll_mode = false;
+    _command(ILI_DISPON, NULL, 0);
+
+    return (ILI_CONTROLLER_9341);
+}
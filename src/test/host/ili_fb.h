@@ -0,0 +1,58 @@
+/**
+ * ILI LCD host framebuffer backend.
+ *
+ * Implements the ILI LCD interface (`ili_lcd_spi.h`) on the host, drawing into an
+ * in-memory RGB565 copy of the controller's frame memory. The commands that the
+ * display code depends on are emulated: the window (CASET/PASET) and memory write,
+ * the vertical scroll definition and start (VSCRDEF/VSCRSADD), and normal mode
+ * (NORON, which ends scrolling). The screen, as the controller would show it, can
+ * be read a pixel at a time and dumped to a PPM file.
+ *
+ * The display is an ILI9341 (240 x 320, portrait).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _ILI_FB_H_
+#define _ILI_FB_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ili_lcd_spi.h"
+
+/**
+ * @brief Get a pixel of the screen (with the vertical scroll applied).
+ * @ingroup display
+ *
+ * @param x Screen column.
+ * @param y Screen row.
+ * @return The RGB565 value (0 if the position is off the screen).
+ */
+extern rgb16_t ili_fb_pixel(uint16_t x, uint16_t y);
+
+/**
+ * @brief Write the screen (with the vertical scroll applied) to a binary PPM (P6) file.
+ * @ingroup display
+ *
+ * @param path The file to write.
+ * @return true if it was written.
+ */
+extern bool ili_fb_ppm_write(const char* path);
+
+/**
+ * @brief Get the frame memory row shown on a screen row.
+ * @ingroup display
+ *
+ * This is the vertical scroll mapping: the rows of the top and bottom fixed areas
+ * show their own memory rows, and the scroll area shows the memory starting at the
+ * scroll start, wrapping within the scroll area.
+ *
+ * @param y Screen row.
+ * @return The frame memory row.
+ */
+extern uint16_t ili_fb_row(uint16_t y);
+
+#endif // _ILI_FB_H_
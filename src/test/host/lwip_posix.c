@@ -0,0 +1,261 @@
+/**
+ * lwIP UDP and PBUFs for the host, over POSIX sockets.
+ *
+ * The PBUFs are a static pool, each a single block with room for the largest
+ * datagram. A freed PBUF is filled with a marker, to show up a use after free.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "lwip_posix.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "pico.h"
+
+#define _FREED_MARKER 0xEE
+
+typedef struct _pool_pbuf_ {
+    struct pbuf p;
+    bool used;
+    uint8_t data[LWIP_POSIX_PBUF_SIZE];
+} _pool_pbuf_t;
+
+struct udp_pcb {
+    int fd;                     // -1 if the PCB isn't in use
+    udp_recv_fn recv;
+    void* recv_arg;
+};
+
+static void _addr_make(struct sockaddr_in* sa, const ip_addr_t* ipaddr, u16_t port);
+
+static _pool_pbuf_t _pbufs[LWIP_POSIX_PBUFS];
+static uint32_t _pbuf_limit = LWIP_POSIX_PBUFS;
+static struct udp_pcb _pcbs[LWIP_POSIX_PCBS];
+static bool _pcbs_initialized = false;
+static lwip_posix_stats_t _stats;
+
+
+static void _addr_make(struct sockaddr_in* sa, const ip_addr_t* ipaddr, u16_t port) {
+    memset(sa, 0, sizeof(struct sockaddr_in));
+    sa->sin_family = AF_INET;
+    sa->sin_addr.s_addr = (ipaddr ? ipaddr->addr : htonl(INADDR_ANY));
+    sa->sin_port = htons(port);
+}
+
+ip_addr_t lwip_posix_loopback(void) {
+    ip_addr_t addr = { htonl(INADDR_LOOPBACK) };
+    return (addr);
+}
+
+u16_t lwip_posix_local_port(const struct udp_pcb* pcb) {
+    struct sockaddr_in sa;
+    socklen_t len = sizeof(sa);
+    if (!pcb || pcb->fd < 0 || getsockname(pcb->fd, (struct sockaddr*)&sa, &len) != 0) {
+        return (0);
+    }
+    return (ntohs(sa.sin_port));
+}
+
+void lwip_posix_pbuf_limit(uint32_t pbufs) {
+    _pbuf_limit = (pbufs < LWIP_POSIX_PBUFS ? pbufs : LWIP_POSIX_PBUFS);
+}
+
+int lwip_posix_poll(void) {
+    int received = 0;
+    for (int i = 0; i < LWIP_POSIX_PCBS; i++) {
+        struct udp_pcb* pcb = &_pcbs[i];
+        uint8_t buf[LWIP_POSIX_PBUF_SIZE];
+        struct sockaddr_in sa;
+        socklen_t sa_len = sizeof(sa);
+        ssize_t n;
+        // (the receive function can remove the PCB)
+        while (pcb->fd >= 0 && (n = recvfrom(pcb->fd, buf, sizeof(buf), 0, (struct sockaddr*)&sa, &sa_len)) >= 0) {
+            received++;
+            struct pbuf* p = (pcb->recv ? pbuf_alloc(PBUF_TRANSPORT, (u16_t)n, PBUF_POOL) : NULL);
+            if (!p) {
+                _stats.recv_drops++;
+                continue;
+            }
+            memcpy(p->payload, buf, n);
+            ip_addr_t addr = { sa.sin_addr.s_addr };
+            _stats.received++;
+            // The receive function owns the PBUF
+            pcb->recv(pcb->recv_arg, pcb, p, &addr, ntohs(sa.sin_port));
+            sa_len = sizeof(sa);
+        }
+    }
+    return (received);
+}
+
+void lwip_posix_stats(lwip_posix_stats_t* stats) {
+    memcpy(stats, &_stats, sizeof(lwip_posix_stats_t));
+}
+
+// *** lwIP PBUF API ***
+
+struct pbuf* pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type) {
+    (void)layer;
+    (void)type;
+    if (length > LWIP_POSIX_PBUF_SIZE || _stats.pbufs_used >= _pbuf_limit) {
+        _stats.pbuf_alloc_fails++;
+        return (NULL);
+    }
+    for (int i = 0; i < LWIP_POSIX_PBUFS; i++) {
+        _pool_pbuf_t* pp = &_pbufs[i];
+        if (!pp->used) {
+            pp->used = true;
+            pp->p.next = NULL;
+            pp->p.payload = pp->data;
+            pp->p.tot_len = length;
+            pp->p.len = length;
+            pp->p.ref = 1;
+            _stats.pbufs_used++;
+            if (_stats.pbufs_used > _stats.pbufs_used_max) {
+                _stats.pbufs_used_max = _stats.pbufs_used;
+            }
+            return (&pp->p);
+        }
+    }
+    _stats.pbuf_alloc_fails++;
+    return (NULL);
+}
+
+u16_t pbuf_copy_partial(const struct pbuf* p, void* dataptr, u16_t len, u16_t offset) {
+    if (!p || offset >= p->len) {
+        return (0);
+    }
+    u16_t n = ((p->len - offset) < len ? (p->len - offset) : len);
+    memcpy(dataptr, (const uint8_t*)p->payload + offset, n);
+    return (n);
+}
+
+u8_t pbuf_free(struct pbuf* p) {
+    if (!p) {
+        return (0);
+    }
+    _pool_pbuf_t* pp = (_pool_pbuf_t*)p;
+    if (pp < _pbufs || pp >= &_pbufs[LWIP_POSIX_PBUFS] || !pp->used || 0 == p->ref) {
+        panic("pbuf_free: not an allocated PBUF");
+    }
+    if (--p->ref > 0) {
+        return (0);
+    }
+    memset(pp->data, _FREED_MARKER, sizeof(pp->data));
+    pp->used = false;
+    _stats.pbufs_used--;
+    return (1);
+}
+
+void* pbuf_get_contiguous(const struct pbuf* p, void* buffer, size_t bufsize, u16_t len, u16_t offset) {
+    (void)buffer;
+    (void)bufsize;
+    if (!p || (offset + len) > p->len) {
+        return (NULL);
+    }
+    // A PBUF is always one block
+    return ((uint8_t*)p->payload + offset);
+}
+
+void pbuf_ref(struct pbuf* p) {
+    if (p) {
+        p->ref++;
+    }
+}
+
+err_t pbuf_take(struct pbuf* p, const void* dataptr, u16_t len) {
+    if (!p || len > p->tot_len) {
+        return (ERR_ARG);
+    }
+    memcpy(p->payload, dataptr, len);
+    return (ERR_OK);
+}
+
+// *** lwIP UDP API ***
+
+err_t udp_bind(struct udp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port) {
+    struct sockaddr_in sa;
+    _addr_make(&sa, ipaddr, port);
+    return (bind(pcb->fd, (struct sockaddr*)&sa, sizeof(sa)) == 0 ? ERR_OK : ERR_USE);
+}
+
+err_t udp_connect(struct udp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port) {
+    struct sockaddr_in sa;
+    _addr_make(&sa, ipaddr, port);
+    return (connect(pcb->fd, (struct sockaddr*)&sa, sizeof(sa)) == 0 ? ERR_OK : ERR_RTE);
+}
+
+void udp_disconnect(struct udp_pcb* pcb) {
+    struct sockaddr sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_family = AF_UNSPEC;
+    connect(pcb->fd, &sa, sizeof(sa));
+}
+
+struct udp_pcb* udp_new(void) {
+    if (!_pcbs_initialized) {
+        for (int i = 0; i < LWIP_POSIX_PCBS; i++) {
+            _pcbs[i].fd = -1;
+        }
+        _pcbs_initialized = true;
+    }
+    for (int i = 0; i < LWIP_POSIX_PCBS; i++) {
+        struct udp_pcb* pcb = &_pcbs[i];
+        if (pcb->fd < 0) {
+            int fd = socket(AF_INET, SOCK_DGRAM, 0);
+            if (fd < 0) {
+                return (NULL);
+            }
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            pcb->fd = fd;
+            pcb->recv = NULL;
+            pcb->recv_arg = NULL;
+            return (pcb);
+        }
+    }
+    return (NULL);
+}
+
+void udp_recv(struct udp_pcb* pcb, udp_recv_fn recv, void* recv_arg) {
+    pcb->recv = recv;
+    pcb->recv_arg = recv_arg;
+}
+
+void udp_remove(struct udp_pcb* pcb) {
+    if (pcb && pcb->fd >= 0) {
+        close(pcb->fd);
+        pcb->fd = -1;
+        pcb->recv = NULL;
+    }
+}
+
+err_t udp_send(struct udp_pcb* pcb, struct pbuf* p) {
+    if (!pcb || pcb->fd < 0 || !p) {
+        return (ERR_ARG);
+    }
+    if (send(pcb->fd, p->payload, p->len, 0) < 0) {
+        return (ECONNREFUSED == errno ? ERR_RST : ERR_BUF);
+    }
+    _stats.sent++;
+    return (ERR_OK);
+}
+
+err_t udp_sendto(struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* dst_ip, u16_t dst_port) {
+    if (!pcb || pcb->fd < 0 || !p) {
+        return (ERR_ARG);
+    }
+    struct sockaddr_in sa;
+    _addr_make(&sa, dst_ip, dst_port);
+    if (sendto(pcb->fd, p->payload, p->len, 0, (struct sockaddr*)&sa, sizeof(sa)) < 0) {
+        return (ERR_BUF);
+    }
+    _stats.sent++;
+    return (ERR_OK);
+}
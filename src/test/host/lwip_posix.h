@@ -0,0 +1,82 @@
+/**
+ * lwIP UDP and PBUFs for the host, over POSIX sockets.
+ *
+ * Implements the part of the lwIP raw API that the wire code uses (`lwip/udp.h`
+ * and `lwip/pbuf.h` in the shim). A UDP PCB is a non-blocking IPv4 UDP socket, so
+ * the wire code can talk to a server stand-in on the loopback interface. lwIP
+ * calls the receive function from its own context when a datagram comes in; here
+ * the test calls `lwip_posix_poll` to do that.
+ *
+ * The PBUFs come from a pool of `LWIP_POSIX_PBUFS`, the same as the lwIP PBUF_POOL
+ * on the target, so running out of them can be tested.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _LWIP_POSIX_H_
+#define _LWIP_POSIX_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+
+#define LWIP_POSIX_PBUFS 16         // PBUFs that can be allocated at once
+#define LWIP_POSIX_PBUF_SIZE 1024   // Largest PBUF (larger than any MorseKOB packet)
+#define LWIP_POSIX_PCBS 8
+
+/**
+ * @brief Host lwIP statistics.
+ * @ingroup wire
+ */
+typedef struct _lwip_posix_stats_ {
+    uint32_t pbufs_used;        // PBUFs allocated now
+    uint32_t pbufs_used_max;
+    uint32_t pbuf_alloc_fails;  // Allocations refused (the pool was empty)
+    uint32_t sent;              // Datagrams sent
+    uint32_t received;          // Datagrams passed to a receive function
+    uint32_t recv_drops;        // Datagrams dropped (no PBUF or no receive function)
+} lwip_posix_stats_t;
+
+/**
+ * @brief Make the IPv4 loopback address.
+ * @ingroup wire
+ */
+extern ip_addr_t lwip_posix_loopback(void);
+
+/**
+ * @brief Get the local port a PCB is bound to.
+ * @ingroup wire
+ *
+ * @param pcb The PCB.
+ * @return The port, or 0 if it isn't bound.
+ */
+extern u16_t lwip_posix_local_port(const struct udp_pcb* pcb);
+
+/**
+ * @brief Set the number of PBUFs that can be allocated (to run the pool short).
+ * @ingroup wire
+ *
+ * @param pbufs The number (up to LWIP_POSIX_PBUFS).
+ */
+extern void lwip_posix_pbuf_limit(uint32_t pbufs);
+
+/**
+ * @brief Pass the datagrams waiting on the PCB sockets to their receive functions.
+ * @ingroup wire
+ *
+ * @return The number of datagrams received.
+ */
+extern int lwip_posix_poll(void);
+
+/**
+ * @brief Get the host lwIP statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void lwip_posix_stats(lwip_posix_stats_t* stats);
+
+#endif // _LWIP_POSIX_H_
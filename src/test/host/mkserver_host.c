@@ -0,0 +1,316 @@
+/**
+ * MorseKOB Server stand-in for the host tests.
+ *
+ * The server side is a plain POSIX socket (it isn't lwIP). The packets of the
+ * streams are all built when the client gets on the wire, each with the time it is
+ * due to be sent, and are sent in time order as the clock moves.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "mkserver_host.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "mkboard.h"
+#include "mks.h"
+#include "mkspkt.h"
+#include "mkwire.h"
+#include "morse.h"
+#include "net.h"
+
+// The longest character (9 elements) is 18 code values, so stop filling a packet when there isn't room for that.
+#define _CHAR_CODE_MAX (2 * MORSE_MAX_DDS_IN_CHAR)
+#define _JITTER_STEP_MS 100
+
+typedef struct _packet_ {
+    uint32_t due;           // ms time to send it
+    int order;              // Order of packets due at the same time
+    int stream;
+    int32_t seqno;
+    int n;                  // Code elements (0 for an ID)
+    code_element_t code[MKS_CODESEQ_MAX_LEN];
+    bool sent;
+} _packet_t;
+
+static _packet_t* _packet_add(int stream, uint32_t due, int order, int32_t seqno);
+static void _packet_send(_packet_t* pkt);
+static void _recv(void);
+static void _send_to_client(const void* data, size_t len);
+static void _streams_build(uint32_t now);
+
+static int _fd = -1;
+static int _ack_drops;
+static struct sockaddr_in _client;
+static bool _client_valid;
+static mkserver_stats_t _stats;
+static mkserver_stream_t _streams[MKSERVER_HOST_STREAMS_MAX];
+static int _stream_count;
+static char _text_sent[MKSERVER_HOST_STREAMS_MAX][MKSERVER_HOST_TEXT_MAX + 1];
+static _packet_t _packets[MKSERVER_HOST_PACKETS_MAX];
+static int _packet_count;
+
+
+static _packet_t* _packet_add(int stream, uint32_t due, int order, int32_t seqno) {
+    if (_packet_count >= MKSERVER_HOST_PACKETS_MAX) {
+        printf("MKServer stand-in - Too many packets.\n");
+        return (NULL);
+    }
+    _packet_t* pkt = &_packets[_packet_count++];
+    memset(pkt, 0, sizeof(_packet_t));
+    pkt->due = due;
+    pkt->order = order;
+    pkt->stream = stream;
+    pkt->seqno = seqno;
+    return (pkt);
+}
+
+/*
+ * Send a packet to the client. It is built the way the client builds them.
+ */
+static void _packet_send(_packet_t* pkt) {
+    pbuf_t* p = mkwire_code_req(_streams[pkt->stream].station_id, pkt->seqno, pkt->code, pkt->n);
+    if (!p) {
+        // No PBUF. Try again on the next poll.
+        return;
+    }
+    _send_to_client(p->payload, p->len);
+    pbuf_free(p);
+    pkt->sent = true;
+}
+
+/*
+ * Receive and answer the client's packets.
+ */
+static void _recv(void) {
+    uint8_t pkt[MKSPKT_CODE_LEN + 16];
+    struct sockaddr_in sa;
+    socklen_t sa_len = sizeof(sa);
+    ssize_t len;
+
+    while ((len = recvfrom(_fd, pkt, sizeof(pkt), 0, (struct sockaddr*)&sa, &sa_len)) >= 0) {
+        int16_t cmd = (len >= 2 ? mkspkt_i16(pkt, MKSPKT_CW_OFFSET_CMD) : -1);
+        if (MKS_CMD_CONNECT == cmd && len >= (ssize_t)sizeof(mkspkt_cmd_wire_t)) {
+            _stats.connects++;
+            _stats.wire = mkspkt_i16(pkt, MKSPKT_CW_OFFSET_WIRE);
+            _client = sa;
+            _client_valid = true;
+            if (_stats.connects > (uint32_t)_ack_drops) {
+                mkspkt_cmd_wire_t ack = { MKS_CMD_ACK, _stats.wire };
+                _send_to_client(&ack, sizeof(ack));
+                _stats.acks++;
+            }
+        }
+        else if (MKS_CMD_DATA == cmd) {
+            char station_id[MKS_PKT_MAX_STRING_LEN + 1];
+            int32_t seqno;
+            int n = mkspkt_data_parse(pkt, (uint16_t)len, station_id, &seqno, NULL);
+            if (n < 0) {
+                _stats.invalid++;
+            }
+            else if (0 == n) {
+                _stats.ids++;
+                if (!_stats.on_wire) {
+                    _stats.on_wire = true;
+                    _streams_build(now_ms());
+                }
+            }
+        }
+        else if (MKS_CMD_DISCONNECT == cmd) {
+            _stats.disconnects++;
+            _stats.on_wire = false;
+        }
+        else {
+            _stats.invalid++;
+        }
+        sa_len = sizeof(sa);
+    }
+}
+
+static void _send_to_client(const void* data, size_t len) {
+    if (_client_valid) {
+        sendto(_fd, data, len, 0, (struct sockaddr*)&_client, sizeof(_client));
+        _stats.packets++;
+    }
+}
+
+/*
+ * Build the packets of the streams, and when each is to be sent.
+ */
+static void _streams_build(uint32_t now) {
+    _packet_count = 0;
+    for (int s = 0; s < _stream_count; s++) {
+        const mkserver_stream_t* stream = &_streams[s];
+        const char* script = (stream->script ? stream->script : "");
+        size_t script_len = strlen(script);
+        const char* text_next = stream->text;
+        char* text_sent = _text_sent[s];
+        int32_t seqno = 1000 * (s + 1);
+        uint32_t keyed = now + stream->start_ms;
+        int k = 0;
+        _packet_add(s, keyed, 0, seqno);  // The station's ID
+        while (*text_next) {
+            _packet_t* pkt = _packet_add(s, 0, 0, ++seqno);
+            if (!pkt) {
+                return;
+            }
+            // Fill the packet with code for the text, as a station does.
+            const char* text_start = text_next;
+            int32_t span = 0;
+            while (*text_next && (pkt->n + _CHAR_CODE_MAX) <= MKS_CODESEQ_MAX_LEN) {
+                mcode_seq_t* mcode_seq = morse_encode(*text_next++);
+                if (mcode_seq) {
+                    for (int i = 0; i < mcode_seq->len; i++) {
+                        code_element_t c = mcode_seq->code_seq[i];
+                        pkt->code[pkt->n++] = c;
+                        span += (c < 0 ? -c : c);
+                    }
+                    mcode_seq_free(mcode_seq);
+                }
+            }
+            // It is sent when the code before it has been keyed (as `mksim` does).
+            pkt->due = keyed;
+            keyed += span;
+            pkt->order = 2 * k;
+            _stats.code_packets++;
+            char action = ((size_t)k < script_len ? script[k] : '.');
+            if ('L' == action) {
+                _stats.lost++;
+                pkt->sent = true;
+            }
+            else {
+                size_t sent_len = strlen(text_sent);
+                size_t n = (size_t)(text_next - text_start);
+                if (sent_len + n <= MKSERVER_HOST_TEXT_MAX) {
+                    memcpy(text_sent + sent_len, text_start, n);
+                    text_sent[sent_len + n] = '\0';
+                }
+                if ('R' == action) {
+                    // Sent after the next one (its time is set when the next is built)
+                    _stats.reordered++;
+                    if ((uint32_t)span > _stats.reordered_ms_max) {
+                        _stats.reordered_ms_max = (uint32_t)span;
+                    }
+                    pkt->order = -1;
+                }
+                else if ('D' == action) {
+                    _stats.duplicated++;
+                    _packet_t* dup = _packet_add(s, pkt->due, pkt->order + 1, pkt->seqno);
+                    if (dup) {
+                        memcpy(dup->code, pkt->code, sizeof(pkt->code));
+                        dup->n = pkt->n;
+                    }
+                }
+                else if (action >= '1' && action <= '9') {
+                    _stats.delayed++;
+                    pkt->due += ((action - '0') * _JITTER_STEP_MS);
+                }
+            }
+            if (k > 0) {
+                _packet_t* prev = pkt - 1;
+                if (-1 == prev->order) {
+                    // The previous one was held to be sent after this one.
+                    prev->due = pkt->due;
+                    prev->order = pkt->order + 1;
+                }
+            }
+            k++;
+        }
+    }
+}
+
+bool mkserver_host_done(void) {
+    if (!_stats.on_wire && _stream_count > 0) {
+        return (false);
+    }
+    for (int i = 0; i < _packet_count; i++) {
+        if (!_packets[i].sent) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+void mkserver_host_poll(void) {
+    if (_fd < 0) {
+        return;
+    }
+    _recv();
+    if (!_stats.on_wire) {
+        return;
+    }
+    uint32_t now = now_ms();
+    for (;;) {
+        // The next packet due (the earliest, then by order)
+        _packet_t* next = NULL;
+        for (int i = 0; i < _packet_count; i++) {
+            _packet_t* pkt = &_packets[i];
+            if (!pkt->sent && (int32_t)(now - pkt->due) >= 0
+                && (!next || pkt->due < next->due || (pkt->due == next->due && pkt->order < next->order))) {
+                next = pkt;
+            }
+        }
+        if (!next) {
+            break;
+        }
+        _packet_send(next);
+        if (!next->sent) {
+            break;
+        }
+    }
+}
+
+uint16_t mkserver_host_start(int ack_drops) {
+    mkserver_host_stop();
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_text_sent, 0, sizeof(_text_sent));
+    _ack_drops = ack_drops;
+    _client_valid = false;
+    _stream_count = 0;
+    _packet_count = 0;
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_fd < 0) {
+        return (0);
+    }
+    fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL) | O_NONBLOCK);
+    struct sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = 0;
+    socklen_t sa_len = sizeof(sa);
+    if (bind(_fd, (struct sockaddr*)&sa, sizeof(sa)) != 0 || getsockname(_fd, (struct sockaddr*)&sa, &sa_len) != 0) {
+        mkserver_host_stop();
+        return (0);
+    }
+    return (ntohs(sa.sin_port));
+}
+
+void mkserver_host_stats(mkserver_stats_t* stats) {
+    memcpy(stats, &_stats, sizeof(mkserver_stats_t));
+}
+
+void mkserver_host_stop(void) {
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+}
+
+int mkserver_host_stream(const mkserver_stream_t* stream) {
+    if (_stream_count >= MKSERVER_HOST_STREAMS_MAX) {
+        return (-1);
+    }
+    _streams[_stream_count] = *stream;
+    return (_stream_count++);
+}
+
+const char* mkserver_host_text_sent(int stream) {
+    return (_text_sent[stream]);
+}
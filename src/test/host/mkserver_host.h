@@ -0,0 +1,124 @@
+/**
+ * MorseKOB Server stand-in for the host tests.
+ *
+ * A UDP socket on the loopback interface that answers the wire protocol the way
+ * the server does: a CONNECT is ACK'ed (unless the test has it drop some), and the
+ * client's ID puts it on the wire. Once the client is on the wire the scripted
+ * streams start. Each stream is a station keying a text. Its code packets are built
+ * the way a station builds them (like `mksim`) and are sent at the rate the code is
+ * keyed (each one the duration of the code in the one before it after it). A script says what happens to each packet on the way:
+ *
+ *   '.'  Sent when it is keyed
+ *   'L'  Lost (not sent)
+ *   'R'  Reordered (sent right after the next packet)
+ *   'D'  Duplicated (sent twice)
+ *   '1' to '9'  Delayed by that many 100ms (jitter)
+ *
+ * Packets past the end of the script are sent when keyed. The text of the packets
+ * that weren't lost is kept, for checking what is decoded.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _MKSERVER_HOST_H_
+#define _MKSERVER_HOST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MKSERVER_HOST_STREAMS_MAX 4
+#define MKSERVER_HOST_PACKETS_MAX 96     // Packets (all streams, including duplicates)
+#define MKSERVER_HOST_TEXT_MAX 128
+
+/**
+ * @brief A station keying a text on the wire.
+ * @ingroup wire
+ */
+typedef struct _mkserver_stream_ {
+    const char* station_id;
+    const char* text;
+    uint32_t start_ms;      // When the station starts keying, from when the client is on the wire
+    const char* script;     // What happens to each packet (see above), or NULL to send them all
+} mkserver_stream_t;
+
+/**
+ * @brief Server stand-in statistics.
+ * @ingroup wire
+ */
+typedef struct _mkserver_stats_ {
+    uint32_t connects;          // CONNECTs received
+    uint32_t acks;              // ACKs sent
+    uint32_t ids;               // IDs received from the client
+    uint32_t disconnects;       // DISCONNECTs received
+    uint32_t invalid;           // Packets received that weren't valid
+    int16_t wire;               // Wire of the last CONNECT
+    uint32_t packets;           // Packets sent to the client (IDs and code, including duplicates)
+    uint32_t code_packets;      // Code packets built
+    uint32_t lost;
+    uint32_t reordered;
+    uint32_t reordered_ms_max;  // Longest code time of a reordered packet (the one sent before it waits for it)
+    uint32_t duplicated;
+    uint32_t delayed;
+    bool on_wire;               // The client's ID has been received (and it hasn't disconnected)
+} mkserver_stats_t;
+
+/**
+ * @brief Indicate if all of the stream packets have been sent.
+ * @ingroup wire
+ */
+extern bool mkserver_host_done(void);
+
+/**
+ * @brief Receive the client's packets and send the stream packets that are due.
+ * @ingroup wire
+ *
+ * Called as the test's clock moves.
+ */
+extern void mkserver_host_poll(void);
+
+/**
+ * @brief Start the server stand-in on a loopback port.
+ * @ingroup wire
+ *
+ * The streams are cleared.
+ *
+ * @param ack_drops The number of CONNECTs (from the first) that aren't ACK'ed.
+ * @return The port, or 0 if the socket couldn't be set up.
+ */
+extern uint16_t mkserver_host_start(int ack_drops);
+
+/**
+ * @brief Get the server stand-in statistics.
+ * @ingroup wire
+ *
+ * @param stats Structure to fill in.
+ */
+extern void mkserver_host_stats(mkserver_stats_t* stats);
+
+/**
+ * @brief Stop the server stand-in (close the socket).
+ * @ingroup wire
+ */
+extern void mkserver_host_stop(void);
+
+/**
+ * @brief Add a stream. It starts when the client is on the wire.
+ * @ingroup wire
+ *
+ * @param stream The stream (the strings must stay valid while it is used).
+ * @return The stream number, or -1 if there are too many.
+ */
+extern int mkserver_host_stream(const mkserver_stream_t* stream);
+
+/**
+ * @brief Get the text in the code packets of a stream that were sent (not lost).
+ * @ingroup wire
+ *
+ * This is only complete after the stream has been sent (`mkserver_host_done`).
+ *
+ * @param stream The stream number.
+ */
+extern const char* mkserver_host_text_sent(int stream);
+
+#endif // _MKSERVER_HOST_H_
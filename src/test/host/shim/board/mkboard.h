@@ -0,0 +1,59 @@
+/**
+ * Host stub for the board functions used by the display.
+ *
+ * The backlight does nothing, the time is the host's monotonic clock, and the
+ * messages go to stdout.
+ *
+ * With MUKOB_HOST_CLOCK defined the time is the test's clock (`host_clock_us`),
+ * which only moves when the test moves it.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _MKBOARD_H_
+#define _MKBOARD_H_
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+static inline void display_backlight_on(bool on) {
+    (void)on;
+}
+
+#ifdef MUKOB_HOST_CLOCK
+extern uint64_t host_clock_us;
+
+static inline uint64_t now_us(void) {
+    return (host_clock_us);
+}
+#else
+static inline uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (((uint64_t)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000));
+}
+#endif
+
+static inline uint32_t now_ms(void) {
+    return ((uint32_t)(now_us() / 1000));
+}
+
+#define _MKBOARD_STUB_PRINTF(name) \
+    static inline void name(bool inc_dts, const char* format, ...) { \
+        va_list args; \
+        (void)inc_dts; \
+        va_start(args, format); \
+        vprintf(format, args); \
+        va_end(args); \
+    }
+
+_MKBOARD_STUB_PRINTF(debug_printf)
+_MKBOARD_STUB_PRINTF(error_printf)
+_MKBOARD_STUB_PRINTF(info_printf)
+_MKBOARD_STUB_PRINTF(warn_printf)
+
+#endif // _MKBOARD_H_
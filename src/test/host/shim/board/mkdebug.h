@@ -0,0 +1,23 @@
+/**
+ * Host stub for the board debug flags (always off).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _MKDEBUG_H_
+#define _MKDEBUG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DEBUGGING_MORSE_DECODE 0x0001
+#define DEBUGGING_MORSE_DECODE_SKIP 0x0002
+
+static const uint16_t debugging_flags = 0;
+
+static inline bool mk_debug(void) {
+    return (false);
+}
+
+#endif // _MKDEBUG_H_
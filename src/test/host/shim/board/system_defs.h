@@ -0,0 +1,17 @@
+/**
+ * Host stub for the board system definitions.
+ *
+ * The display and wire code only need the version and the SDK standard library from it.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SYSTEM_DEFS_H_
+#define _SYSTEM_DEFS_H_
+
+#define MuKOB_VERSION_INFO "MuKOB v0.1"
+
+#include "pico/stdlib.h"
+
+#endif // _SYSTEM_DEFS_H_
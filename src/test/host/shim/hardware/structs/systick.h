@@ -0,0 +1,29 @@
+/**
+ * Host shim for the Cortex-M0+ SysTick registers.
+ *
+ * The registers are plain memory, so the cycle timings read as 0 on the host.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_HARDWARE_STRUCTS_SYSTICK_H_
+#define _SHIM_HARDWARE_STRUCTS_SYSTICK_H_
+
+#include <stdint.h>
+
+#define M0PLUS_SYST_CSR_CLKSOURCE_BITS 0x00000004
+#define M0PLUS_SYST_CSR_COUNTFLAG_BITS 0x00010000
+#define M0PLUS_SYST_CSR_ENABLE_BITS 0x00000001
+
+typedef struct {
+    volatile uint32_t csr;
+    volatile uint32_t rvr;
+    volatile uint32_t cvr;
+    volatile uint32_t calib;
+} systick_hw_t;
+
+static systick_hw_t _shim_systick;
+#define systick_hw (&_shim_systick)
+
+#endif // _SHIM_HARDWARE_STRUCTS_SYSTICK_H_
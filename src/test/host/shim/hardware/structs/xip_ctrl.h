@@ -0,0 +1,26 @@
+/**
+ * Host shim for the RP2040 XIP (flash cache) control registers.
+ *
+ * The flush always reads as complete.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_HARDWARE_STRUCTS_XIP_CTRL_H_
+#define _SHIM_HARDWARE_STRUCTS_XIP_CTRL_H_
+
+#include <stdint.h>
+
+#define XIP_STAT_FLUSH_READY_BITS 0x00000001
+
+typedef struct {
+    volatile uint32_t ctrl;
+    volatile uint32_t flush;
+    volatile uint32_t stat;
+} xip_ctrl_hw_t;
+
+static xip_ctrl_hw_t _shim_xip_ctrl = { .stat = XIP_STAT_FLUSH_READY_BITS };
+#define xip_ctrl_hw (&_shim_xip_ctrl)
+
+#endif // _SHIM_HARDWARE_STRUCTS_XIP_CTRL_H_
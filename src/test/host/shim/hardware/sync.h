@@ -0,0 +1,31 @@
+/**
+ * Host shim for the Pico SDK interrupt enable/disable.
+ *
+ * The host tests are single threaded, so these do nothing.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_HARDWARE_SYNC_H_
+#define _SHIM_HARDWARE_SYNC_H_
+
+#include "pico.h"
+
+static inline uint32_t save_and_disable_interrupts(void) {
+    return (0);
+}
+
+static inline void restore_interrupts(uint32_t flags) {
+    (void)flags;
+}
+
+static inline void __mem_fence_acquire(void) {
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+static inline void __mem_fence_release(void) {
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+#endif // _SHIM_HARDWARE_SYNC_H_
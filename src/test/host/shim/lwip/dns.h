@@ -0,0 +1,13 @@
+/**
+ * Host shim for the lwIP DNS header.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_LWIP_DNS_H_
+#define _SHIM_LWIP_DNS_H_
+
+#include "lwip/ip_addr.h"
+
+#endif // _SHIM_LWIP_DNS_H_
@@ -0,0 +1,17 @@
+/**
+ * Host shim for the lwIP IP address (IPv4 only).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_LWIP_IP_ADDR_H_
+#define _SHIM_LWIP_IP_ADDR_H_
+
+#include "lwip/err.h"
+
+typedef struct ip_addr {
+    u32_t addr;     // Network byte order
+} ip_addr_t;
+
+#endif // _SHIM_LWIP_IP_ADDR_H_
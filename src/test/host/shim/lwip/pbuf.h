@@ -0,0 +1,47 @@
+/**
+ * Host shim for the lwIP packet buffers.
+ *
+ * A PBUF is a single block (never a chain). The number that can be allocated at
+ * once is limited, like the lwIP PBUF pool (see `lwip_posix.h`).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_LWIP_PBUF_H_
+#define _SHIM_LWIP_PBUF_H_
+
+#include <stddef.h>
+
+#include "lwip/err.h"
+
+typedef enum {
+    PBUF_TRANSPORT,
+    PBUF_IP,
+    PBUF_LINK,
+    PBUF_RAW,
+} pbuf_layer;
+
+typedef enum {
+    PBUF_RAM,
+    PBUF_ROM,
+    PBUF_REF,
+    PBUF_POOL,
+} pbuf_type;
+
+struct pbuf {
+    struct pbuf* next;
+    void* payload;
+    u16_t tot_len;
+    u16_t len;
+    u8_t ref;
+};
+
+extern struct pbuf* pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type);
+extern u16_t pbuf_copy_partial(const struct pbuf* p, void* dataptr, u16_t len, u16_t offset);
+extern u8_t pbuf_free(struct pbuf* p);
+extern void* pbuf_get_contiguous(const struct pbuf* p, void* buffer, size_t bufsize, u16_t len, u16_t offset);
+extern void pbuf_ref(struct pbuf* p);
+extern err_t pbuf_take(struct pbuf* p, const void* dataptr, u16_t len);
+
+#endif // _SHIM_LWIP_PBUF_H_
@@ -0,0 +1,30 @@
+/**
+ * Host shim for the lwIP UDP (raw API).
+ *
+ * The PCBs are POSIX UDP sockets (see `lwip_posix.h`). Received datagrams are
+ * passed to the receive function by `lwip_posix_poll`.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_LWIP_UDP_H_
+#define _SHIM_LWIP_UDP_H_
+
+#include "lwip/ip_addr.h"
+#include "lwip/pbuf.h"
+
+struct udp_pcb;
+
+typedef void (*udp_recv_fn)(void* arg, struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* addr, u16_t port);
+
+extern err_t udp_bind(struct udp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port);
+extern err_t udp_connect(struct udp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port);
+extern void udp_disconnect(struct udp_pcb* pcb);
+extern struct udp_pcb* udp_new(void);
+extern void udp_recv(struct udp_pcb* pcb, udp_recv_fn recv, void* recv_arg);
+extern void udp_remove(struct udp_pcb* pcb);
+extern err_t udp_send(struct udp_pcb* pcb, struct pbuf* p);
+extern err_t udp_sendto(struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* dst_ip, u16_t dst_port);
+
+#endif // _SHIM_LWIP_UDP_H_
@@ -0,0 +1,22 @@
+/**
+ * Host shim for the Pico SDK base header.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_H_
+#define _SHIM_PICO_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define __not_in_flash_func(f) f
+#define __time_critical_func(f) f
+
+#define panic(...) do { printf(__VA_ARGS__); printf("\n"); abort(); } while (0)
+
+#endif // _SHIM_PICO_H_
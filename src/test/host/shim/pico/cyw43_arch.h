@@ -0,0 +1,22 @@
+/**
+ * Host shim for the Pico SDK CYW43 architecture header.
+ *
+ * The host lwIP (`lwip_posix.c`) is only used from the test thread, so the lwIP
+ * lock does nothing.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_CYW43_ARCH_H_
+#define _SHIM_PICO_CYW43_ARCH_H_
+
+#include "pico.h"
+
+static inline void cyw43_arch_lwip_begin(void) {
+}
+
+static inline void cyw43_arch_lwip_end(void) {
+}
+
+#endif // _SHIM_PICO_CYW43_ARCH_H_
@@ -0,0 +1,16 @@
+/**
+ * Host shim for the Pico SDK multicore header.
+ *
+ * The host tests run the backend and UI message handling on one thread, so
+ * nothing is needed from it.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_MULTICORE_H_
+#define _SHIM_PICO_MULTICORE_H_
+
+#include "pico.h"
+
+#endif // _SHIM_PICO_MULTICORE_H_
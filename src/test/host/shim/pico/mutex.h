@@ -0,0 +1,38 @@
+/**
+ * Host shim for the Pico SDK mutex.
+ *
+ * The host tests are single threaded. The mutex only checks that it is entered
+ * and exited in pairs.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_MUTEX_H_
+#define _SHIM_PICO_MUTEX_H_
+
+#include "pico.h"
+#include "hardware/sync.h"
+
+typedef struct _shim_mutex_ {
+    int entered;
+} mutex_t;
+
+#define auto_init_mutex(name) static mutex_t name
+
+static inline void mutex_enter_blocking(mutex_t* mtx) {
+    if (mtx->entered) {
+        panic("mutex entered while held");
+    }
+    mtx->entered = 1;
+}
+
+static inline void mutex_exit(mutex_t* mtx) {
+    mtx->entered = 0;
+}
+
+static inline void mutex_init(mutex_t* mtx) {
+    mtx->entered = 0;
+}
+
+#endif // _SHIM_PICO_MUTEX_H_
@@ -0,0 +1,23 @@
+/**
+ * Host shim for the Pico SDK printf (the function output version).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_PRINTF_H_
+#define _SHIM_PICO_PRINTF_H_
+
+#include <stdarg.h>
+#include <stdio.h>
+
+static inline int vfctprintf(void (*out)(char c, void* arg), void* arg, const char* format, va_list va) {
+    char buf[256];
+    int len = vsnprintf(buf, sizeof(buf), format, va);
+    for (int i = 0; i < len && i < (int)sizeof(buf) - 1; i++) {
+        out(buf[i], arg);
+    }
+    return (len);
+}
+
+#endif // _SHIM_PICO_PRINTF_H_
@@ -0,0 +1,13 @@
+/**
+ * Host shim for the Pico SDK stdio header.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_STDIO_H_
+#define _SHIM_PICO_STDIO_H_
+
+#include <stdio.h>
+
+#endif // _SHIM_PICO_STDIO_H_
@@ -0,0 +1,16 @@
+/**
+ * Host shim for the Pico SDK standard library header.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_STDLIB_H_
+#define _SHIM_PICO_STDLIB_H_
+
+#include "pico.h"
+
+static inline void tight_loop_contents(void) {
+}
+
+#endif // _SHIM_PICO_STDLIB_H_
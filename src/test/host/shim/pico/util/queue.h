@@ -0,0 +1,15 @@
+/**
+ * Host shim for the Pico SDK queue header.
+ *
+ * The message queues are provided by the host CMT (`cmt_host.c`).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _SHIM_PICO_UTIL_QUEUE_H_
+#define _SHIM_PICO_UTIL_QUEUE_H_
+
+#include "pico.h"
+
+#endif // _SHIM_PICO_UTIL_QUEUE_H_
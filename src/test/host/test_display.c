@@ -0,0 +1,175 @@
+/**
+ * Display text printing test, against the host framebuffer.
+ *
+ * Runs the ILI display code (`display_ili.c`) on the framebuffer backend and checks
+ * what ends up on the screen: the word wrap of `disp_printc`, and scrolling (with
+ * and without fixed areas), which moves the text through the frame memory with the
+ * vertical scroll start rather than repainting it.
+ *
+ * Each character cell on the screen is compared with the glyph drawn by the
+ * reference (bit at a time) expander. A PPM of the screen is written at the end of
+ * each check, to look at if it fails.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "host_test.h"
+
+#include <string.h>
+
+#include "display.h"
+#include "font_10_16.h"
+#include "glyph_cache.h"
+#include "ili_fb.h"
+
+#define _COLS 24
+#define _LINES 20
+
+/*
+ * Check that a character cell on the screen shows a character.
+ */
+static bool _cell_is(uint16_t line, uint16_t col, char c, colorn16_t fg, colorn16_t bg) {
+    const font_info_t* fi = &font_10_16;
+    rgb16_t expected[FONT_HEIGHT_MAX * FONT_HEIGHT_MAX];
+    glyph_expand_per_bit(fi, c, rgb16_from_color16(fg), rgb16_from_color16(bg), expected, fi->width);
+    for (int y = 0; y < fi->height; y++) {
+        for (int x = 0; x < fi->width; x++) {
+            if (ili_fb_pixel((col * fi->width) + x, (line * fi->height) + y) != expected[(y * fi->width) + x]) {
+                return (false);
+            }
+        }
+    }
+    return (true);
+}
+
+/*
+ * Check that a line on the screen shows a text (followed by spaces), in the default colors.
+ */
+static bool _line_is(uint16_t line, const char* text) {
+    size_t len = strlen(text);
+    for (uint16_t col = 0; col < _COLS; col++) {
+        char c = (col < len ? text[col] : ' ');
+        if (!_cell_is(line, col, c, C16_WHITE, C16_BLACK)) {
+            printf("Line %hu column %hu isn't '%c' (expected '%s')\n", line, col, c, text);
+            return (false);
+        }
+    }
+    return (true);
+}
+
+static void _print(const char* s, paint_control_t paint) {
+    while (*s) {
+        disp_printc(*s++, paint);
+    }
+}
+
+/*
+ * Word wrap. A word that doesn't fit is moved to the next line.
+ */
+static void _test_wrap(paint_control_t paint) {
+    disp_scroll_area_define(0, 0);
+    disp_clear(Paint);
+    disp_print_wrap_len_set(10);
+    // 'JUMPS' doesn't fit on the first line (24 columns)
+    _print("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG", paint);
+    disp_paint();
+    HT_CHECK(_line_is(0, "THE QUICK BROWN FOX"));
+    HT_CHECK(_line_is(1, "JUMPS OVER THE LAZY DOG"));
+    HT_CHECK(_line_is(2, ""));
+    // No break in reach (a long word) - it is split at the margin
+    disp_clear(Paint);
+    _print("ABCDEFGHIJKLMNOPQRSTUVWXYZ", paint);
+    disp_paint();
+    HT_CHECK(_line_is(0, "ABCDEFGHIJKLMNOPQRSTUVWX"));
+    HT_CHECK(_line_is(1, "YZ"));
+    // Break after a punctuation mark
+    disp_clear(Paint);
+    _print("0123456789012345678,ABCDEFGH", paint);
+    disp_paint();
+    HT_CHECK(_line_is(0, "0123456789012345678,"));
+    HT_CHECK(_line_is(1, "ABCDEFGH"));
+    HT_CHECK(ili_fb_ppm_write((paint ? "display_wrap_paint.ppm" : "display_wrap.ppm")));
+}
+
+/*
+ * Scroll a full screen (no fixed areas).
+ */
+static void _test_scroll(paint_control_t paint) {
+    char text[8];
+    ili_stats_t is;
+
+    disp_scroll_area_define(0, 0);
+    disp_clear(Paint);
+    // 25 lines on a 20 line screen scrolls it 5 lines
+    for (int i = 0; i < 25; i++) {
+        if (i > 0) {
+            disp_print_crlf(0, paint);
+        }
+        snprintf(text, sizeof(text), "L%02d", i);
+        _print(text, paint);
+    }
+    disp_paint();
+    for (int line = 0; line < _LINES; line++) {
+        snprintf(text, sizeof(text), "L%02d", line + 5);
+        HT_CHECK(_line_is(line, text));
+    }
+    // The text was scrolled in the frame memory, not repainted
+    ili_stats(&is);
+    HT_CHECK_EQ(0, is.scroll_top_fixed);
+    HT_CHECK_EQ(320, is.scroll_height);
+    HT_CHECK_EQ(5 * 16, is.scroll_start);
+    HT_CHECK_EQ(5 * 16, ili_fb_row(0));
+    HT_CHECK(ili_fb_ppm_write((paint ? "display_scroll_paint.ppm" : "display_scroll.ppm")));
+}
+
+/*
+ * Scroll between fixed top and bottom lines, around the scroll area more than once.
+ */
+static void _test_scroll_fixed(paint_control_t paint) {
+    char text[8];
+    ili_stats_t is;
+
+    disp_scroll_area_define(1, 1);
+    disp_clear(Paint);
+    disp_string(0, 0, "TOP", false, Paint);
+    disp_string(_LINES - 1, 0, "BOTTOM", false, Paint);
+    // 40 lines in an 18 line scroll area
+    for (int i = 0; i < 40; i++) {
+        if (i > 0) {
+            disp_print_crlf(0, paint);
+        }
+        snprintf(text, sizeof(text), "S%02d", i);
+        _print(text, paint);
+    }
+    disp_paint();
+    HT_CHECK(_line_is(0, "TOP"));
+    for (int line = 1; line < _LINES - 1; line++) {
+        snprintf(text, sizeof(text), "S%02d", line - 1 + (40 - 18));
+        HT_CHECK(_line_is(line, text));
+    }
+    HT_CHECK(_line_is(_LINES - 1, "BOTTOM"));
+    ili_stats(&is);
+    HT_CHECK_EQ(16, is.scroll_top_fixed);
+    HT_CHECK_EQ(320 - 32, is.scroll_height);
+    HT_CHECK_EQ(16, is.scroll_bottom_fixed);
+    // Scrolled 22 lines, wrapping once in the 18 line area
+    HT_CHECK_EQ((1 + (22 - 18)) * 16, is.scroll_start);
+    HT_CHECK(ili_fb_ppm_write((paint ? "display_scroll_fixed_paint.ppm" : "display_scroll_fixed.ppm")));
+}
+
+int main(void) {
+    disp_module_init();
+    HT_CHECK_EQ(_COLS, disp_info_columns());
+    HT_CHECK_EQ(_LINES, disp_info_lines());
+
+    // Painting as it goes, and painting once at the end (as the UI does)
+    _test_wrap(Paint);
+    _test_wrap(No_Paint);
+    _test_scroll(Paint);
+    _test_scroll(No_Paint);
+    _test_scroll_fixed(Paint);
+    _test_scroll_fixed(No_Paint);
+
+    return (HT_RESULT());
+}
@@ -0,0 +1,140 @@
+/**
+ * Font glyph decoding test.
+ *
+ * Reads the BDF font that the compiled (packed) font was generated from, and checks
+ * that every glyph decoded by `font_glyph_rows` is the BDF bitmap. The bold and the
+ * double size (large) styles are checked against the BDF bitmap with the style
+ * applied here a pixel at a time.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "font_10_16.h"
+
+#ifndef MUKOB_FONT_BDF
+#define MUKOB_FONT_BDF "font_10_16.bdf"
+#endif
+
+static uint32_t _bdf_rows[FONT_GLYPHS][FONT_HEIGHT_MAX];
+static bool _bdf_found[FONT_GLYPHS];
+
+/*
+ * Read the glyphs (codes 0-127) of a BDF font into `_bdf_rows`, the same as
+ * `font_compile.py` does (a glyph bitmap is placed in the font cell by its BBX).
+ */
+static bool _bdf_read(const char* path, int* width, int* height) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        printf("Can't open %s\n", path);
+        return (false);
+    }
+    char line[128];
+    int fbb_w = 0, fbb_h = 0, fbb_x = 0, fbb_y = 0;
+    int code = -1;
+    int bw = 0, bh = 0, bx = 0, by = 0;
+    int r = -1;         // Bitmap row being read (-1 when not in a bitmap)
+    while (fgets(line, sizeof(line), f)) {
+        if (r >= 0) {
+            if (0 == strncmp(line, "ENDCHAR", 7)) {
+                r = -1;
+                continue;
+            }
+            int digits = strspn(line, "0123456789abcdefABCDEF");
+            uint32_t bits = (uint32_t)strtoul(line, NULL, 16) >> ((digits * 4) - bw);
+            int top = (fbb_y + fbb_h) - (by + bh);
+            int col = bx - fbb_x;
+            if (code >= 0 && code < FONT_GLYPHS && r < bh && top + r >= 0 && top + r < fbb_h) {
+                _bdf_rows[code][top + r] = (bits << (fbb_w - col - bw)) & ((1u << fbb_w) - 1);
+                _bdf_found[code] = true;
+            }
+            r++;
+        }
+        else if (0 == strncmp(line, "FONTBOUNDINGBOX ", 16)) {
+            sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &fbb_w, &fbb_h, &fbb_x, &fbb_y);
+        }
+        else if (0 == strncmp(line, "ENCODING ", 9)) {
+            sscanf(line, "ENCODING %d", &code);
+        }
+        else if (0 == strncmp(line, "BBX ", 4)) {
+            sscanf(line, "BBX %d %d %d %d", &bw, &bh, &bx, &by);
+        }
+        else if (0 == strncmp(line, "BITMAP", 6)) {
+            r = 0;
+        }
+    }
+    fclose(f);
+    *width = fbb_w;
+    *height = fbb_h;
+
+    return (fbb_w > 0 && fbb_h > 0 && fbb_h <= FONT_HEIGHT_MAX);
+}
+
+/*
+ * Check the decoded glyphs of a font against the BDF glyphs with a style applied.
+ */
+static void _test_style(const font_info_t* fi, int bdf_height) {
+    bool bold = (fi->style & FONT_STYLE_BOLD);
+    int scale = ((fi->style & FONT_STYLE_DOUBLE) ? 2 : 1);
+    int mismatches = 0;
+
+    for (int c = 0; c < FONT_GLYPHS; c++) {
+        uint32_t rows[FONT_HEIGHT_MAX];
+        uint32_t expected[FONT_HEIGHT_MAX];
+        memset(rows, 0, sizeof(rows));
+        memset(expected, 0, sizeof(expected));
+        font_glyph_rows(fi, c, rows);
+        for (int y = 0; y < fi->height; y++) {
+            uint32_t src = _bdf_rows[c][y / scale];
+            int src_width = fi->width / scale;
+            // Build the row a pixel at a time, left to right
+            for (int x = 0; x < fi->width; x++) {
+                int sx = x / scale;
+                int bit = src_width - 1 - sx;
+                bool set = (src >> bit) & 1u;
+                if (bold && sx > 0) {
+                    // Bold also sets the pixel to the right of each set pixel
+                    set = set || ((src >> (bit + 1)) & 1u);
+                }
+                if (set) {
+                    expected[y] |= (1u << (fi->width - 1 - x));
+                }
+            }
+        }
+        if (memcmp(expected, rows, sizeof(rows)) != 0) {
+            if (0 == mismatches) {
+                printf("%s: char 0x%02X differs\n", fi->name, c);
+                for (int y = 0; y < fi->height; y++) {
+                    printf("  %06X %06X\n", expected[y], rows[y]);
+                }
+            }
+            mismatches++;
+        }
+    }
+    HT_CHECK_EQ(bdf_height * scale, fi->height);
+    HT_CHECK_EQ(0, mismatches);
+}
+
+int main(void) {
+    int width, height;
+
+    HT_CHECK(_bdf_read(MUKOB_FONT_BDF, &width, &height));
+    HT_CHECK_EQ(width, font_10_16.width);
+    HT_CHECK_EQ(height, font_10_16.height);
+    int found = 0;
+    for (int c = 0; c < FONT_GLYPHS; c++) {
+        found += (_bdf_found[c] ? 1 : 0);
+    }
+    HT_CHECK_EQ(FONT_GLYPHS, found);
+
+    _test_style(&font_10_16, height);
+    _test_style(&font_10_16_bold, height);
+    _test_style(&font_10_16_large, height);
+
+    return (HT_RESULT());
+}
@@ -0,0 +1,141 @@
+/**
+ * Glyph expansion test and benchmark.
+ *
+ * Checks that the nibble table expander (`glyph_expand`) renders exactly what the
+ * reference (bit at a time) expander does, for every character of each font style,
+ * in every foreground/background pair of the 16 colors. Each is rendered into a word
+ * aligned and an unaligned (odd pixel) position of a buffer filled with a marker, so
+ * both ways of writing the table patterns are checked, and that nothing is written
+ * outside of the glyph. The glyphs from the glyph cache are checked as well.
+ *
+ * Then both expanders are timed. The times are printed, not checked, as the host
+ * (and the sanitizers) aren't the Cortex-M0+.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "host_test.h"
+
+#include <string.h>
+#include <time.h>
+
+#include "display.h"
+#include "font_10_16.h"
+#include "glyph_cache.h"
+
+#define _MARKER 0xA55Au
+#define _STRIDE (2 * FONT_HEIGHT_MAX)   // Wider than the widest font, and even
+#define _BUF_PIXELS ((FONT_HEIGHT_MAX * _STRIDE) + 2)
+#define _TIMED_PASSES 4
+
+static const font_info_t* _fonts[] = {
+    &font_10_16,
+    &font_10_16_bold,
+    &font_10_16_large,
+};
+
+static rgb16_t _expected[_BUF_PIXELS];
+static rgb16_t _actual[_BUF_PIXELS];
+
+/*
+ * Fill a buffer with the marker.
+ */
+static void _buf_mark(rgb16_t* buf) {
+    for (int i = 0; i < _BUF_PIXELS; i++) {
+        buf[i] = _MARKER;
+    }
+}
+
+/*
+ * Time rendering every character in every color pair (ns per glyph).
+ */
+static uint32_t _expand_timed(const font_info_t* fi, bool table) {
+    struct timespec start, end;
+    uint32_t glyphs = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int pass = 0; pass < _TIMED_PASSES; pass++) {
+        for (int color = 0; color < 256; color++) {
+            rgb16_t fg = rgb16_from_color16(color & 0x0F);
+            rgb16_t bg = rgb16_from_color16(color >> 4);
+            for (int c = 0; c < FONT_GLYPHS; c++) {
+                if (table) {
+                    glyph_expand(fi, c, fg, bg, _actual, _STRIDE);
+                }
+                else {
+                    glyph_expand_per_bit(fi, c, fg, bg, _actual, _STRIDE);
+                }
+                glyphs++;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    uint64_t ns = ((uint64_t)(end.tv_sec - start.tv_sec) * 1000000000u) + end.tv_nsec - start.tv_nsec;
+
+    return ((uint32_t)(ns / glyphs));
+}
+
+/*
+ * Check `glyph_expand` against `glyph_expand_per_bit` for a font, at a pixel offset
+ * into the buffer (0 is word aligned, 1 isn't).
+ */
+static void _test_expand(const font_info_t* fi, int offset) {
+    int mismatches = 0;
+
+    for (int color = 0; color < 256; color++) {
+        rgb16_t fg = rgb16_from_color16(color & 0x0F);
+        rgb16_t bg = rgb16_from_color16(color >> 4);
+        for (int c = 0; c < FONT_GLYPHS; c++) {
+            _buf_mark(_expected);
+            _buf_mark(_actual);
+            glyph_expand_per_bit(fi, c, fg, bg, _expected + offset, _STRIDE);
+            glyph_expand(fi, c, fg, bg, _actual + offset, _STRIDE);
+            if (memcmp(_expected, _actual, sizeof(_expected)) != 0) {
+                if (0 == mismatches) {
+                    printf("%s: char 0x%02X fg %d bg %d offset %d differs\n", fi->name, c, color & 0x0F, color >> 4, offset);
+                }
+                mismatches++;
+            }
+        }
+    }
+    HT_CHECK_EQ(0, mismatches);
+}
+
+/*
+ * Check the glyphs from the cache against `glyph_expand_per_bit` for a font.
+ */
+static void _test_cache(const font_info_t* fi) {
+    int mismatches = 0;
+    int pixels = fi->width * fi->height;
+
+    for (int color = 0; color < 256; color++) {
+        colorbyte_t cb = colorbyte(color & 0x0F, color >> 4);
+        for (int c = 0; c < FONT_GLYPHS; c++) {
+            const rgb16_t* glyph = glyph_cache_get(fi, c, cb);
+            HT_CHECK(glyph != NULL);
+            if (!glyph) {
+                return;
+            }
+            glyph_expand_per_bit(fi, c, rgb16_from_color16(fg_from_cb(cb)), rgb16_from_color16(bg_from_cb(cb)), _expected, fi->width);
+            if (memcmp(_expected, glyph, pixels * sizeof(rgb16_t)) != 0) {
+                mismatches++;
+            }
+        }
+    }
+    HT_CHECK_EQ(0, mismatches);
+}
+
+int main(void) {
+    for (size_t i = 0; i < (sizeof(_fonts) / sizeof(_fonts[0])); i++) {
+        const font_info_t* fi = _fonts[i];
+        _test_expand(fi, 0);
+        _test_expand(fi, 1);
+        _test_cache(fi);
+        uint32_t per_bit_ns = _expand_timed(fi, false);
+        uint32_t table_ns = _expand_timed(fi, true);
+        printf("%s: Render a glyph: Bit at a time:%uns Nibble table:%uns\n", fi->name, per_bit_ns, table_ns);
+    }
+
+    return (HT_RESULT());
+}
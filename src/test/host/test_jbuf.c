@@ -0,0 +1,125 @@
+/**
+ * Jitter buffer trace replay.
+ *
+ * Replays a recorded packet arrival trace (sequence number and arrival time)
+ * through the jitter buffer, a millisecond at a time, and checks the order the
+ * sequences are played in and the duplicate/late/lost/reordered counts.
+ *
+ * The trace has a delayed packet (arriving after the one that follows it), a
+ * duplicate of it while it is held, a lost packet, a very late duplicate of a
+ * packet already played, and the lost packet arriving after it was played through.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "host_test.h"
+
+#include "jbuf.h"
+#include "mks.h"
+#include "mkstation.h"
+
+#define _STATION ((mk_station_handle_t)3)
+#define _TRACE_END_MS 6000
+#define _PLAYED_MAX 16
+
+typedef struct _trace_entry_ {
+    uint32_t ts;
+    int32_t seqno;
+} _trace_entry_t;
+
+static const _trace_entry_t _trace[] = {
+    {    0, 1 },
+    {  525, 2 },
+    { 1050, 4 },    // 3 is delayed
+    { 1100, 3 },    // Out of order
+    { 1120, 3 },    // Duplicate (while 3 is held)
+    { 2100, 5 },
+                    // 6 is lost
+    { 3150, 7 },
+    { 3200, 2 },    // Duplicate (long after 2 was played)
+    { 3500, 6 },    // Late (7 has been played)
+    { 3675, 8 },
+};
+#define _TRACE_LEN ((int)(sizeof(_trace) / sizeof(_trace[0])))
+
+static const int32_t _expected_order[] = { 1, 2, 3, 4, 5, 7, 8 };
+#define _EXPECTED_LEN ((int)(sizeof(_expected_order) / sizeof(_expected_order[0])))
+
+// Counts reported for the station (by `mkstation_seq_count`)
+static int _station_duplicates;
+static int _station_reordered;
+static int _station_lost;
+
+void mkstation_seq_count(mk_station_handle_t handle, int duplicates, int reordered, int lost) {
+    if (handle == _STATION) {
+        _station_duplicates += duplicates;
+        _station_reordered += reordered;
+        _station_lost += lost;
+    }
+}
+
+/*
+ * The code for a sequence number. The last mark's length identifies it when it is played.
+ */
+static mcode_seq_t* _code(int32_t seqno) {
+    code_element_t code[] = { -120, 60, -60, 180, -60, 40 + seqno };
+    return (mcode_seq_alloc(MCODE_SRC_WIRE, code, 6));
+}
+
+int main(void) {
+    int32_t played[_PLAYED_MAX];
+    bool played_break[_PLAYED_MAX];
+    int nplayed = 0;
+    int next = 0;
+    jbuf_stats_t stats;
+
+    mks_module_init();
+    jbuf_module_init();
+
+    for (uint32_t now = 0; now < _TRACE_END_MS; now++) {
+        bool new_sender = (now == 0);
+        while (next < _TRACE_LEN && _trace[next].ts == now) {
+            mcode_seq_t* mcs = _code(_trace[next].seqno);
+            mcs->ts_recv = now + 1;
+            jbuf_put(mcs, _trace[next].seqno, _STATION, new_sender, now);
+            next++;
+        }
+        mcode_seq_t* mcs;
+        int32_t wait_ms;
+        while ((mcs = jbuf_take(now, &wait_ms)) != NULL) {
+            // The receive time is kept (including when a long break is prepended)
+            HT_CHECK(mcs->ts_recv > 0 && mcs->ts_recv <= now + 1);
+            if (nplayed < _PLAYED_MAX) {
+                played[nplayed] = mcs->code_seq[mcs->len - 1] - 40;
+                played_break[nplayed] = (mcs->code_seq[0] == mcode_long_break);
+                nplayed++;
+            }
+            mcode_seq_free(mcs);
+        }
+    }
+
+    HT_CHECK_EQ(_EXPECTED_LEN, nplayed);
+    for (int i = 0; i < _EXPECTED_LEN && i < nplayed; i++) {
+        HT_CHECK_EQ(_expected_order[i], played[i]);
+        // A long break is played before the first sequence and after the lost one
+        HT_CHECK_EQ((played[i] == 1 || played[i] == 7), played_break[i]);
+    }
+
+    jbuf_stats(&stats);
+    printf("played: %u  duplicates: %u  late: %u  lost: %u  reordered: %u  overflow: %u  target: %dms  jitter: %dms\n",
+        stats.played, stats.duplicates, stats.late_drops, stats.lost, stats.reordered, stats.overflow_drops,
+        stats.target_ms, stats.jitter_ms);
+    HT_CHECK_EQ(0, stats.depth);
+    HT_CHECK_EQ(_EXPECTED_LEN, stats.played);
+    HT_CHECK_EQ(2, stats.duplicates);
+    HT_CHECK_EQ(1, stats.late_drops);
+    HT_CHECK_EQ(1, stats.lost);
+    HT_CHECK_EQ(1, stats.reordered);
+    HT_CHECK_EQ(0, stats.overflow_drops);
+    HT_CHECK_EQ(2, _station_duplicates);
+    HT_CHECK_EQ(1, _station_reordered);
+    HT_CHECK_EQ(1, _station_lost);
+
+    return (HT_RESULT());
+}
@@ -0,0 +1,123 @@
+/**
+ * Operation pool handle test.
+ *
+ * Drives the pool the way the UDP operation callbacks in net.c do, with the DNS
+ * result, receive, and timeout callbacks interleaved, and checks that exactly
+ * one callback gets each step and that stale handles stay stale when a slot is
+ * reused.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "host_test.h"
+
+#include "oppool.h"
+
+// Callbacks that got the operation (like the handlers in net.c, they do nothing if the handle is stale)
+static int _dns_found_ran;
+static int _timeout_ran;
+static int _recv_ran;
+
+/*
+ * A DNS result. Claims the step, moves the operation on to waiting for a response.
+ */
+static bool _dns_found(oppool_handle_t handle, oppool_handle_t* next) {
+    if (oppool_claim(handle, next) < 0) {
+        return (false);
+    }
+    _dns_found_ran++;
+    return (true);
+}
+
+/*
+ * A response received. Finishes the operation.
+ */
+static bool _recv(oppool_handle_t handle) {
+    int i = oppool_claim(handle, NULL);
+    if (i < 0) {
+        return (false);
+    }
+    _recv_ran++;
+    oppool_free(i);
+    return (true);
+}
+
+/*
+ * A timeout (for the DNS lookup or the response). Finishes the operation.
+ */
+static bool _timeout(oppool_handle_t handle) {
+    int i = oppool_claim(handle, NULL);
+    if (i < 0) {
+        return (false);
+    }
+    _timeout_ran++;
+    oppool_free(i);
+    return (true);
+}
+
+int main(void) {
+    oppool_handle_t h, h_dns, h_next, h_reuse;
+    int slot, slot_reuse;
+
+    // Timeout first, then the DNS result arrives (stale)
+    slot = oppool_alloc(&h);
+    HT_CHECK(slot >= 0);
+    h_dns = h;                      // The handle given to the DNS lookup and the timeout
+    HT_CHECK(_timeout(h));
+    HT_CHECK(!_dns_found(h_dns, &h_next));
+    HT_CHECK_EQ(1, _timeout_ran);
+    HT_CHECK_EQ(0, _dns_found_ran);
+    HT_CHECK_EQ(0, oppool_in_use());
+
+    // The slot is reused. The old handle stays stale, for the DNS result and a late timeout.
+    slot_reuse = oppool_alloc(&h_reuse);
+    HT_CHECK_EQ(slot, slot_reuse);
+    HT_CHECK(h_reuse != h_dns);
+    HT_CHECK(!_dns_found(h_dns, &h_next));
+    HT_CHECK(!_timeout(h_dns));
+    HT_CHECK_EQ(1, oppool_in_use());
+
+    // DNS result first, then the DNS timeout (stale). Then the response, then its timeout (stale).
+    HT_CHECK(_dns_found(h_reuse, &h_next));
+    HT_CHECK(h_next != h_reuse);
+    HT_CHECK(!_timeout(h_reuse));
+    HT_CHECK_EQ(1, oppool_in_use());
+    HT_CHECK(_recv(h_next));
+    HT_CHECK(!_timeout(h_next));
+    HT_CHECK(!_recv(h_next));
+    HT_CHECK_EQ(1, _dns_found_ran);
+    HT_CHECK_EQ(1, _recv_ran);
+    HT_CHECK_EQ(1, _timeout_ran);
+    HT_CHECK_EQ(0, oppool_in_use());
+
+    // DNS result, then the response timeout before the response (the response is stale)
+    slot = oppool_alloc(&h);
+    HT_CHECK(_dns_found(h, &h_next));
+    HT_CHECK(_timeout(h_next));
+    HT_CHECK(!_recv(h_next));
+    HT_CHECK_EQ(2, _timeout_ran);
+    HT_CHECK_EQ(0, oppool_in_use());
+
+    // The pool runs out, and a freed slot can be used again
+    oppool_handle_t handles[OPPOOL_SIZE];
+    for (int i = 0; i < OPPOOL_SIZE; i++) {
+        HT_CHECK(oppool_alloc(&handles[i]) >= 0);
+    }
+    HT_CHECK_EQ(-1, oppool_alloc(&h));
+    HT_CHECK(_timeout(handles[1]));
+    HT_CHECK_EQ(1, oppool_alloc(&h));
+    HT_CHECK(h != handles[1]);
+    // Handles for the other slots aren't affected
+    for (int i = 0; i < OPPOOL_SIZE; i++) {
+        HT_CHECK_EQ((i != 1), _timeout(handles[i]));
+    }
+    HT_CHECK(_timeout(h));
+    HT_CHECK_EQ(0, oppool_in_use());
+
+    // A handle that isn't for a slot at all
+    HT_CHECK(!_timeout(OPPOOL_SIZE));
+    HT_CHECK(!_timeout(0xFFFFFFFF));
+
+    return (HT_RESULT());
+}
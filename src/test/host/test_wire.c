@@ -0,0 +1,471 @@
+/**
+ * Wire receive path test, over a loopback socket to a server stand-in.
+ *
+ * Runs the wire code (`mkwire.c`, the playout buffer, the station store and the
+ * packet parser) on the host lwIP (`lwip_posix.c`), connected to the server
+ * stand-in (`mkserver_host.c`). The clock is the test's, moved a millisecond at a
+ * time. Each millisecond the server sends what is due, the received datagrams are
+ * passed to the wire code, and the backend messages are handled the way the
+ * backend does. The code sequences played out are decoded by a Morse decoder.
+ *
+ * The checks are on what the server sees (CONNECT, ACK, ID), what is decoded
+ * against the text that was sent, the playout buffer counts against what the
+ * server did to the packets, and the receive to decode latency.
+ *
+ * The on-device server stand-in (`mksim.c`) is run as well, through the wire
+ * receive injection, with its own pass/fail.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "host_test.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "cmt_host.h"
+#include "config.h"
+#include "jbuf.h"
+#include "kob.h"
+#include "lwip_posix.h"
+#include "mkboard.h"
+#include "mkcap.h"
+#include "mkmonitor.h"
+#include "mks.h"
+#include "mkserver_host.h"
+#include "mksim.h"
+#include "mkstation.h"
+#include "mkwire.h"
+#include "morse.h"
+#include "net.h"
+
+#define _WIRE 108
+#define _WPM 20
+#define _DECODED_MAX 512
+#define _DRAIN_MS 10000     // Time to let the playout buffer and decoder finish (longer than the code in a packet)
+#define _RUN_MS_MAX (5 * 60 * 1000)
+
+static const char* _text1 = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 1234567890";
+static const char* _text2 = "NOW IS THE TIME FOR ALL GOOD MEN TO COME TO THE AID";
+
+static uint16_t _server_port;
+static morse_decoder_t _decoder;
+static char _decoded[_DECODED_MAX];
+static uint32_t _sequences;
+static uint32_t _latency_ms_max;
+
+// *** Stand-ins for the modules the wire code uses that aren't part of the test ***
+
+static config_t _config;
+static kob_status_t _kob_status;
+
+config_t* config_current_for_modification() {
+    return (&_config);
+}
+
+void config_indicate_changed() {
+}
+
+const kob_status_t* kob_status() {
+    return (&_kob_status);
+}
+
+bool mkcap_recording() {
+    return (false);
+}
+
+void mkcap_record(bool sent, uint64_t ts_us, const uint8_t* pkt, uint16_t len) {
+}
+
+void mkcap_module_init() {
+}
+
+void mkmonitor_connect(const char* hostname, uint16_t port) {
+}
+
+void mkmonitor_disconnect() {
+}
+
+void mkmonitor_keep_alive_send() {
+}
+
+void mkmonitor_wire_swap(uint16_t wire, uint16_t new_wire) {
+}
+
+void mkmonitor_module_init() {
+}
+
+err_enum_t net_dns_prefetch(const char* hostname) {
+    return (ERR_OK);
+}
+
+/*
+ * Bind a socket and connect it to the server stand-in (the host name and port
+ * given to the wire aren't used).
+ */
+err_enum_t udp_socket_bind(const char* hostname, uint16_t port, udp_bind_handler_fn bind_handler) {
+    struct udp_pcb* pcb = udp_new();
+    if (!pcb) {
+        return (ERR_MEM);
+    }
+    ip_addr_t addr = lwip_posix_loopback();
+    if (udp_bind(pcb, &addr, 0) != ERR_OK || udp_connect(pcb, &addr, _server_port) != ERR_OK) {
+        udp_remove(pcb);
+        return (ERR_CONN);
+    }
+    bind_handler(ERR_OK, pcb);
+    return (ERR_OK);
+}
+
+void udp_socket_bind_cancel() {
+}
+
+// *** Test ***
+
+/*
+ * Decoder text handler. Collects the text.
+ */
+static void _decoded_text(const char* text, void* handler_data) {
+    size_t len = strlen(_decoded);
+    strncat(_decoded, text, sizeof(_decoded) - len - 1);
+}
+
+/*
+ * A code sequence played out by the wire. Decode it and record its latency.
+ */
+static void _sequence_played(mcode_seq_t* mcode_seq) {
+    uint32_t latency = now_ms() - mcode_seq->ts_recv;
+    _sequences++;
+    if (latency > _latency_ms_max) {
+        _latency_ms_max = latency;
+    }
+    morse_decoder_decode(&_decoder, mcode_seq);
+    mksim_decoded(mcode_seq);
+    mcode_seq_free(mcode_seq);
+}
+
+/*
+ * Handle the backend messages, as the backend does. The queues are read by core
+ * number, as the message loops do (the backend is core 0).
+ */
+static void _be_msgs_handle() {
+    cmt_msg_t msg;
+    while (get_core0_msg_nowait(&msg)) {
+        switch (msg.id) {
+            case MSG_MKS_ACK_TIMEOUT:
+                mkwire_ack_timeout();
+                break;
+            case MSG_MKS_KEEP_ALIVE_SEND:
+                mkwire_keep_alive_send();
+                break;
+            case MSG_MKS_PACKET_RECEIVED:
+                mkwire_recv_process();
+                break;
+            case MSG_MKS_SIM_SEND:
+                mksim_send();
+                break;
+            case MSG_MORSE_CODE_SEQUENCE:
+                _sequence_played(msg.data.mcode_seq);
+                break;
+            case MSG_WIRE_CODE_PLAYOUT:
+                mkwire_code_playout();
+                break;
+            default:
+                break;
+        }
+    }
+    // The UI messages aren't needed
+    while (get_core1_msg_nowait(&msg)) {
+    }
+}
+
+/*
+ * Run for a time, a millisecond at a time.
+ */
+static void _run_ms(uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        cmt_host_tick_ms();
+        mkserver_host_poll();
+        lwip_posix_poll();
+        _be_msgs_handle();
+        morse_decoder_flush_check(&_decoder, now_ms());
+    }
+}
+
+/*
+ * Run until the server has sent the streams, then let the code play out.
+ */
+static void _run_streams() {
+    uint32_t ms = 0;
+    while (!mkserver_host_done() && ms < _RUN_MS_MAX) {
+        _run_ms(1);
+        ms++;
+    }
+    HT_CHECK(mkserver_host_done());
+    _run_ms(_DRAIN_MS);
+}
+
+/*
+ * Count the breaks in the decoded text. The decoder shows a break in the code (the
+ * start of a sender, or lost code) as a '*'.
+ */
+static int _text_breaks(const char* text) {
+    int breaks = 0;
+    while (*text) {
+        if ('*' == *text++) {
+            breaks++;
+        }
+    }
+    return (breaks);
+}
+
+/*
+ * Copy text without the spaces or breaks (for comparing what was decoded when code
+ * was lost, as the word spaces on either side of a gap can't be known).
+ */
+static void _text_no_spaces(char* dst, const char* src) {
+    while (*src) {
+        if (!isspace((unsigned char)*src) && *src != '*') {
+            *dst++ = *src;
+        }
+        src++;
+    }
+    *dst = '\0';
+}
+
+/*
+ * Copy text with the breaks and leading/trailing spaces removed, and runs of spaces
+ * made one.
+ */
+static void _text_words(char* dst, const char* src) {
+    char* d = dst;
+    const char* start = src;
+    while (*src) {
+        if (!isspace((unsigned char)*src) && *src != '*') {
+            if (d != dst && src != start && (isspace((unsigned char)src[-1]) || '*' == src[-1])) {
+                *d++ = ' ';
+            }
+            *d++ = *src;
+        }
+        src++;
+    }
+    *d = '\0';
+}
+
+/*
+ * Start a run: the server stand-in, the decoder, and the counts.
+ */
+static void _run_start(int ack_drops) {
+    cmt_host_reset();
+    _server_port = mkserver_host_start(ack_drops);
+    HT_CHECK(_server_port != 0);
+    morse_decoder_init(&_decoder, _decoded_text, NULL);
+    memset(_decoded, 0, sizeof(_decoded));
+    _sequences = 0;
+    _latency_ms_max = 0;
+}
+
+/*
+ * End a run: disconnect, and check that the server saw it and no PBUF was left allocated.
+ */
+static void _run_end() {
+    lwip_posix_stats_t ls;
+    mkserver_stats_t ss;
+
+    mkwire_disconnect();
+    _run_ms(10);
+    mkserver_host_stats(&ss);
+    HT_CHECK_EQ(1, ss.disconnects);
+    HT_CHECK_EQ(0, ss.invalid);
+    mkserver_host_stop();
+    lwip_posix_stats(&ls);
+    HT_CHECK_EQ(0, ls.pbufs_used);
+}
+
+/*
+ * Connect, with the first ACK lost: the CONNECT is sent again after the ACK timeout,
+ * then the ID is sent. Then a text is sent cleanly and decoded.
+ */
+static void _test_clean() {
+    mkserver_stats_t ss;
+    mkwire_link_stats_t link;
+    jbuf_stats_t js_start, js;
+    char expected[_DECODED_MAX], decoded[_DECODED_MAX];
+
+    _run_start(1);
+    mkserver_stream_t stream = { "STATION A", _text1, 1000, NULL };
+    mkserver_host_stream(&stream);
+    jbuf_stats(&js_start);
+    mkwire_connect(_WIRE);
+    _run_ms(MKWIRE_ACK_TIMEOUT_MS + 100);
+    mkserver_host_stats(&ss);
+    mkwire_link_stats(&link);
+    HT_CHECK_EQ(2, ss.connects);
+    HT_CHECK_EQ(1, ss.acks);
+    HT_CHECK_EQ(1, ss.ids);
+    HT_CHECK_EQ(_WIRE, ss.wire);
+    HT_CHECK_EQ(WIRE_LINK_UP, link.state);
+    HT_CHECK_EQ(1, link.ack_timeouts);
+    // The CONNECT was sent twice, so the RTT isn't measured
+    HT_CHECK_EQ(-1, link.rtt_ms);
+
+    _run_streams();
+    _text_words(expected, mkserver_host_text_sent(0));
+    _text_words(decoded, _decoded);
+    HT_CHECK(0 == strcmp(expected, decoded));
+    if (strcmp(expected, decoded) != 0) {
+        printf("Sent:    '%s'\nDecoded: '%s'\n", expected, decoded);
+    }
+    // The start of the sender is the only break
+    HT_CHECK_EQ(1, _text_breaks(_decoded));
+    mkserver_host_stats(&ss);
+    jbuf_stats(&js);
+    HT_CHECK_EQ(ss.code_packets, _sequences);
+    HT_CHECK_EQ(0, js.lost - js_start.lost);
+    HT_CHECK_EQ(0, js.reordered - js_start.reordered);
+    HT_CHECK_EQ(0, js.duplicates - js_start.duplicates);
+    // Evenly spaced packets are held for the initial playout delay (or less, as it adapts).
+    HT_CHECK(_latency_ms_max <= JBUF_TARGET_INIT_MS);
+    printf("Clean: %u sequences, latency max %ums\n", _sequences, _latency_ms_max);
+
+    _run_end();
+}
+
+/*
+ * A text sent with packets lost, reordered, duplicated and delayed.
+ */
+static void _test_impaired() {
+    mkserver_stats_t ss;
+    jbuf_stats_t js_start, js;
+    char expected[_DECODED_MAX], decoded[_DECODED_MAX];
+
+    char text[_DECODED_MAX];
+
+    _run_start(0);
+    snprintf(text, sizeof(text), "%s %s", _text1, _text2);
+    mkserver_stream_t stream = { "STATION B", text, 500, ".R.L.D.3.9R.L." };
+    mkserver_host_stream(&stream);
+    jbuf_stats(&js_start);
+    mkwire_connect(_WIRE);
+    _run_streams();
+
+    _text_no_spaces(expected, mkserver_host_text_sent(0));
+    _text_no_spaces(decoded, _decoded);
+    HT_CHECK(0 == strcmp(expected, decoded));
+    if (strcmp(expected, decoded) != 0) {
+        printf("Sent:    '%s'\nDecoded: '%s'\n", expected, decoded);
+    }
+    mkserver_host_stats(&ss);
+    jbuf_stats(&js);
+    HT_CHECK_EQ(2, ss.lost);
+    HT_CHECK_EQ(2, ss.reordered);
+    HT_CHECK_EQ(1, ss.duplicated);
+    HT_CHECK_EQ(ss.code_packets - ss.lost, _sequences);
+    HT_CHECK_EQ(ss.lost, js.lost - js_start.lost);
+    HT_CHECK_EQ(ss.reordered, js.reordered - js_start.reordered);
+    HT_CHECK_EQ(ss.duplicated, js.duplicates - js_start.duplicates);
+    HT_CHECK_EQ(0, js.late_drops - js_start.late_drops);
+    // The start of the sender and each lost packet are breaks
+    HT_CHECK_EQ(1 + ss.lost, _text_breaks(_decoded));
+    // The longest delay is 900ms, and a packet sent after a reordered one waits for it to be played.
+    HT_CHECK(_latency_ms_max <= MKSIM_LATENCY_LIMIT_MS + 900 + ss.reordered_ms_max);
+    printf("Impaired: %u sequences, latency max %ums\n", _sequences, _latency_ms_max);
+
+    _run_end();
+}
+
+/*
+ * Two stations taking turns. Both texts are decoded, in turn, and the current
+ * sender follows.
+ */
+static void _test_two_stations() {
+    char expected[2 * _DECODED_MAX], decoded[_DECODED_MAX];
+
+    _run_start(0);
+    mkserver_stream_t stream1 = { "STATION C", _text1, 500, NULL };
+    mkserver_stream_t stream2 = { "STATION D", _text2, 40000, ".D.2" };
+    mkserver_host_stream(&stream1);
+    mkserver_host_stream(&stream2);
+    mkwire_connect(_WIRE);
+    _run_streams();
+
+    snprintf(expected, sizeof(expected), "%s %s", mkserver_host_text_sent(0), mkserver_host_text_sent(1));
+    _text_words(decoded, _decoded);
+    HT_CHECK(0 == strcmp(expected, decoded));
+    if (strcmp(expected, decoded) != 0) {
+        printf("Sent:    '%s'\nDecoded: '%s'\n", expected, decoded);
+    }
+    // The start of each sender is a break
+    HT_CHECK_EQ(2, _text_breaks(_decoded));
+    HT_CHECK(mkstation_find("STATION C") != MK_STATION_NONE);
+    HT_CHECK(mkstation_find("STATION D") != MK_STATION_NONE);
+    HT_CHECK_EQ(mkstation_find("STATION D"), mkwire_current_sender());
+
+    _run_end();
+}
+
+/*
+ * The PBUFs run out while connected. The CONNECT of the keep alive can't be sent,
+ * so the ACK times out, and it is sent when there are PBUFs again.
+ */
+static void _test_pbufs_out() {
+    mkserver_stats_t ss;
+    mkwire_link_stats_t link_start, link;
+
+    _run_start(0);
+    mkwire_connect(_WIRE);
+    _run_ms(100);
+    mkwire_link_stats(&link_start);
+    lwip_posix_pbuf_limit(0);
+    _run_ms(MKS_KEEP_ALIVE_TIME);
+    mkserver_host_stats(&ss);
+    HT_CHECK_EQ(1, ss.connects);
+    lwip_posix_pbuf_limit(LWIP_POSIX_PBUFS);
+    _run_ms(MKWIRE_ACK_TIMEOUT_MS + 100);
+    mkserver_host_stats(&ss);
+    mkwire_link_stats(&link);
+    HT_CHECK_EQ(2, ss.connects);
+    HT_CHECK_EQ(2, ss.ids);
+    HT_CHECK_EQ(1, link.ack_timeouts - link_start.ack_timeouts);
+    HT_CHECK_EQ(WIRE_LINK_UP, link.state);
+
+    _run_end();
+}
+
+/*
+ * The on-device server stand-in, putting packets into the receive path while the
+ * wire isn't connected.
+ */
+static void _test_mksim() {
+    mksim_stats_t ms;
+    mksim_params_t params = { 2, 5, 5, 5, 300 };
+
+    _run_start(0);
+    mkserver_host_stop();
+    mksim_start(&params);
+    _run_ms(60 * 1000);
+    mksim_stop();
+    _run_ms(_DRAIN_MS);
+    mksim_stats(&ms);
+    printf("MKSim: %u packets, %u decoded, latency avg %ums max %ums (limit %ums)\n",
+        ms.packets, ms.decoded, ms.latency_ms_avg, ms.latency_ms_max, ms.latency_ms_limit);
+    HT_CHECK(ms.decoded > 0);
+    HT_CHECK(ms.pass);
+    HT_CHECK(strstr(_decoded, "QUICK") != NULL || strstr(_decoded, "LAZY") != NULL);
+}
+
+int main(void) {
+    cmt_host_reset();
+    mks_module_init();
+    morse_module_init(_WPM, _WPM, CODE_TYPE_INTERNATIONAL, CODE_SPACING_NONE);
+    mkwire_module_init("localhost", 7890, "HOST TEST", 1);
+
+    _test_clean();
+    _test_impaired();
+    _test_two_stations();
+    _test_pbufs_out();
+    _test_mksim();
+
+    return (HT_RESULT());
+}
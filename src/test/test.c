@@ -105,6 +105,68 @@ void test_disp_show_half_width_scroll_barberpoll() {
     }
 }
 
+// A QSO on a wire, as it was copied (the '=' are the breaks where a new line is started)
+static const char* _test_qso[] = {
+    "ES ES ES DE WA = ",
+    "WA GA 73 ED HW ON THE WIRE TODAY = ",
+    "FB ES OK HR WX IS CLEAR AND COLD THIS MORNING ABT TWENTY DEGREES = ",
+    "HR WE HAD SNOW LAST NITE BUT IT IS GONE NOW ",
+    "GOT THE NEW SOUNDER ON THE TABLE AND IT SOUNDS FINE ON THIS WIRE = ",
+    "GLAD TO HEAR IT OM THE OLD ONE WAS GETTING TIRED = ",
+    "YES IT WAS THE RELAY WAS STICKING TOO SO I CLEANED THE CONTACTS ",
+    "AND ADJUSTED THE SPRING = ",
+    "THAT SHUD DO IT I NEED TO DO THE SAME HR SOMETIME SOON = ",
+    "WELL I WILL LET U GO FOR NOW GOT TO GET TO WORK 73 ES CUL = ",
+    "73 ED CUL GN = ",
+    NULL
+};
+
+void test_disp_code_text_throughput(int passes) {
+    disp_stats_t ds_start, ds_end;
+    uint32_t chars = 0;
+    disp_stats(&ds_start);
+    uint64_t start = now_us();
+    for (int pass = 0; pass < passes; pass++) {
+        for (const char** line = _test_qso; *line; line++) {
+            // Print the line a word (or a few characters) at a time, like the code text arrives
+            const char* s = *line;
+            char piece[8];
+            while (*s) {
+                int n = 0;
+                while (*s && n < (sizeof(piece) - 1)) {
+                    char c = *s++;
+                    piece[n++] = c;
+                    if (' ' == c) {
+                        break;
+                    }
+                }
+                piece[n] = '\000';
+                chars += n;
+                char* brk = strchr(piece, '=');
+                if (brk) {
+                    *brk = '\000';
+                    disp_prints(piece, No_Paint);
+                    disp_print_crlf(0, No_Paint);
+                    disp_prints(brk + 1, No_Paint);
+                }
+                else {
+                    disp_prints(piece, No_Paint);
+                }
+                disp_paint();
+            }
+        }
+    }
+    ili_paint_wait();
+    uint32_t elapsed_us = (uint32_t)(now_us() - start);
+    disp_stats(&ds_end);
+    printf("Code text: %u characters in %uus (%u chars/sec)\n", chars, elapsed_us,
+        (elapsed_us ? (uint32_t)(((uint64_t)chars * 1000000) / elapsed_us) : 0));
+    printf("  Lines scrolled:%u Scroll sets:%u Spans painted:%u Pixel bytes:%u Control bytes:%u\n",
+        ds_end.scroll_lines - ds_start.scroll_lines, ds_end.scroll_starts - ds_start.scroll_starts,
+        ds_end.spans_painted - ds_start.spans_painted, ds_end.spi_pixel_bytes - ds_start.spi_pixel_bytes,
+        ds_end.spi_control_bytes - ds_start.spi_control_bytes);
+}
+
 void test_error_printf() {
     error_printf(false, "Test of printing an error: %d.\n", 15u);
 }
@@ -40,6 +40,18 @@ void test_disp_show_full_scroll_barberpoll();
  */
 void test_disp_show_half_width_scroll_barberpoll();
 
+/**
+ * @brief Print a long QSO (as code text) to the display and report the throughput.
+ * @ingroup test
+ *
+ * The text is printed in small pieces, the way it arrives from the decoder, and
+ * the display is painted after each piece. The time taken, the characters per second,
+ * and the scrolling and SPI traffic are printed to the terminal.
+ *
+ * @param passes The number of times to print the QSO.
+ */
+void test_disp_code_text_throughput(int passes);
+
 /**
  * @brief Test printing an error to the terminal.
  * @ingroup test
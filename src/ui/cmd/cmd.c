@@ -11,9 +11,16 @@
 
 #include "config.h"
 #include "cmt.h"
+#include "disp_cmdq.h"
+#include "display.h"
+#include "jbuf.h"
+#include "mkcap.h"
 #include "mkdebug.h"
+#include "mkmonitor.h"
+#include "mksim.h"
 #include "mkwire.h"
 #include "morse.h"
+#include "ntp.h"
 #include "term.h"
 #include "ui_term.h"
 #include "util.h"
@@ -28,12 +35,18 @@ static char _cmdline_parsed[UI_TERM_GETLINE_MAX_LEN_];
 
 // Command processor declarations
 static int _cmd_connect(int argc, char** argv, const char* unparsed);
+static int _cmd_disp_bench(int argc, char** argv, const char* unparsed);
+static int _cmd_disp_status(int argc, char** argv, const char* unparsed);
 static int _cmd_encode(int argc, char** argv, const char* unparsed);
 static int _cmd_help(int argc, char** argv, const char* unparsed);
 static int _cmd_keys(int argc, char** argv, const char* unparsed);
+static int _cmd_monitor(int argc, char** argv, const char* unparsed);
 static int _cmd_proc_status(int argc, char** argv, const char* unparsed);
 static int _cmd_speed(int argc, char** argv, const char* unparsed);
 static int _cmd_wire(int argc, char** argv, const char* unparsed);
+static int _cmd_wire_capture(int argc, char** argv, const char* unparsed);
+static int _cmd_wire_sim(int argc, char** argv, const char* unparsed);
+static int _cmd_wire_status(int argc, char** argv, const char* unparsed);
 
 // Command processors framework
 static const cmd_handler_entry_t _cmd_connect_entry = {
@@ -43,6 +56,20 @@ static const cmd_handler_entry_t _cmd_connect_entry = {
     "[wire-number]",
     "Connect/disconnect (toggle) the current wire. Connect to a specific wire.",
 };
+static const cmd_handler_entry_t _cmd_disp_bench_entry = {
+    _cmd_disp_bench,
+    3,
+    ".dbench",
+    "[count]",
+    "Time painting the full display (a pixel at a time and using DMA), rendering glyphs, and\n  rendering a line with the font in flash and in RAM.\n",
+};
+static const cmd_handler_entry_t _cmd_disp_status_entry = {
+    _cmd_disp_status,
+    3,
+    ".ds",
+    "",
+    "Display the display (rendering) status.\n",
+};
 static const cmd_handler_entry_t _cmd_encode_entry = {
     _cmd_encode,
     1,
@@ -64,6 +91,13 @@ static const cmd_handler_entry_t _cmd_keys_entry = {
     "",
     "List of the keyboard control key actions.\n",
 };
+static const cmd_handler_entry_t _cmd_monitor_entry = {
+    _cmd_monitor,
+    3,
+    "monitor",
+    "[wire-number]",
+    "Display the monitored wires and their code. Start/stop (toggle) monitoring a wire.",
+};
 static const cmd_handler_entry_t _cmd_proc_status_entry = {
     _cmd_proc_status,
     3,
@@ -85,13 +119,39 @@ static const cmd_handler_entry_t _cmd_wire_entry = {
     "[wire-number]",
     "Display the current wire. Set the wire number.",
 };
+static const cmd_handler_entry_t _cmd_wire_capture_entry = {
+    _cmd_wire_capture,
+    4,
+    ".wcap",
+    "[start [file] | play [file] [speed] | stop]",
+    "Display the status of, start, or stop capturing the wire packets to a file.\n  play : Replay a capture (when not connected) at a multiple of real time.\n",
+};
+static const cmd_handler_entry_t _cmd_wire_sim_entry = {
+    _cmd_wire_sim,
+    4,
+    ".wsim",
+    "[start [stations] [loss-%] [reorder-%] [dup-%] [jitter-ms] | stop]",
+    "Display the status of, start, or stop the MorseKOB Server stand-in (when not connected).\n",
+};
+static const cmd_handler_entry_t _cmd_wire_status_entry = {
+    _cmd_wire_status,
+    3,
+    ".ws",
+    "",
+    "Display wire (network) status.\n",
+};
 
 /**
  * @brief List of Command Handlers
  */
 static const cmd_handler_entry_t* _command_entries[] = {
-    & cmd_mkdebug_entry,        // .debug - 'DOT' commands come first
+    & _cmd_disp_bench_entry,    // .dbench - 'DOT' commands come first
+    & cmd_mkdebug_entry,        // .debug
+    & _cmd_disp_status_entry,   // .ds
     & _cmd_proc_status_entry,   // .ps
+    & _cmd_wire_capture_entry,  // .wcap
+    & _cmd_wire_status_entry,   // .ws
+    & _cmd_wire_sim_entry,      // .wsim
     & cmd_bootcfg_entry,
     & cmd_cfg_entry,
     & cmd_configure_entry,
@@ -100,6 +160,7 @@ static const cmd_handler_entry_t* _command_entries[] = {
     & _cmd_help_entry,
     & _cmd_keys_entry,
     & cmd_load_entry,
+    & _cmd_monitor_entry,
     & cmd_save_entry,
     & _cmd_speed_entry,
     & cmd_station_entry,
@@ -156,6 +217,79 @@ static int _cmd_connect(int argc, char** argv, const char* unparsed) {
     return (0);
 }
 
+static int _cmd_disp_bench(int argc, char** argv, const char* unparsed) {
+    int count = 4;
+    if (argc > 2) {
+        cmd_help_display(&_cmd_disp_bench_entry, HELP_DISP_USAGE);
+        return (-1);
+    }
+    if (argc > 1) {
+        bool success;
+        count = uint_from_str(argv[1], &success);
+        if (!success || count < 1) {
+            cmd_help_display(&_cmd_disp_bench_entry, HELP_DISP_USAGE);
+            return (-1);
+        }
+    }
+    uint32_t blocking_us = 0;
+    uint32_t dma_us = 0;
+    disp_stats_t ds_start, ds_end;
+    disp_stats(&ds_start);
+    for (int i = 0; i < count; i++) {
+        blocking_us += disp_paint_timed(false);
+        dma_us += disp_paint_timed(true);
+    }
+    disp_stats(&ds_end);
+    blocking_us /= count;
+    dma_us /= count;
+    ui_term_printf("Full screen paint (avg of %d): Pixel at a time:%uus DMA:%uus\n", count, blocking_us, dma_us);
+    uint32_t paints = (2 * count);
+    ui_term_printf("  Sent per paint: Pixel bytes:%u Control bytes:%u Transfers:%u\n",
+        (ds_end.spi_pixel_bytes - ds_start.spi_pixel_bytes) / paints,
+        (ds_end.spi_control_bytes - ds_start.spi_control_bytes) / paints,
+        (ds_end.spi_pixel_writes - ds_start.spi_pixel_writes) / paints);
+    uint32_t per_bit_us = disp_glyph_render_timed(false, 1000);
+    uint32_t table_us = disp_glyph_render_timed(true, 1000);
+    ui_term_printf("Render 1000 glyphs (no cache): Bit at a time:%uus Nibble table:%uus\n", per_bit_us, table_us);
+    uint32_t decode_us = disp_glyph_decode_timed(1000);
+    ui_term_printf("Decode 1000 glyphs from the packed font: %uus\n", decode_us);
+    uint32_t flash_cold = disp_line_render_cycles(false, true);
+    uint32_t flash_warm = disp_line_render_cycles(false, false);
+    uint32_t ram_cold = disp_line_render_cycles(true, true);
+    uint32_t ram_warm = disp_line_render_cycles(true, false);
+    ui_term_printf("Render a line (cycles): Font in flash: %u (XIP cache flushed) %u (cached)  Font in RAM: %u (XIP cache flushed) %u (cached)\n",
+        flash_cold, flash_warm, ram_cold, ram_warm);
+    if (!(flash_cold && flash_warm && ram_cold && ram_warm)) {
+        ui_term_printf("  (0 is a render that couldn't be measured)\n");
+    }
+
+    return (0);
+}
+
+static int _cmd_disp_status(int argc, char** argv, const char* unparsed) {
+    if (argc > 1) {
+        cmd_help_display(&_cmd_disp_status_entry, HELP_DISP_USAGE);
+    }
+    disp_stats_t ds;
+    disp_stats(&ds);
+    uint32_t lookups = ds.glyph_cache_hits + ds.glyph_cache_misses;
+    ui_term_printf("Glyph cache: Glyphs:%hu (of %hu) Hits:%u Misses:%u Hit rate:%u%% Evictions:%u\n",
+        ds.glyph_cache_used, ds.glyph_cache_size, ds.glyph_cache_hits, ds.glyph_cache_misses,
+        (lookups ? (uint32_t)(((uint64_t)ds.glyph_cache_hits * 100) / lookups) : 0), ds.glyph_cache_evictions);
+    disp_cmdq_stats_t qs;
+    disp_cmdq_stats(&qs);
+    ui_term_printf("Command queue: Depth:%hu (max %hu of %hu) Queued:%u Coalesced:%u Applied:%u Batches:%u Overflows:%u\n",
+        qs.depth, qs.depth_max, qs.size, qs.queued, qs.coalesced, qs.applied, qs.batches, qs.overflows);
+    ui_term_printf("Painting: Spans:%u Span merges:%u Commands/span:%u.%02u\n", ds.spans_painted, ds.span_merges,
+        (ds.spans_painted ? qs.applied / ds.spans_painted : 0), (ds.spans_painted ? (uint32_t)((((uint64_t)qs.applied * 100) / ds.spans_painted) % 100) : 0));
+    ui_term_printf("SPI: Pixel bytes:%u Control bytes:%u Transfers:%u\n", ds.spi_pixel_bytes, ds.spi_control_bytes, ds.spi_pixel_writes);
+    ui_term_printf("Font: Packed:%u bytes Unpacked:%u bytes (%u%% smaller) In:%s\n", ds.font_data_bytes, ds.font_unpacked_bytes,
+        (ds.font_unpacked_bytes ? 100 - ((ds.font_data_bytes * 100) / ds.font_unpacked_bytes) : 0), (ds.font_in_ram ? "RAM" : "Flash"));
+    ui_term_printf("Scroll: Lines:%u Scroll sets:%u Scroll row:%hu\n", ds.scroll_lines, ds.scroll_starts, ds.scroll_start);
+
+    return (0);
+}
+
 static int _cmd_encode(int argc, char** argv, const char* unparsed) {
     if (argc < 2) {
         cmd_help_display(&_cmd_encode_entry, HELP_DISP_USAGE);
@@ -256,6 +390,64 @@ static void _cmd_ps_print(const proc_status_accum_t* ps, int corenum) {
         corenum, ps->core_temp, ps->retrived, ps->idle, ps->t_active, ps->t_idle, ps->t_msgr, uaf, ps->int_status);
 }
 
+static int _cmd_monitor(int argc, char** argv, const char* unparsed) {
+    if (argc > 2) {
+        cmd_help_display(&_cmd_monitor_entry, HELP_DISP_USAGE);
+        return (-1);
+    }
+    mkmonitor_status_t ms;
+    if (argc == 2) {
+        bool success;
+        uint16_t wire = (uint16_t)uint_from_str(argv[1], &success);
+        if (!success) {
+            ui_term_printf("Value error - '%s' is not a number.\n", argv[1]);
+            return (-1);
+        }
+        if (wire < 1 || wire > 999) {
+            ui_term_puts("Wire number must be 1 to 999.\n");
+            return (-1);
+        }
+        if (wire == mkwire_wire_get()) {
+            ui_term_puts("The current wire can't be monitored.\n");
+            return (-1);
+        }
+        bool monitored = mkmonitor_is_monitored(wire);
+        if (!monitored) {
+            int in_use = 0;
+            for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+                in_use += (mkmonitor_status(i, &ms) ? 1 : 0);
+            }
+            if (in_use == MK_MONITOR_WIRES) {
+                ui_term_printf("Only %d wires can be monitored.\n", MK_MONITOR_WIRES);
+                return (-1);
+            }
+        }
+        ui_term_printf("%s wire %hu...\n", (monitored ? "Stop monitoring" : "Monitoring"), wire);
+        cmt_msg_t msg;
+        msg.id = MSG_WIRE_MONITOR_TOGGLE;
+        msg.data.wire = wire;
+        postBEMsgBlocking(&msg);
+        return (0);
+    }
+    char buf[MK_MONITOR_SCROLLBACK_SIZE + 1];
+    int count = 0;
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        if (mkmonitor_status(i, &ms)) {
+            count++;
+            ui_term_printf("Wire %hu (%s) Stations:%d Sender:%s\n", ms.wire,
+                (ms.connected ? "connected" : (ms.ack_wait ? "connecting" : "not connected")), ms.stations, ms.sender);
+            if (mkmonitor_scrollback(i, buf, MK_MONITOR_SCROLLBACK_SIZE) > 0) {
+                ui_term_puts(buf);
+                ui_term_puts("\n");
+            }
+        }
+    }
+    if (count == 0) {
+        ui_term_puts("No wires are being monitored.\n");
+    }
+    return (0);
+}
+
 static int _cmd_proc_status(int argc, char** argv, const char* unparsed) {
     if (argc > 1) {
         cmd_help_display(&_cmd_proc_status_entry, HELP_DISP_USAGE);
@@ -353,6 +545,143 @@ static int _cmd_wire(int argc, char** argv, const char* unparsed) {
     return (0);
 }
 
+static int _cmd_wire_capture(int argc, char** argv, const char* unparsed) {
+    if (argc == 2 && strcmp(argv[1], "stop") == 0) {
+        mkcap_stop();
+        return (0);
+    }
+    if (argc > 1 && argc <= 3 && strcmp(argv[1], "start") == 0) {
+        return (mkcap_start(argc > 2 ? argv[2] : MKCAP_FILENAME_DEFAULT) ? 0 : -1);
+    }
+    if (argc > 1 && argc <= 4 && strcmp(argv[1], "play") == 0) {
+        if (mkwire_is_connected()) {
+            ui_term_puts("Disconnect from the wire first.\n");
+            return (-1);
+        }
+        uint32_t speed = 1;
+        if (argc > 3) {
+            bool success;
+            speed = uint_from_str(argv[3], &success);
+            if (!success || speed < 1 || speed > MKCAP_REPLAY_SPEED_MAX) {
+                ui_term_printf("Value error - speed must be 1 to %d.\n", MKCAP_REPLAY_SPEED_MAX);
+                return (-1);
+            }
+        }
+        return (mkcap_replay_start((argc > 2 ? argv[2] : MKCAP_FILENAME_DEFAULT), (uint16_t)speed) ? 0 : -1);
+    }
+    if (argc > 1) {
+        cmd_help_display(&_cmd_wire_capture_entry, HELP_DISP_USAGE);
+        return (-1);
+    }
+    mkcap_stats_t cs;
+    mkcap_stats(&cs);
+    if (cs.replaying) {
+        ui_term_printf("Replaying '%s' (x%hu): Records:%u Bytes read:%u Dropped:%u\n",
+            cs.filename, cs.speed, cs.records, cs.bytes, cs.drops);
+    }
+    else {
+        ui_term_printf("Capture: %s '%s' Records:%u Bytes written:%u Dropped:%u Write errors:%u Write us Max:%u\n",
+            (cs.recording ? "Recording" : "Stopped"), cs.filename, cs.records, cs.bytes, cs.drops, cs.write_errors, cs.write_us_max);
+    }
+    return (0);
+}
+
+static int _cmd_wire_sim(int argc, char** argv, const char* unparsed) {
+    cmt_msg_t msg;
+    if (argc == 2 && strcmp(argv[1], "stop") == 0) {
+        msg.id = MSG_MKS_SIM_STOP;
+        postBEMsgBlocking(&msg);
+        return (0);
+    }
+    if (argc > 1 && argc <= 7 && strcmp(argv[1], "start") == 0) {
+        if (mkwire_is_connected()) {
+            ui_term_puts("Disconnect from the wire first.\n");
+            return (-1);
+        }
+        // stations, loss, reorder, dup, jitter
+        uint32_t values[5] = { 2, 0, 0, 0, 0 };
+        for (int i = 2; i < argc; i++) {
+            bool success;
+            values[i - 2] = uint_from_str(argv[i], &success);
+            if (!success) {
+                ui_term_printf("Value error - '%s' is not a number.\n", argv[i]);
+                return (-1);
+            }
+        }
+        msg.id = MSG_MKS_SIM_START;
+        msg.data.sim_params.stations = (uint8_t)(values[0] < MKSIM_STATIONS_MAX ? values[0] : MKSIM_STATIONS_MAX);
+        msg.data.sim_params.loss_pct = (uint8_t)(values[1] < 100 ? values[1] : 100);
+        msg.data.sim_params.reorder_pct = (uint8_t)(values[2] < 100 ? values[2] : 100);
+        msg.data.sim_params.dup_pct = (uint8_t)(values[3] < 100 ? values[3] : 100);
+        msg.data.sim_params.jitter_ms = (uint16_t)(values[4] < MKSIM_JITTER_MAX_MS ? values[4] : MKSIM_JITTER_MAX_MS);
+        postBEMsgBlocking(&msg);
+        return (0);
+    }
+    if (argc > 1) {
+        cmd_help_display(&_cmd_wire_sim_entry, HELP_DISP_USAGE);
+        return (-1);
+    }
+    mksim_stats_t sims;
+    mksim_stats(&sims);
+    uint32_t secs = sims.elapsed_ms / 1000;
+    ui_term_printf("Server stand-in: %s Time:%us Packets:%u Chars:%u (%u/min)\n",
+        (sims.running ? "Running" : "Stopped"), secs, sims.packets, sims.chars, (secs ? (sims.chars * 60) / secs : 0));
+    ui_term_printf("  Code packets:%u Lost:%u Reordered:%u Duplicated:%u\n",
+        sims.code_packets, sims.lost, sims.reordered, sims.duplicated);
+    ui_term_printf("  Decoded:%u Latency ms Avg:%u Max:%u Limit:%u Over limit:%u PBUF drops:%u - %s\n",
+        sims.decoded, sims.latency_ms_avg, sims.latency_ms_max, sims.latency_ms_limit, sims.latency_over,
+        sims.alloc_drops, (sims.pass ? "PASS" : "FAIL"));
+    ui_term_puts("  (The receive side is shown by '.ws')\n");
+    return (0);
+}
+
+static int _cmd_wire_status(int argc, char** argv, const char* unparsed) {
+    if (argc > 1) {
+        cmd_help_display(&_cmd_wire_status_entry, HELP_DISP_USAGE);
+    }
+    mkwire_link_stats_t ls;
+    mkwire_link_stats(&ls);
+    ui_term_printf("Link: %s RTT ms Last:%d Avg:%d Min:%d Max:%d ACKs:%u Timeouts:%u Lost:%u\n",
+        (WIRE_LINK_UP == ls.state ? "Up" : (WIRE_LINK_ACK_WAIT == ls.state ? "Waiting for ACK" : "Down")),
+        ls.rtt_ms, ls.rtt_ms_avg, ls.rtt_ms_min, ls.rtt_ms_max, ls.acks, ls.ack_timeouts, ls.link_lost);
+    ntp_stats_t nts;
+    ntp_stats(&nts);
+    ui_term_printf("NTP: %s Offset:%lldus Delay:%dus Drift:%dppb Slew:%lldus Poll:%us Batches:%u Steps:%u Failures:%u\n",
+        (nts.synced ? "Set" : "Not set"), (long long)nts.offset_us, nts.delay_us, nts.freq_ppb, (long long)nts.slew_us,
+        nts.poll_s, nts.batches, nts.steps, nts.failures);
+    mkwire_recv_stats_t rs;
+    mkwire_recv_stats(&rs);
+    ui_term_printf("Received: Packets:%u Processed:%u Invalid:%u Dropped:%u IRQ us Avg:%u Max:%u Process us Avg:%u Max:%u\n",
+        rs.packets, rs.processed, rs.invalid, rs.ring_drops, rs.irq_us_avg, rs.irq_us_max, rs.proc_us_avg, rs.proc_us_max);
+    jbuf_stats_t jbs;
+    jbuf_stats(&jbs);
+    ui_term_printf("Playout buffer: Depth:%d Delay:%dms Jitter:%dms\n", jbs.depth, jbs.target_ms, jbs.jitter_ms);
+    ui_term_printf("  Played:%u Duplicates:%u Late:%u Lost:%u Reordered:%u Overflow:%u\n",
+        jbs.played, jbs.duplicates, jbs.late_drops, jbs.lost, jbs.reordered, jbs.overflow_drops);
+    mkstation_stats_t ss;
+    mkstation_stats(&ss);
+    ui_term_printf("Stations: Active:%d (of %d) ID bytes Used:%d Free:%d Compactions:%u Evictions:%u\n",
+        ss.count, MK_MAX_ACTIVE_STATIONS, ss.arena_used, ss.arena_free, ss.compactions, ss.evictions);
+    for (mk_station_handle_t h = 0; h < MK_MAX_ACTIVE_STATIONS; h++) {
+        // List the stations that have had sequence problems.
+        mk_station_seq_stats_t sqs;
+        if (mkstation_seq_stats(h, &sqs) && (sqs.duplicates || sqs.reordered || sqs.lost)) {
+            char station_id[MK_STATION_ID_MAX_LEN + 1];
+            mkstation_id(h, station_id, MK_STATION_ID_MAX_LEN);
+            ui_term_printf("  %s: Duplicates:%u Reordered:%u Lost:%u\n", station_id, sqs.duplicates, sqs.reordered, sqs.lost);
+        }
+    }
+    for (int i = 0; i < MK_MONITOR_WIRES; i++) {
+        mkmonitor_status_t ms;
+        if (mkmonitor_status(i, &ms)) {
+            ui_term_printf("Monitor wire %hu: Packets:%u Invalid:%u Dropped:%u Duplicates:%u ACK timeouts:%u Not sent:%u Process us Avg:%u Max:%u\n",
+                ms.wire, ms.packets, ms.invalid, ms.ring_drops, ms.duplicates, ms.ack_timeouts, ms.send_drops, ms.proc_us_avg, ms.proc_us_max);
+        }
+    }
+
+    return (0);
+}
+
 // Internal functions
 
 /**
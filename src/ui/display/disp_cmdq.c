@@ -0,0 +1,223 @@
+/**
+ * Display command queue.
+ *
+ * The commands are kept in a ring. Each command holds the colors that were current
+ * when it was queued, as the UI changes the text colors around the operations.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "disp_cmdq.h"
+
+#include <string.h>
+
+typedef enum _DISP_CMD_OP_ {
+    DISP_CMD_CHAR,
+    DISP_CMD_LINE_CLEAR,
+    DISP_CMD_CURSOR_SET,
+    DISP_CMD_PRINT_CRLF,
+    DISP_CMD_PRINT_ERASE_EOL,
+    DISP_CMD_PRINTC,
+} disp_cmd_op_t;
+
+typedef struct _DISP_CMD_ {
+    uint8_t op;                 // disp_cmd_op_t
+    char c;
+    colorbyte_t color;
+    uint8_t line;
+    uint16_t col;
+} disp_cmd_t;
+
+static disp_cmd_t _cmdq[DISP_CMDQ_SIZE];
+static uint16_t _head;          // Next command to apply
+static uint16_t _tail;          // Where the next command is queued
+static disp_cmdq_stats_t _stats = { .size = DISP_CMDQ_SIZE };
+
+static void _apply(const disp_cmd_t* cmd);
+static void _apply_all(void);
+static void _enqueue(disp_cmd_op_t op, uint16_t line, uint16_t col, char c, colorbyte_t color);
+static disp_cmd_t* _last(void);
+static colorbyte_t _text_color(void);
+
+
+/*
+ * Apply a command to the screen text.
+ */
+static void _apply(const disp_cmd_t* cmd) {
+    text_color_pair_t cp;
+
+    switch (cmd->op) {
+        case DISP_CMD_CHAR:
+            disp_char_colorbyte(cmd->line, cmd->col, cmd->c, cmd->color, No_Paint);
+            return;
+        case DISP_CMD_CURSOR_SET:
+            disp_cursor_set(cmd->line, cmd->col);
+            return;
+    }
+    // The rest use the text colors
+    disp_text_colors_get(&cp);
+    disp_text_colors_set(fg_from_cb(cmd->color), bg_from_cb(cmd->color));
+    switch (cmd->op) {
+        case DISP_CMD_LINE_CLEAR:
+            disp_line_clear(cmd->line, No_Paint);
+            break;
+        case DISP_CMD_PRINT_CRLF:
+            disp_print_crlf(0, No_Paint);
+            break;
+        case DISP_CMD_PRINT_ERASE_EOL:
+            disp_print_erase_eol(No_Paint);
+            break;
+        case DISP_CMD_PRINTC:
+            if ('\n' == cmd->c) {
+                disp_print_crlf(0, No_Paint);
+            }
+            else {
+                disp_printc(cmd->c, No_Paint);
+            }
+            break;
+    }
+    disp_text_colors_cp_set(&cp);
+}
+
+/*
+ * Apply all of the queued commands.
+ */
+static void _apply_all(void) {
+    while (_stats.depth > 0) {
+        _apply(&_cmdq[_head]);
+        _head = (_head + 1) % DISP_CMDQ_SIZE;
+        _stats.depth--;
+        _stats.applied++;
+    }
+}
+
+/*
+ * Queue a command, replacing the last one queued if this makes it unneeded.
+ */
+static void _enqueue(disp_cmd_op_t op, uint16_t line, uint16_t col, char c, colorbyte_t color) {
+    disp_cmd_t* last = _last();
+    _stats.queued++;
+    if (last) {
+        if ((DISP_CMD_CURSOR_SET == op && DISP_CMD_CURSOR_SET == last->op)
+          || (DISP_CMD_CHAR == op && DISP_CMD_CHAR == last->op && line == last->line && col == last->col)) {
+            // Replace it
+            last->c = c;
+            last->color = color;
+            last->line = line;
+            last->col = col;
+            _stats.coalesced++;
+            return;
+        }
+        if (DISP_CMD_LINE_CLEAR == op) {
+            // Characters just queued for the line would be cleared, so drop them
+            while (last && DISP_CMD_CHAR == last->op && line == last->line) {
+                _tail = (_tail + DISP_CMDQ_SIZE - 1) % DISP_CMDQ_SIZE;
+                _stats.depth--;
+                _stats.coalesced++;
+                last = _last();
+            }
+        }
+    }
+    if (_stats.depth == DISP_CMDQ_SIZE) {
+        // Full. Make room by applying what's queued (the render task will paint it).
+        _stats.overflows++;
+        _apply_all();
+    }
+    disp_cmd_t* cmd = &_cmdq[_tail];
+    cmd->op = op;
+    cmd->c = c;
+    cmd->color = color;
+    cmd->line = line;
+    cmd->col = col;
+    _tail = (_tail + 1) % DISP_CMDQ_SIZE;
+    _stats.depth++;
+    if (_stats.depth > _stats.depth_max) {
+        _stats.depth_max = _stats.depth;
+    }
+}
+
+/*
+ * The last command queued (if any are waiting to be applied).
+ */
+static disp_cmd_t* _last(void) {
+    if (_stats.depth == 0) {
+        return (NULL);
+    }
+    return (&_cmdq[(_tail + DISP_CMDQ_SIZE - 1) % DISP_CMDQ_SIZE]);
+}
+
+/*
+ * The current text colors as a color-byte.
+ */
+static colorbyte_t _text_color(void) {
+    text_color_pair_t cp;
+
+    disp_text_colors_get(&cp);
+    return (colorbyte(cp.fg, cp.bg));
+}
+
+
+void disp_cmdq_char_color(uint16_t line, uint16_t col, char c, colorn16_t fg, colorn16_t bg) {
+    _enqueue(DISP_CMD_CHAR, line, col, c, colorbyte(fg, bg));
+}
+
+void disp_cmdq_line_clear(uint16_t line) {
+    _enqueue(DISP_CMD_LINE_CLEAR, line, 0, 0, _text_color());
+}
+
+void disp_cmdq_cursor_set(uint16_t line, uint16_t col) {
+    _enqueue(DISP_CMD_CURSOR_SET, line, col, 0, 0);
+}
+
+void disp_cmdq_print_crlf(void) {
+    _enqueue(DISP_CMD_PRINT_CRLF, 0, 0, 0, _text_color());
+}
+
+void disp_cmdq_print_erase_eol(void) {
+    _enqueue(DISP_CMD_PRINT_ERASE_EOL, 0, 0, 0, _text_color());
+}
+
+void disp_cmdq_printc(char c) {
+    _enqueue(DISP_CMD_PRINTC, 0, 0, c, _text_color());
+}
+
+void disp_cmdq_prints(const char* s) {
+    colorbyte_t color = _text_color();
+    char c;
+    while ((c = *s++) != 0) {
+        _enqueue(DISP_CMD_PRINTC, 0, 0, c, color);
+    }
+}
+
+void disp_cmdq_string(uint16_t line, uint16_t col, const char* s, bool invert) {
+    colorbyte_t color = _text_color();
+    for (unsigned char c = *s; c != 0; c = *(++s)) {
+        _enqueue(DISP_CMD_CHAR, line, col++, (invert ? c ^ DISP_CHAR_INVERT_BIT : c), color);
+    }
+}
+
+void disp_cmdq_string_color(uint16_t line, uint16_t col, const char* s, colorn16_t fg, colorn16_t bg) {
+    colorbyte_t color = colorbyte(fg, bg);
+    for (unsigned char c = *s; c != 0; c = *(++s)) {
+        _enqueue(DISP_CMD_CHAR, line, col++, c, color);
+    }
+}
+
+void disp_cmdq_flush(void) {
+    _apply_all();
+}
+
+bool disp_cmdq_render_task(void) {
+    if (_stats.depth > 0) {
+        _stats.batches++;
+        _apply_all();
+        disp_paint_async();
+    }
+    // Paint the next changed span (if there are any)
+    return (disp_paint_job_poll());
+}
+
+void disp_cmdq_stats(disp_cmdq_stats_t* stats) {
+    memcpy(stats, &_stats, sizeof(disp_cmdq_stats_t));
+}
@@ -0,0 +1,140 @@
+/**
+ * Display command queue.
+ *
+ * The UI queues display operations (characters, strings, printing, clearing lines,
+ * setting the cursor) rather than performing them. The render task (run from the UI
+ * idle processing) applies the queued commands to the screen text and then paints the
+ * changes a span at a time, so a message handler never waits for the SPI transfers.
+ *
+ * Commands are coalesced. When queued, a command that replaces the one before it
+ * (the same character position, or a cursor set following a cursor set) takes
+ * its place. When applied, the commands only mark what changed on each line, so
+ * a run of characters on a line is painted as one span.
+ *
+ * The queue is only used from the UI core.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _DISP_CMDQ_H_
+#define _DISP_CMDQ_H_
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "display.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DISP_CMDQ_SIZE 256
+
+/**
+ * @brief Display command queue statistics.
+ * @ingroup display
+ */
+typedef struct _disp_cmdq_stats_ {
+    uint32_t queued;            // Commands queued
+    uint32_t coalesced;         // Commands that replaced the one queued before them
+    uint32_t applied;           // Commands applied to the screen text
+    uint32_t batches;           // Times the queue was applied by the render task
+    uint32_t overflows;         // Times the queue was full (and was applied without waiting for the render task)
+    uint16_t depth;             // Commands in the queue
+    uint16_t depth_max;         // Most commands that have been in the queue
+    uint16_t size;              // Commands the queue holds
+} disp_cmdq_stats_t;
+
+/**
+ * @brief Queue displaying a character at a position in a color.
+ * @ingroup display
+ */
+extern void disp_cmdq_char_color(uint16_t line, uint16_t col, char c, colorn16_t fg, colorn16_t bg);
+
+/**
+ * @brief Queue clearing a line (to the current text colors).
+ * @ingroup display
+ */
+extern void disp_cmdq_line_clear(uint16_t line);
+
+/**
+ * @brief Queue setting the cursor position (within the scroll area).
+ * @ingroup display
+ */
+extern void disp_cmdq_cursor_set(uint16_t line, uint16_t col);
+
+/**
+ * @brief Queue printing a new-line (scrolling as needed).
+ * @ingroup display
+ */
+extern void disp_cmdq_print_crlf(void);
+
+/**
+ * @brief Queue erasing from the cursor to the end of the line.
+ * @ingroup display
+ */
+extern void disp_cmdq_print_erase_eol(void);
+
+/**
+ * @brief Queue printing a character at the cursor (in the current text colors).
+ * @ingroup display
+ *
+ * A '\n' prints a new-line.
+ */
+extern void disp_cmdq_printc(char c);
+
+/**
+ * @brief Queue printing a string at the cursor (in the current text colors).
+ * @ingroup display
+ */
+extern void disp_cmdq_prints(const char* s);
+
+/**
+ * @brief Queue displaying a string at a position.
+ * @ingroup display
+ *
+ * @param line The line.
+ * @param col The column of the first character.
+ * @param s The string.
+ * @param invert True to display the characters inverted.
+ */
+extern void disp_cmdq_string(uint16_t line, uint16_t col, const char* s, bool invert);
+
+/**
+ * @brief Queue displaying a string at a position in a color.
+ * @ingroup display
+ */
+extern void disp_cmdq_string_color(uint16_t line, uint16_t col, const char* s, colorn16_t fg, colorn16_t bg);
+
+/**
+ * @brief Apply the queued commands to the screen text (without painting).
+ * @ingroup display
+ *
+ * This must be called before using the `disp_...` functions directly, so the
+ * operations stay in order.
+ */
+extern void disp_cmdq_flush(void);
+
+/**
+ * @brief Run the render task.
+ * @ingroup display
+ *
+ * Applies the queued commands and paints the next changed span of the screen.
+ * This is called from the UI idle processing.
+ *
+ * @return true if there is more to paint.
+ */
+extern bool disp_cmdq_render_task(void);
+
+/**
+ * @brief Get the display command queue statistics.
+ * @ingroup display
+ *
+ * @param stats Structure to fill in.
+ */
+extern void disp_cmdq_stats(disp_cmdq_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _DISP_CMDQ_H_
@@ -80,6 +80,29 @@ typedef struct _text_color_pair_ {
     colorn16_t bg;
 } text_color_pair_t;
 
+/**
+ * @brief Display statistics.
+ * @ingroup display
+ */
+typedef struct _disp_stats_ {
+    uint32_t glyph_cache_hits;          // Characters rendered from the glyph cache
+    uint32_t glyph_cache_misses;        // Characters that had to be expanded from the font
+    uint32_t glyph_cache_evictions;     // Glyphs replaced in the cache
+    uint16_t glyph_cache_used;          // Glyphs in the cache
+    uint16_t glyph_cache_size;          // Glyphs the cache holds
+    uint32_t spans_painted;             // Line spans sent to the screen
+    uint32_t span_merges;               // Changes added to a line span that was waiting to be painted
+    uint32_t spi_pixel_bytes;           // Pixel data bytes sent to the display
+    uint32_t spi_control_bytes;         // Command and parameter bytes sent to the display
+    uint32_t spi_pixel_writes;          // Pixel transfers (paints and fills)
+    uint32_t scroll_lines;              // Lines scrolled (by new-lines)
+    uint32_t scroll_starts;             // Times the scroll start (hardware scroll) was set
+    uint16_t scroll_start;              // Current scroll start (pixel row)
+    uint32_t font_data_bytes;           // Size of the (packed) glyph data of the font
+    uint32_t font_unpacked_bytes;       // Size the glyph data would be unpacked (rows of whole bytes)
+    bool font_in_ram;                   // Rendering is from a copy of the font in RAM
+} disp_stats_t;
+
 /**
  * @brief Create 'color-byte number' from forground & background color numbers.
  * @ingroup display
@@ -239,6 +262,22 @@ extern void disp_char_colorbyte(uint16_t line, uint16_t col, char c, colorbyte_t
  */
 extern void disp_font_test(void);
 
+/**
+ * @brief Render from a copy of the font in RAM (SRAM), rather than from flash.
+ * @ingroup display
+ *
+ * Reading the glyphs from flash goes through the XIP cache, and misses stall the
+ * rendering (more so when the SD card or Wi-Fi code is also being fetched). The
+ * (packed) font is small, so it can be copied into RAM. The copy is made the first
+ * time this is enabled, and is kept.
+ *
+ * The current screen, and the screens created after this, use the font selected.
+ *
+ * @param ram True to use a copy in RAM, false to use the font in flash.
+ * @return true if the font in use is in RAM.
+ */
+extern bool disp_font_ram(bool ram);
+
 /**
  * @brief Get the current text colors.
  *
@@ -325,6 +364,76 @@ extern void disp_line_paint(uint16_t line);
  */
 extern void disp_paint(void);
 
+/**
+ * @brief Start painting the changed lines, without waiting for it to be done.
+ * @ingroup display
+ *
+ * The lines are painted by `disp_paint_job_poll` (which the UI calls when idle). Each
+ * poll renders a line into one render buffer while the line before it is sent to the
+ * screen (by DMA) from the other, so painting goes at about the rate of the SPI.
+ * Lines changed while the job is running are painted by it as well.
+ */
+extern void disp_paint_async(void);
+
+/**
+ * @brief Do the next step of the paint job started by `disp_paint_async`.
+ * @ingroup display
+ *
+ * @return true If there is more to do (call it again).
+ * @return false If the job is done (or there wasn't one).
+ */
+extern bool disp_paint_job_poll(void);
+
+/**
+ * @brief Time painting the full screen.
+ * @ingroup display
+ *
+ * All of the lines are painted, and the time until the last of it is on the screen
+ * is returned. This is for benchmarking the display path.
+ *
+ * @param dma True to paint using DMA, false to write the pixels one at a time (as was done before DMA).
+ * @return The microseconds it took.
+ */
+extern uint32_t disp_paint_timed(bool dma);
+
+/**
+ * @brief Time rendering glyphs (without the glyph cache).
+ * @ingroup display
+ *
+ * Renders the printable characters, in alternating colors, into the render buffer.
+ * This is for benchmarking the glyph rendering.
+ *
+ * @param table True to use the table (4 pixels at a time) expansion, false to render a pixel at a time (as was done before).
+ * @param count The number of glyphs to render.
+ * @return The microseconds it took.
+ */
+extern uint32_t disp_glyph_render_timed(bool table, uint16_t count);
+
+/**
+ * @brief Time decoding glyphs from the (packed) font.
+ * @ingroup display
+ *
+ * This is for benchmarking the font decoding (which is part of rendering a glyph).
+ *
+ * @param count The number of glyphs to decode.
+ * @return The microseconds it took.
+ */
+extern uint32_t disp_glyph_decode_timed(uint16_t count);
+
+/**
+ * @brief Count the CPU cycles to render a full text line (without the glyph cache).
+ * @ingroup display
+ *
+ * This is for measuring the effect of the font being in flash or RAM. The glyphs are
+ * decoded and expanded from the font for each character.
+ *
+ * @param ram True to render using the font in RAM, false to use the font in flash.
+ * @param cold True to flush the XIP (flash) cache before rendering.
+ * @return The cycles it took, or 0 if it couldn't be measured (no RAM copy of the font,
+ *         or it took more than the 24 bit SysTick can count).
+ */
+extern uint32_t disp_line_render_cycles(bool ram, bool cold);
+
 /**
  * @brief Move the cursor to the beginning of the next line. Scroll the display if needed.
  * @ingroup display
@@ -503,6 +612,14 @@ extern void disp_screen_close();
  */
 extern bool disp_screen_new();
 
+/**
+ * @brief Get the display statistics.
+ * @ingroup display
+ *
+ * @param stats Structure to fill in.
+ */
+extern void disp_stats(disp_stats_t* stats);
+
 /**
  * @brief Clear the scroll area of the screen.
  * @ingroup display
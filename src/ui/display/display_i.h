@@ -38,14 +38,18 @@ typedef struct scr_context_ {
     uint16_t fixed_area_bottom_size;    // The bottom fixedarea line count
     uint16_t scroll_size;               // This is `lines` - `the fixed size`, but stored for performance
     uint16_t scroll_start;              // Start line of the scroll area in the text buffer
+    bool scroll_start_pending;          // The scroll start has changed and hasn't been sent to the display
     scr_position_t cursor_pos;          // The cursor position
     bool show_cursor;                   // Cursor visibility control
     rgb16_t cursor_color;               // The color of the cursor when it's shown
     const font_info_t* font_info;       // Font info for the selected font
     uint8_t* full_screen_text;          // Buffer for a full screen of characters
     colorbyte_t* full_screen_color;     // Buffer for a full screen of colors
-    bool* dirty_text_lines;             // bool array to track lines modified since paint
+    uint32_t* dirty_lines;              // Bitmap (32 lines per word) of the lines modified since paint
+    uint16_t* dirty_col_first;          // First column modified since paint, for each line (if dirty)
+    uint16_t* dirty_col_last;           // Last column modified since paint, for each line (if dirty)
     rgb16_t *render_buf;                 // buffer large enough to render one line of characters into
+    rgb16_t *render_buf_alt;             // second render buffer (being sent to the screen while the other is rendered into)
 } scr_context_t;
 
 /**
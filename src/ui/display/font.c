@@ -0,0 +1,60 @@
+/**
+ * Font glyph decoding.
+ *
+ * Copyright 2023 AESilky
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "font.h"
+
+/** @brief Each bit of a nibble doubled (for the double size style). */
+static const uint8_t _nibble_double[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF,
+};
+
+/*
+ * Double each bit of a glyph row (up to 16 bits).
+ */
+static uint32_t _row_double(uint32_t row) {
+    return (_nibble_double[row & 0xF]
+        | (_nibble_double[(row >> 4) & 0xF] << 8)
+        | (_nibble_double[(row >> 8) & 0xF] << 16)
+        | (_nibble_double[(row >> 12) & 0xF] << 24));
+}
+
+void font_glyph_rows(const font_info_t* fi, uint8_t c, uint32_t* rows) {
+    bool dbl = (fi->style & FONT_STYLE_DOUBLE);
+    int data_width = (dbl ? fi->width / 2 : fi->width);
+    int data_height = (dbl ? fi->height / 2 : fi->height);
+    uint32_t mask = (1u << data_width) - 1;
+    const uint8_t* p = &fi->glyphs[fi->glyph_index[c]];
+    int first = (*p >> 4);
+    int last = (*p++ & 0x0F);
+    // The rows are a stream of bits, read a byte at a time as needed
+    uint32_t acc = 0;
+    int bits = 0;
+    for (int r = 0; r < data_height; r++) {
+        uint32_t row = 0;
+        if (r >= first && r <= last) {
+            while (bits < data_width) {
+                acc = (acc << 8) | *p++;
+                bits += 8;
+            }
+            bits -= data_width;
+            row = (acc >> bits) & mask;
+        }
+        if (fi->style & FONT_STYLE_BOLD) {
+            row |= (row >> 1);
+        }
+        if (dbl) {
+            row = _row_double(row);
+            *rows++ = row;
+        }
+        *rows++ = row;
+    }
+}
+
+uint32_t font_data_size(const font_info_t* fi) {
+    return (fi->glyph_index[FONT_GLYPHS] + ((FONT_GLYPHS + 1) * sizeof(uint16_t)));
+}
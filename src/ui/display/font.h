@@ -53,21 +53,57 @@ extern "C" {
 
 #define PARAGRAPH_CHR                   0x7Fu   // \177
 
+#define FONT_GLYPHS                     128     // Characters in a font
+#define FONT_HEIGHT_MAX                 32      // Tallest font (a large 16 high font)
+
+// Font styles (applied to the glyph data when it is decoded)
+
+#define FONT_STYLE_NORMAL               0x00
+#define FONT_STYLE_BOLD                 0x01    // Each pixel is also set to its right
+#define FONT_STYLE_DOUBLE               0x02    // Each pixel is 2x2 (the width and height are double the glyph data)
+
 /**
  * @brief Information about a font.
  * @ingroup display
+ *
+ * The glyphs are packed. For each character there is a byte with the first and last
+ * non-blank rows (high and low nibble, first > last for a blank glyph), followed by
+ * those rows of the glyph data, each the width of the glyph data in bits, left-most
+ * pixel first. The index has the offset of each character's data in `glyphs` (with
+ * an extra entry that is the size of the glyph data).
+ *
+ * The font sources are generated from BDF fonts by `font_compile.py`.
  */
 typedef struct font_info_ {
     const char *name;
     const int8_t width;
     const int8_t height;
-    const int8_t bytes_per_glyph_line;
     const int8_t suggested_cursor_line;
     const uint32_t bitmask;
     const bool has_lowercase;
     const uint8_t *glyphs;
+    const uint16_t *glyph_index;
+    const uint8_t style;
 } font_info_t;
 
+/**
+ * @brief Decode the rows of a glyph.
+ * @ingroup display
+ *
+ * The style of the font (bold, double) is applied.
+ *
+ * @param fi The font.
+ * @param c The character (less than `FONT_GLYPHS`).
+ * @param rows Array of `fi->height` values to fill in with the pixel rows, bit `fi->width - 1` is the left-most pixel.
+ */
+extern void font_glyph_rows(const font_info_t* fi, uint8_t c, uint32_t* rows);
+
+/**
+ * @brief The size of the (packed) glyph data and index of a font.
+ * @ingroup display
+ */
+extern uint32_t font_data_size(const font_info_t* fi);
+
 #ifdef __cplusplus
 }
 #endif
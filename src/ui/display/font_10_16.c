@@ -2,6 +2,8 @@
  * Copyright 2023 AESilky
  *
  * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Generated by `font_compile.py` from `font_10_16.bdf`. Edit the BDF and regenerate.
  */
 #include "font_10_16.h"
 
@@ -10,2581 +12,1920 @@
 //
 // 32 special/graphic characters, and standard ASCII
 //
+// Packed glyphs: 1859 bytes + 258 bytes of index (unpacked: 4096 bytes)
+//
 
-const uint16_t _ft[] =
+static const uint8_t _font_10_16_glyphs[] =
 {
-	// 0x00 < μ (Mu) > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x010C, //   #           #
-	0x018C, //   # #       # #
-	0x0172, //   #   # # #     #
-	0x0100, //   #
-	0x0100, //   #
-	0x0000, //
-
-	// 0x01 < WiFi - Not Connected > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0001, //                   #
-	0x007B, //       # # # #   # #
-	0x0086, //     #         # #
-	0x017E, //   #   # # # # # #
-	0x009C, //     #     # # #
-	0x0132, //   #     # #     #
-	0x00EC, //     # # #   # #
-	0x00F0, //     # # # #
-	0x01C8, //   # # #     #
-	0x0300, // # #
-	0x0230, // #       # #
-	0x0030, //         # #
-	0x0000, //
-	0x0000, //
-
-	// 0x02 < WiFi - Connected > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x017A, //   #   # # # #   #
-	0x0084, //     #         #
-	0x0132, //   #     # #     #
-	0x00CC, //     # #     # #
-	0x0030, //         # #
-	0x0048, //       #     #
-	0x0000, //
-	0x0030, //         # #
-	0x0030, //         # #
-	0x0000, //
-	0x0000, //
-
-	// 0x03 <  SAVE > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0080, //     #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0150, //   #   #   #
-	0x00E0, //     # # #
-	0x0040, //       #
-	0x0000, //
-	0x01FC, //   # # # # # # #
-	0x0386, // # # #         # #
-	0x030C, // # #         # #
-	0x01F8, //   # # # # # #
-	0x0000, //
-
-	// 0x04 < Check Box > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x03FE, // # # # # # # # # #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x05 < Check Box - Selected > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x03FE, // # # # # # # # # #
-	0x0202, // #               #
-	0x02FA, // #   # # # # #   #
-	0x02FA, // #   # # # # #   #
-	0x02FA, // #   # # # # #   #
-	0x02FA, // #   # # # # #   #
-	0x02FA, // #   # # # # #   #
-	0x0202, // #               #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x06 < Radio Button > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00F8, //     # # # # #
-	0x0104, //   #           #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0104, //   #           #
-	0x00F8, //     # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x07 < Radio Button - Selected > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00F8, //     # # # # #
-	0x0104, //   #           #
-	0x0272, // #     # # #     #
-	0x02FA, // #   # # # # #   #
-	0x02FA, // #   # # # # #   #
-	0x02FA, // #   # # # # #   #
-	0x0272, // #     # # #     #
-	0x0104, //   #           #
-	0x00F8, //     # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x08 < OK (ACK) > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0004, //               #
-	0x0004, //               #
-	0x0008, //             #
-	0x0008, //             #
-	0x0008, //             #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0090, //     #   #
-	0x0060, //       # #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-
-	// 0x09 < TRASH > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0078, //       # # # #
-	0x0048, //       #     #
-	0x03FF, // # # # # # # # # # #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x014A, //   #   #     #   #
-	0x014A, //   #   #     #   #
-	0x014A, //   #   #     #   #
-	0x014A, //   #   #     #   #
-	0x014A, //   #   #     #   #
-	0x014A, //   #   #     #   #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x00FC, //     # # # # # #
-	0x0000, //
-
-	// 0x0A < GEAR - L > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0003, //                 # #
-	0x0012, //           #     #
-	0x002A, //         #   #   #
-	0x0046, //       #       # #
-	0x0020, //         #
-	0x00F1, //     # # # #       #
-	0x0082, //     #           #
-	0x0082, //     #           #
-	0x00F1, //     # # # #       #
-	0x0020, //         #
-	0x0046, //       #       # #
-	0x002A, //         #   #   #
-	0x0012, //           #     #
-	0x0003, //                 # #
-	0x0000, //
-
-	// 0x0B < GEAR - R > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0300, // # #
-	0x0120, //   #     #
-	0x0150, //   #   #   #
-	0x0188, //   # #       #
-	0x0010, //           #
-	0x023C, // #       # # # #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x023C, // #       # # # #
-	0x0010, //           #
-	0x0188, //   # #       #
-	0x0150, //   #   #   #
-	0x0120, //   #     #
-	0x0300, // # #
-	0x0000, //
-
-	// 0x0C < MENU - L (HAMBURGER) > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x00FF, //     # # # # # # # #
-	0x00FF, //     # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00FF, //     # # # # # # # #
-	0x00FF, //     # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00FF, //     # # # # # # # #
-	0x00FF, //     # # # # # # # #
-	0x0000, //
-	0x0000, //
-
-	// 0x0D < MENU - R (HAMBURGER) > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x03FC, // # # # # # # # #
-	0x03FC, // # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x03FC, // # # # # # # # #
-	0x03FC, // # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x03FC, // # # # # # # # #
-	0x03FC, // # # # # # # # #
-	0x0000, //
-	0x0000, //
-
-	// 0x0E < LOOP CLOSED > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0004, //               #
-	0x0104, //   #           #
-	0x0384, // # # #         #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x010E, //   #         # # #
-	0x0104, //   #           #
-	0x0100, //   #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0070, //       # # #
-	0x0000, //
-
-	// 0x0F < LOOP OPEN > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0100, //   #
-	0x0100, //   #
-	0x0100, //   #
-	0x0100, //   #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0070, //       # # #
-	0x0000, //
-
-	// 0x10 < CLOSER CLOSED - L > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x003F, //         # # # # # #
-	0x0040, //       #
-	0x009F, //     #     # # # # #
-	0x0120, //   #     #
-	0x027F, // #     # # # # # # #
-	0x03FF, // # # # # # # # # # #
-	0x0000, //
-
-	// 0x11 < CLOSER CLOSED - R > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00CC, //     # #     # #
-	0x03F2, // # # # # # #     #
-	0x00D2, //     # #   #     #
-	0x03EC, // # # # # #   # #
-	0x00C0, //     # #
-	0x03FE, // # # # # # # # # #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-
-	// 0x12 < CLOSER OPEN - L > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0003, //                 # #
-	0x000C, //             # #
-	0x0031, //         # #       #
-	0x00C6, //     # #       # #
-	0x0118, //   #       # #
-	0x0260, // #     # #
-	0x0280, // #   #
-	0x0280, // #   #
-	0x0280, // #   #
-	0x02FF, // #   # # # # # # # #
-	0x03FF, // # # # # # # # # # #
-	0x0000, //
-
-	// 0x13 < CLOSER OPEN - R > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0030, //         # #
-	0x00C8, //     # #     #
-	0x0348, // # #   #     #
-	0x0030, //         # #
-	0x0180, //   # #
-	0x0200, // #
-	0x0000, //
-	0x00C0, //     # #
-	0x00C0, //     # #
-	0x00C0, //     # #
-	0x00C0, //     # #
-	0x00C0, //     # #
-	0x03FE, // # # # # # # # # #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-
-	// 0x14 < CONNECT NOT - L > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x003F, //         # # # # # #
-	0x0040, //       #
-	0x009F, //     #     # # # # #
-	0x0090, //     #     #
-	0x0090, //     #     #
-	0x0090, //     #     #
-	0x0090, //     #     #
-	0x0090, //     #     #
-	0x0090, //     #     #
-	0x0090, //     #     #
-	0x0090, //     #     #
-	0x009F, //     #     # # # # #
-	0x0040, //       #
-	0x003F, //         # # # # # #
-	0x0000, //
-
-	// 0x15 < CONNECT NOT - R > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03F0, // # # # # # #
-	0x0008, //             #
-	0x03E4, // # # # # #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x03E4, // # # # # #     #
-	0x0008, //             #
-	0x03F0, // # # # # # #
-	0x0000, //
-
-	// 0x16 < CONNECT CONNECTED - L > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x003F, //         # # # # # #
-	0x0040, //       #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x009F, //     #     # # # # #
-	0x0040, //       #
-	0x003F, //         # # # # # #
-	0x0000, //
-
-	// 0x17 < CONNECT CONNECTED - R > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03F0, // # # # # # #
-	0x0008, //             #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x03E4, // # # # # #     #
-	0x0008, //             #
-	0x03F0, // # # # # # #
-	0x0000, //
-
-	// 0x18 < ARROW UP > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0070, //       # # #
-	0x00F8, //     # # # # #
-	0x01FC, //   # # # # # # #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x19 < ARROW DOWN > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x03FE, // # # # # # # # # #
-	0x01FC, //   # # # # # # #
-	0x00F8, //     # # # # #
-	0x0070, //       # # #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-
-	// 0x1A < ARROW LEFT > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0060, //       # #
-	0x00E0, //     # # #
-	0x01E0, //   # # # #
-	0x03E0, // # # # # #
-	0x01E0, //   # # # #
-	0x00E0, //     # # #
-	0x0060, //       # #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x1B < ARROW RIGHT > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0030, //         # #
-	0x0038, //         # # #
-	0x003C, //         # # # #
-	0x003E, //         # # # # #
-	0x003C, //         # # # #
-	0x0038, //         # # #
-	0x0030, //         # #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x1C <  > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x1D <  > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x1E <  > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x1F 'DEL' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x007E, //       # # # # # #
-	0x00F4, //     # # # #   #
-	0x01F4, //   # # # # #   #
-	0x01F4, //   # # # # #   #
-	0x01F4, //   # # # # #   #
-	0x01F4, //   # # # # #   #
-	0x00F4, //     # # # #   #
-	0x0074, //       # # #   #
-	0x0014, //           #   #
-	0x0014, //           #   #
-	0x0014, //           #   #
-	0x0014, //           #   #
-	0x0014, //           #   #
-	0x0000, //
-	0x0000, //
-
-	// 0x20 ' ' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x21 '!' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x22 '"' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0044, //       #       #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0110, //   #       #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x23 '#' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0022, //         #       #
-	0x0022, //         #       #
-	0x0044, //       #       #
-	0x01FE, //   # # # # # # # #
-	0x0044, //       #       #
-	0x0088, //     #        #
-	0x01FE, //   # # # # # # # #
-	0x0088, //     #        #
-	0x0110, //   #        #
-	0x0110, //   #        #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x24 '$' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0020, //         #
-	0x00F8, //     # # # # #
-	0x0124, //   #     #     #
-	0x0120, //   #     #
-	0x0120, //   #     #
-	0x00A0, //     #   #
-	0x003C, //       # # # #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0024, //         #     #
-	0x0124, //   #     #     #
-	0x00F8, //     # # # # #
-	0x0020, //         #
-	0x0020, //         #
-	0x0000, //
-
-	// 0x25 '%' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0180, //   # #
-	0x0242, // #     #         #
-	0x0244, // #     #       #
-	0x0188, //   # #       #
-	0x0010, //           #
-	0x0020, //         #
-	0x0040, //       #
-	0x008C, //     #       # #
-	0x0112, //   #       #     #
-	0x0212, // #         #     #
-	0x000C, //             # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x26 '&' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x00E0, //     # # #
-	0x0110, //   #       #
-	0x0100, //   #
-	0x0080, //     #
-	0x00C0, //     # #
-	0x0120, //   #     #
-	0x0120, //   #     #
-	0x0212, // #         #     #
-	0x0214, // #         #   #
-	0x0208, // #           #
-	0x0114, //   #       #   #
-	0x00E2, //     # # #       #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x27 ''' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0010, //           #
-	0x0020, //         #
-	0x0020, //         #
-	0x0040, //       #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x28 '(' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0010, //           #
-	0x0010, //           #
-	0x0020, //         #
-	0x0020, //         #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0020, //         #
-	0x0020, //         #
-	0x0010, //           #
-	0x0010, //           #
-	0x0000, //
-	0x0000, //
-
-	// 0x29 ')' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0020, //         #
-	0x0020, //         #
-	0x0010, //           #
-	0x0010, //           #
-	0x0008, //             #
-	0x0008, //             #
-	0x0008, //             #
-	0x0008, //             #
-	0x0008, //             #
-	0x0010, //           #
-	0x0010, //           #
-	0x0020, //         #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-
-	// 0x2A '*' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0124, //   #     #     #
-	0x00A8, //     #   #   #
-	0x0070, //       # # #
-	0x0020, //         #
-	0x0070, //       # # #
-	0x00A8, //     #   #   #
-	0x0124, //   #     #     #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x2B '+' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x03FE, // # # # # # # # # #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x2C ',' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0030, //         # #
-	0x0030, //         # #
-	0x0020, //         #
-	0x0040, //       #
-	0x0000, //
-
-	// 0x2D '-' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x01FE, //   # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x2E '.' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0030, //         # #
-	0x0030, //         # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x2F '/' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0004, //               #
-	0x0004, //               #
-	0x0008, //             #
-	0x0008, //             #
-	0x0010, //           #
-	0x0010, //           #
-	0x0020, //         #
-	0x0040, //       #
-	0x0040, //       #
-	0x0080, //     #
-	0x0080, //     #
-	0x0100, //   #
-	0x0100, //   #
-	0x0000, //
-	0x0000, //
-
-	// 0x30 '0' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0030, //         # #
-	0x0048, //       #     #
-	0x0084, //     #         #
-	0x0084, //     #         #
-	0x0102, //   #             #
-	0x0112, //   #       #     #
-	0x0122, //   #     #       #
-	0x0102, //   #             #
-	0x0084, //     #         #
-	0x0084, //     #         #
-	0x0048, //       #     #
-	0x0030, //         # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x31 '1' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0020, //         #
-	0x0060, //       # #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0070, //       # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x32 '2' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0040, //       #
-	0x0080, //     #
-	0x0100, //   #
-	0x01FC, //   # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x33 '3' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x00FC, //     # # # # # #
-	0x0004, //               #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0078, //       # # # #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0104, //   #           #
-	0x0084, //     #         #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x34 '4' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0004, //               #
-	0x000C, //             # #
-	0x0014, //           #   #
-	0x0024, //         #     #
-	0x0044, //       #       #
-	0x0084, //     #         #
-	0x0104, //   #           #
-	0x01FE, //   # # # # # # # #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x35 '5' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x01F8, //   # # # # # #
-	0x0100, //   #
-	0x0100, //   #
-	0x0170, //   #   # # #
-	0x0188, //   # #       #
-	0x0104, //   #           #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0108, //   #         #
-	0x00F0, //     # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x36 '6' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0088, //     #       #
-	0x0100, //   #
-	0x0100, //   #
-	0x0170, //   #   # # #
-	0x0188, //   # #       #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0070, //       # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x37 '7' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x01FC, //   # # # # # # #
-	0x0004, //               #
-	0x0008, //             #
-	0x0008, //             #
-	0x0010, //           #
-	0x0010, //           #
-	0x0020, //         #
-	0x0020, //         #
-	0x0040, //       #
-	0x0040, //       #
-	0x0080, //     #
-	0x0080, //     #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x38 '8' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0030, //         # #
-	0x0048, //       #     #
-	0x0084, //     #         #
-	0x0084, //     #         #
-	0x0048, //       #     #
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0084, //     #         #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x39 '9' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x008C, //     #       # #
-	0x0074, //       # # #   #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0108, //   #         #
-	0x00F0, //     # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x3A ':' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0030, //         # #
-	0x0030, //         # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0030, //         # #
-	0x0030, //         # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x3B ';' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0030, //         # #
-	0x0030, //         # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0030, //         # #
-	0x0030, //         # #
-	0x0010, //           #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-
-	// 0x3C '<' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0004, //               #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0040, //       #
-	0x0080, //     #
-	0x0100, //   #
-	0x0080, //     #
-	0x0040, //       #
-	0x0020, //         #
-	0x0010, //           #
-	0x0008, //             #
-	0x0004, //               #
-	0x0000, //
-	0x0000, //
-
-	// 0x3D '=' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x01FC, //   # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x01FC, //   # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x3E '>' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0100, //   #
-	0x0080, //     #
-	0x0040, //       #
-	0x0020, //         #
-	0x0010, //           #
-	0x0008, //             #
-	0x0004, //               #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0040, //       #
-	0x0080, //     #
-	0x0100, //   #
-	0x0000, //
-	0x0000, //
-
-	// 0x3F '?' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0004, //               #
-	0x0004, //               #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x40 '@' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x026A, // #     # #   #   #
-	0x0292, // #   #     #     #
-	0x0292, // #   #     #     #
-	0x0292, // #   #     #     #
-	0x0292, // #   #     #     #
-	0x026A, // #     # #   #   #
-	0x0104, //   #           #
-	0x0100, //   #
-	0x00C0, //     # #
-	0x003C, //         # # # #
-	0x0000, //
-
-	// 0x41 'A' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0020, //         #
-	0x0050, //       #   #
-	0x0050, //       #   #
-	0x0050, //       #   #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x01FC, //   # # # # # # #
-	0x0104, //   #           #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x42 'B' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03F0, // # # # # # #
-	0x0208, // #           #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0208, // #           #
-	0x03F8, // # # # # # # #
-	0x0204, // #             #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0204, // #             #
-	0x03F8, // # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x43 'C' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x0102, //   #             #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0102, //   #             #
-	0x0084, //     #         #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x44 'D' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03F0, // # # # # # #
-	0x0208, // #           #
-	0x0204, // #             #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0204, // #             #
-	0x03F8, // # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x45 'E' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03FC, // # # # # # # # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x03F0, // # # # # # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x46 'F' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03FC, // # # # # # # # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x03F0, // # # # # # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x47 'G' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x0102, //   #             #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x021E, // #         # # # #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0102, //   #             #
-	0x0084, //     #         #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x48 'H' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x03FE, // # # # # # # # # #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x49 'I' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0070, //       # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x4A 'J' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x001C, //           # # #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0104, //   #           #
-	0x0084, //     #         #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x4B 'K' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0204, // #             #
-	0x0208, // #           #
-	0x0210, // #         #
-	0x0220, // #       #
-	0x0240, // #     #
-	0x0280, // #   #
-	0x0340, // # #   #
-	0x0220, // #       #
-	0x0210, // #         #
-	0x0208, // #           #
-	0x0204, // #             #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x4C 'L' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x4D 'M' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0306, // # #           # #
-	0x028A, // #   #       #   #
-	0x0252, // #     #   #     #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x4E 'N' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0302, // # #             #
-	0x0282, // #   #           #
-	0x0282, // #   #           #
-	0x0242, // #     #         #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0212, // #         #     #
-	0x020A, // #           #   #
-	0x020A, // #           #   #
-	0x0206, // #             # #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x4F 'O' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0102, //   #             #
-	0x0084, //     #         #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x50 'P' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03F8, // # # # # # # #
-	0x0204, // #             #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0204, // #             #
-	0x03F8, // # # # # # # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x51 'Q' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x010C, //   #         # #
-	0x008C, //     #       # #
-	0x0072, //       # # #     #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x52 'R' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03F8, // # # # # # # #
-	0x0204, // #             #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0204, // #             #
-	0x03F8, // # # # # # # #
-	0x0210, // #         #
-	0x0208, // #           #
-	0x0204, // #             #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x53 'S' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x00F8, //     # # # # #
-	0x0104, //   #           #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x01F8, //   # # # # # #
-	0x0004, //               #
-	0x0002, //                 #
-	0x0002, //                 #
-	0x0202, // #               #
-	0x0102, //   #             #
-	0x00FC, //     # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x54 'T' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x03FE, // # # # # # # # # #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x55 'U' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0104, //   #           #
-	0x00F8, //     # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x56 'V' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0050, //       #   #
-	0x0050, //       #   #
-	0x0050, //       #   #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x57 'W' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0104, //   #           #
-	0x0124, //   #     #     #
-	0x0124, //   #     #     #
-	0x0124, //   #     #     #
-	0x00A8, //     #   #   #
-	0x00A8, //     #   #   #
-	0x00D8, //     # #   # #
-	0x0088, //     #       #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x58 'X' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0050, //       #   #
-	0x0020, //         #
-	0x0050, //       #   #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x59 'Y' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0050, //       #   #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x5A 'Z' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x01FE, //   # # # # # # # #
-	0x0002, //                 #
-	0x0004, //               #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0040, //       #
-	0x0080, //     #
-	0x0100, //   #
-	0x0200, // #
-	0x0200, // #
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x5B '[' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0078, //       # # # #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-
-	// 0x5C '\' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0100, //   #
-	0x0100, //   #
-	0x0080, //     #
-	0x0080, //     #
-	0x0040, //       #
-	0x0040, //       #
-	0x0020, //         #
-	0x0010, //           #
-	0x0010, //           #
-	0x0008, //             #
-	0x0008, //             #
-	0x0004, //               #
-	0x0004, //               #
-	0x0000, //
-	0x0000, //
-
-	// 0x5D ']' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x00F0, //     # # # #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x00F0, //     # # # #
-	0x0000, //
-	0x0000, //
-
-	// 0x5E '^' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0020, //         #
-	0x0050, //       #   #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x5F '_' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x03FE, // # # # # # # # # #
-	0x0000, //
-	0x0000, //
-
-	// 0x60 '`' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0040, //       #
-	0x0020, //         #
-	0x0010, //           #
-	0x0008, //             #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x61 'a' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00F0, //     # # # #
-	0x0108, //   #         #
-	0x0004, //               #
-	0x0004, //               #
-	0x00F4, //     # # # #   #
-	0x010C, //   #         # #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x010C, //   #         # #
-	0x00F4, //     # # # #   #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x62 'b' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0200, // #
-	0x0200, // #
-	0x0270, // #     # # #
-	0x0288, // #   #       #
-	0x0304, // # #           #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0308, // # #         #
-	0x02F0, // #   # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x63 'c' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0078, //       # # # #
-	0x0084, //     #         #
-	0x0100, //   #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0100, //   #
-	0x0084, //     #         #
-	0x0078, //       # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x64 'd' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0004, //               #
-	0x0004, //               #
-	0x00E4, //     # # #     #
-	0x0114, //   #       #   #
-	0x020C, // #           # #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x010C, //   #         # #
-	0x00F4, //     # # # #   #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x65 'e' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00F8, //     # # # # #
-	0x0104, //   #           #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x02F8, // #   # # # # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0100, //   #
-	0x00F8, //     # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x66 'f' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x001C, //           # # #
-	0x0020, //         #
-	0x0040, //       #
-	0x0040, //       #
-	0x01F8, //   # # # # # #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x67 'g' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0074, //       # # #   #
-	0x008C, //     #       # #
-	0x0104, //   #           #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0104, //   #           #
-	0x008C, //     #       # #
-	0x0074, //       # # #   #
-	0x0004, //               #
-	0x0108, //   #         #
-	0x00F0, //     # # # #
-	0x0000, //
-
-	// 0x68 'h' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0200, // #
-	0x0200, // #
-	0x0270, // #     # # #
-	0x0288, // #   #       #
-	0x0304, // # #           #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x69 'i' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0020, //         #
-	0x0000, //
-	0x0060, //       # #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0070, //       # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x6A 'j' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0010, //           #
-	0x0000, //
-	0x0030, //         # #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0020, //         #
-	0x01C0, //   # # #
-	0x0000, //
-
-	// 0x6B 'k' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0100, //   #
-	0x0100, //   #
-	0x0100, //   #
-	0x0108, //   #         #
-	0x0110, //   #       #
-	0x0120, //   #     #
-	0x0140, //   #   #
-	0x01A0, //   # #   #
-	0x0110, //   #       #
-	0x0108, //   #         #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x6C 'l' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0070, //       # # #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0018, //           # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x6D 'm' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x02CC, // #   # #     # #
-	0x0332, // # #     # #     #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0202, // #               #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x6E 'n' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0138, //   #     # # #
-	0x0144, //   #   #       #
-	0x0184, //   # #         #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x6F 'o' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0070, //       # # #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0070, //       # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x70 'p' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x02F0, // #   # # # #
-	0x0308, // # #         #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0304, // # #           #
-	0x0288, // #   #       #
-	0x0270, // #     # # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0000, //
-
-	// 0x71 'q' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00F4, //     # # # #   #
-	0x010C, //   #         # #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x0204, // #             #
-	0x020C, // #           # #
-	0x0114, //   #       #   #
-	0x00E4, //     # # #     #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0000, //
-
-	// 0x72 'r' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0278, // #     # # # #
-	0x0284, // #   #         #
-	0x0300, // # #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0200, // #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x73 's' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00F8, //     # # # # #
-	0x0100, //   #
-	0x0200, // #
-	0x0200, // #
-	0x01F8, //   # # # # # #
-	0x0004, //               #
-	0x0004, //               #
-	0x0004, //               #
-	0x0208, // #           #
-	0x01F0, //   # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x74 't' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x03F8, // # # # # # # #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0044, //       $       $
-	0x0038, //         # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x75 'u' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x010C, //   #         # #
-	0x0094, //     #     #   #
-	0x0064, //       # #     #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x76 'v' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0088, //     #       #
-	0x0050, //       #   #
-	0x0050, //       #   #
-	0x0050, //       #   #
-	0x0020, //         #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x77 'w' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0222, // #       #       #
-	0x0222, // #       #       #
-	0x0124, //   #     #     #
-	0x0154, //   #   #   #   #
-	0x0154, //   #   #   #   #
-	0x0088, //     #       #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x78 'x' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0088, //     #       #
-	0x0050, //       #   #
-	0x0020, //         #
-	0x0050, //       #   #
-	0x0088, //     #       #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x79 'y' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0104, //   #           #
-	0x0104, //   #           #
-	0x0084, //     #         #
-	0x0088, //     #       #
-	0x0044, //       #     #
-	0x0028, //         #   #
-	0x0010, //           #
-	0x0020, //         #
-	0x01C0, //   # # #
-	0x0000, //
-
-	// 0x7A 'z' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x01FC, //   # # # # # # #
-	0x0004, //               #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0040, //       #
-	0x0080, //     #
-	0x0100, //   #
-	0x0100, //   #
-	0x01FC, //   # # # # # # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x7B '{' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0018, //           # #
-	0x0020, //         #
-	0x0040, //       #
-	0x0040, //       #
-	0x0020, //         #
-	0x0040, //       #
-	0x0080, //     #
-	0x0040, //       #
-	0x0020, //         #
-	0x0040, //       #
-	0x0040, //       #
-	0x0040, //       #
-	0x0020, //         #
-	0x0018, //           # #
-	0x0000, //
-
-	// 0x7C '|' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-	0x0020, //         #
-
-	// 0x7D '}' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x00C0, //     # #
-	0x0020, //         #
-	0x0010, //           #
-	0x0010, //           #
-	0x0020, //         #
-	0x0010, //           #
-	0x0008, //             #
-	0x0010, //           #
-	0x0020, //         #
-	0x0010, //           #
-	0x0010, //           #
-	0x0010, //           #
-	0x0020, //         #
-	0x00C0, //     # #
-	0x0000, //
-
-	// 0x7E '~' (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x00C2, //     # #         #
-	0x0124, //   #     #     #
-	0x0218, // #         # #
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-	0x0000, //
-
-	// 0x7F < AES > (10 wide x 16 high cell)
-	//      // 9 8|7 6 5 4|3 2 1 0
-	//      // - -|- - - -|- - - -
-	0x0000, //
-	0x0020, //         #
-	0x0050, //       #   #
-	0x0088, //     #       #
-	0x01FC, //   # # # # # # #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x0000, //
-	0x03CE, // # # # #     # # #
-	0x0210, // #         #
-	0x038C, // # # #       # #
-	0x0202, // #               #
-	0x0202, // #               #
-	0x03DC, // # # # #   # # #
-	0x0000, //
-	0x0000, //
+	// 0x00 < μ (Mu) > (rows 4-14)
+	//   4 |  #           #
+	//   5 |  #           #
+	//   6 |  #           #
+	//   7 |  #           #
+	//   8 |  #           #
+	//   9 |  #           #
+	//  10 |  #         # #
+	//  11 |  # #       # #
+	//  12 |  #   # # #     #
+	//  13 |  #
+	//  14 |  #
+	0x4E, 0x41, 0x10, 0x44, 0x11, 0x04, 0x41, 0x10, 0x44, 0x31, 0x8C, 0x5C,
+	0x90, 0x04, 0x00,
+
+	// 0x01 < WiFi - Not Connected > (rows 2-13)
+	//   2 |                  #
+	//   3 |      # # # #   # #
+	//   4 |    #         # #
+	//   5 |  #   # # # # # #
+	//   6 |    #     # # #
+	//   7 |  #     # #     #
+	//   8 |    # # #   # #
+	//   9 |    # # # #
+	//  10 |  # # #     #
+	//  11 |# #
+	//  12 |#       # #
+	//  13 |        # #
+	0x2D, 0x00, 0x47, 0xB2, 0x19, 0x7E, 0x27, 0x13, 0x23, 0xB0, 0xF0, 0x72,
+	0x30, 0x08, 0xC0, 0x30,
+
+	// 0x02 < WiFi - Connected > (rows 3-13)
+	//   3 |      # # # #
+	//   4 |    #         #
+	//   5 |  #   # # # #   #
+	//   6 |    #         #
+	//   7 |  #     # #     #
+	//   8 |    # #     # #
+	//   9 |        # #
+	//  10 |      #     #
+	//  11 |
+	//  12 |        # #
+	//  13 |        # #
+	0x3D, 0x1E, 0x08, 0x45, 0xE8, 0x84, 0x4C, 0x8C, 0xC0, 0xC0, 0x48, 0x00,
+	0x03, 0x00, 0xC0,
+
+	// 0x03 <  SAVE > (rows 3-14)
+	//   3 |    #
+	//   4 |      #
+	//   5 |      #
+	//   6 |      #
+	//   7 |  #   #   #
+	//   8 |    # # #
+	//   9 |      #
+	//  10 |
+	//  11 |  # # # # # # #
+	//  12 |# # #         # #
+	//  13 |# #         # #
+	//  14 |  # # # # # #
+	0x3E, 0x20, 0x04, 0x01, 0x00, 0x40, 0x54, 0x0E, 0x01, 0x00, 0x00, 0x7F,
+	0x38, 0x6C, 0x31, 0xF8,
+
+	// 0x04 < Check Box > (rows 3-11)
+	//   3 |# # # # # # # # #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |#               #
+	//   7 |#               #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |#               #
+	//  11 |# # # # # # # # #
+	0x3B, 0xFF, 0xA0, 0x28, 0x0A, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0xFF,
+	0x80,
+
+	// 0x05 < Check Box - Selected > (rows 3-11)
+	//   3 |# # # # # # # # #
+	//   4 |#               #
+	//   5 |#   # # # # #   #
+	//   6 |#   # # # # #   #
+	//   7 |#   # # # # #   #
+	//   8 |#   # # # # #   #
+	//   9 |#   # # # # #   #
+	//  10 |#               #
+	//  11 |# # # # # # # # #
+	0x3B, 0xFF, 0xA0, 0x2B, 0xEA, 0xFA, 0xBE, 0xAF, 0xAB, 0xEA, 0x02, 0xFF,
+	0x80,
+
+	// 0x06 < Radio Button > (rows 3-11)
+	//   3 |    # # # # #
+	//   4 |  #           #
+	//   5 |#               #
+	//   6 |#               #
+	//   7 |#               #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |  #           #
+	//  11 |    # # # # #
+	0x3B, 0x3E, 0x10, 0x48, 0x0A, 0x02, 0x80, 0xA0, 0x28, 0x09, 0x04, 0x3E,
+	0x00,
+
+	// 0x07 < Radio Button - Selected > (rows 3-11)
+	//   3 |    # # # # #
+	//   4 |  #           #
+	//   5 |#     # # #     #
+	//   6 |#   # # # # #   #
+	//   7 |#   # # # # #   #
+	//   8 |#   # # # # #   #
+	//   9 |#     # # #     #
+	//  10 |  #           #
+	//  11 |    # # # # #
+	0x3B, 0x3E, 0x10, 0x49, 0xCA, 0xFA, 0xBE, 0xAF, 0xA9, 0xC9, 0x04, 0x3E,
+	0x00,
+
+	// 0x08 < OK (ACK) > (rows 3-13)
+	//   3 |              #
+	//   4 |              #
+	//   5 |            #
+	//   6 |            #
+	//   7 |            #
+	//   8 |          #
+	//   9 |          #
+	//  10 |          #
+	//  11 |    #     #
+	//  12 |      # #
+	//  13 |        #
+	0x3D, 0x01, 0x00, 0x40, 0x20, 0x08, 0x02, 0x01, 0x00, 0x40, 0x10, 0x24,
+	0x06, 0x00, 0x80,
+
+	// 0x09 < TRASH > (rows 1-14)
+	//   1 |      # # # #
+	//   2 |      #     #
+	//   3 |# # # # # # # # # #
+	//   4 |  #             #
+	//   5 |  #             #
+	//   6 |  #   #     #   #
+	//   7 |  #   #     #   #
+	//   8 |  #   #     #   #
+	//   9 |  #   #     #   #
+	//  10 |  #   #     #   #
+	//  11 |  #   #     #   #
+	//  12 |  #             #
+	//  13 |  #             #
+	//  14 |    # # # # # #
+	0x1E, 0x1E, 0x04, 0x8F, 0xFD, 0x02, 0x40, 0x94, 0xA5, 0x29, 0x4A, 0x52,
+	0x94, 0xA5, 0x29, 0x02, 0x40, 0x8F, 0xC0,
+
+	// 0x0A < GEAR - L > (rows 1-14)
+	//   1 |                # #
+	//   2 |          #     #
+	//   3 |        #   #   #
+	//   4 |      #       # #
+	//   5 |        #
+	//   6 |    # # # #       #
+	//   7 |    #           #
+	//   8 |    #           #
+	//   9 |    # # # #       #
+	//  10 |        #
+	//  11 |      #       # #
+	//  12 |        #   #   #
+	//  13 |          #     #
+	//  14 |                # #
+	0x1E, 0x00, 0xC1, 0x20, 0xA8, 0x46, 0x08, 0x0F, 0x12, 0x08, 0x82, 0x3C,
+	0x42, 0x01, 0x18, 0x2A, 0x04, 0x80, 0x30,
+
+	// 0x0B < GEAR - R > (rows 1-14)
+	//   1 |# #
+	//   2 |  #     #
+	//   3 |  #   #   #
+	//   4 |  # #       #
+	//   5 |          #
+	//   6 |#       # # # #
+	//   7 |  #           #
+	//   8 |  #           #
+	//   9 |#       # # # #
+	//  10 |          #
+	//  11 |  # #       #
+	//  12 |  #   #   #
+	//  13 |  #     #
+	//  14 |# #
+	0x1E, 0xC0, 0x12, 0x05, 0x41, 0x88, 0x04, 0x23, 0xC4, 0x11, 0x04, 0x8F,
+	0x01, 0x06, 0x21, 0x50, 0x48, 0x30, 0x00,
+
+	// 0x0C < MENU - L (HAMBURGER) > (rows 2-13)
+	//   2 |    # # # # # # # #
+	//   3 |    # # # # # # # #
+	//   4 |
+	//   5 |
+	//   6 |
+	//   7 |    # # # # # # # #
+	//   8 |    # # # # # # # #
+	//   9 |
+	//  10 |
+	//  11 |
+	//  12 |    # # # # # # # #
+	//  13 |    # # # # # # # #
+	0x2D, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00,
+	0x00, 0x03, 0xFC, 0xFF,
+
+	// 0x0D < MENU - R (HAMBURGER) > (rows 2-13)
+	//   2 |# # # # # # # #
+	//   3 |# # # # # # # #
+	//   4 |
+	//   5 |
+	//   6 |
+	//   7 |# # # # # # # #
+	//   8 |# # # # # # # #
+	//   9 |
+	//  10 |
+	//  11 |
+	//  12 |# # # # # # # #
+	//  13 |# # # # # # # #
+	0x2D, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00,
+	0x00, 0x0F, 0xF3, 0xFC,
+
+	// 0x0E < LOOP CLOSED > (rows 1-14)
+	//   1 |      # # #
+	//   2 |    #       #
+	//   3 |  #           #
+	//   4 |              #
+	//   5 |  #           #
+	//   6 |# # #         #
+	//   7 |  #           #
+	//   8 |  #           #
+	//   9 |  #         # # #
+	//  10 |  #           #
+	//  11 |  #
+	//  12 |  #           #
+	//  13 |    #       #
+	//  14 |      # # #
+	0x1E, 0x1C, 0x08, 0x84, 0x10, 0x04, 0x41, 0x38, 0x44, 0x11, 0x04, 0x43,
+	0x90, 0x44, 0x01, 0x04, 0x22, 0x07, 0x00,
+
+	// 0x0F < LOOP OPEN > (rows 1-14)
+	//   1 |      # # #
+	//   2 |    #       #
+	//   3 |  #           #
+	//   4 |              #
+	//   5 |              #
+	//   6 |              #
+	//   7 |              #
+	//   8 |  #
+	//   9 |  #
+	//  10 |  #
+	//  11 |  #
+	//  12 |  #           #
+	//  13 |    #       #
+	//  14 |      # # #
+	0x1E, 0x1C, 0x08, 0x84, 0x10, 0x04, 0x01, 0x00, 0x40, 0x11, 0x00, 0x40,
+	0x10, 0x04, 0x01, 0x04, 0x22, 0x07, 0x00,
+
+	// 0x10 < CLOSER CLOSED - L > (rows 9-14)
+	//   9 |        # # # # # #
+	//  10 |      #
+	//  11 |    #     # # # # #
+	//  12 |  #     #
+	//  13 |#     # # # # # # #
+	//  14 |# # # # # # # # # #
+	0x9E, 0x0F, 0xC4, 0x02, 0x7D, 0x20, 0x9F, 0xFF, 0xF0,
+
+	// 0x11 < CLOSER CLOSED - R > (rows 8-14)
+	//   8 |    # #     # #
+	//   9 |# # # # # #     #
+	//  10 |    # #   #     #
+	//  11 |# # # # #   # #
+	//  12 |    # #
+	//  13 |# # # # # # # # #
+	//  14 |# # # # # # # # #
+	0x8E, 0x33, 0x3F, 0x23, 0x4B, 0xEC, 0x30, 0x3F, 0xEF, 0xF8,
+
+	// 0x12 < CLOSER OPEN - L > (rows 4-14)
+	//   4 |                # #
+	//   5 |            # #
+	//   6 |        # #       #
+	//   7 |    # #       # #
+	//   8 |  #       # #
+	//   9 |#     # #
+	//  10 |#   #
+	//  11 |#   #
+	//  12 |#   #
+	//  13 |#   # # # # # # # #
+	//  14 |# # # # # # # # # #
+	0x4E, 0x00, 0xC0, 0xC0, 0xC4, 0xC6, 0x46, 0x26, 0x0A, 0x02, 0x80, 0xA0,
+	0x2F, 0xFF, 0xFC,
+
+	// 0x13 < CLOSER OPEN - R > (rows 1-14)
+	//   1 |        # #
+	//   2 |    # #     #
+	//   3 |# #   #     #
+	//   4 |        # #
+	//   5 |  # #
+	//   6 |#
+	//   7 |
+	//   8 |    # #
+	//   9 |    # #
+	//  10 |    # #
+	//  11 |    # #
+	//  12 |    # #
+	//  13 |# # # # # # # # #
+	//  14 |# # # # # # # # #
+	0x1E, 0x0C, 0x0C, 0x8D, 0x20, 0x30, 0x60, 0x20, 0x00, 0x00, 0xC0, 0x30,
+	0x0C, 0x03, 0x00, 0xC0, 0xFF, 0xBF, 0xE0,
+
+	// 0x14 < CONNECT NOT - L > (rows 1-14)
+	//   1 |        # # # # # #
+	//   2 |      #
+	//   3 |    #     # # # # #
+	//   4 |    #     #
+	//   5 |    #     #
+	//   6 |    #     #
+	//   7 |    #     #
+	//   8 |    #     #
+	//   9 |    #     #
+	//  10 |    #     #
+	//  11 |    #     #
+	//  12 |    #     # # # # #
+	//  13 |      #
+	//  14 |        # # # # # #
+	0x1E, 0x0F, 0xC4, 0x02, 0x7C, 0x90, 0x24, 0x09, 0x02, 0x40, 0x90, 0x24,
+	0x09, 0x02, 0x40, 0x9F, 0x10, 0x03, 0xF0,
+
+	// 0x15 < CONNECT NOT - R > (rows 1-14)
+	//   1 |# # # # # #
+	//   2 |            #
+	//   3 |# # # # #     #
+	//   4 |        #     #
+	//   5 |        #     #
+	//   6 |        #     #
+	//   7 |        #     #
+	//   8 |        #     #
+	//   9 |        #     #
+	//  10 |        #     #
+	//  11 |        #     #
+	//  12 |# # # # #     #
+	//  13 |            #
+	//  14 |# # # # # #
+	0x1E, 0xFC, 0x00, 0x8F, 0x90, 0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x09,
+	0x02, 0x40, 0x93, 0xE4, 0x02, 0x3F, 0x00,
+
+	// 0x16 < CONNECT CONNECTED - L > (rows 1-14)
+	//   1 |        # # # # # #
+	//   2 |      #
+	//   3 |    #     # # # # #
+	//   4 |    #     # # # # #
+	//   5 |    #     # # # # #
+	//   6 |    #     # # # # #
+	//   7 |    #     # # # # #
+	//   8 |    #     # # # # #
+	//   9 |    #     # # # # #
+	//  10 |    #     # # # # #
+	//  11 |    #     # # # # #
+	//  12 |    #     # # # # #
+	//  13 |      #
+	//  14 |        # # # # # #
+	0x1E, 0x0F, 0xC4, 0x02, 0x7C, 0x9F, 0x27, 0xC9, 0xF2, 0x7C, 0x9F, 0x27,
+	0xC9, 0xF2, 0x7C, 0x9F, 0x10, 0x03, 0xF0,
+
+	// 0x17 < CONNECT CONNECTED - R > (rows 1-14)
+	//   1 |# # # # # #
+	//   2 |            #
+	//   3 |# # # # #     #
+	//   4 |# # # # #     #
+	//   5 |# # # # #     #
+	//   6 |# # # # #     #
+	//   7 |# # # # #     #
+	//   8 |# # # # #     #
+	//   9 |# # # # #     #
+	//  10 |# # # # #     #
+	//  11 |# # # # #     #
+	//  12 |# # # # #     #
+	//  13 |            #
+	//  14 |# # # # # #
+	0x1E, 0xFC, 0x00, 0x8F, 0x93, 0xE4, 0xF9, 0x3E, 0x4F, 0x93, 0xE4, 0xF9,
+	0x3E, 0x4F, 0x93, 0xE4, 0x02, 0x3F, 0x00,
+
+	// 0x18 < ARROW UP > (rows 3-7)
+	//   3 |        #
+	//   4 |      # # #
+	//   5 |    # # # # #
+	//   6 |  # # # # # # #
+	//   7 |# # # # # # # # #
+	0x37, 0x08, 0x07, 0x03, 0xE1, 0xFC, 0xFF, 0x80,
+
+	// 0x19 < ARROW DOWN > (rows 9-13)
+	//   9 |# # # # # # # # #
+	//  10 |  # # # # # # #
+	//  11 |    # # # # #
+	//  12 |      # # #
+	//  13 |        #
+	0x9D, 0xFF, 0x9F, 0xC3, 0xE0, 0x70, 0x08, 0x00,
+
+	// 0x1A < ARROW LEFT > (rows 3-11)
+	//   3 |        #
+	//   4 |      # #
+	//   5 |    # # #
+	//   6 |  # # # #
+	//   7 |# # # # #
+	//   8 |  # # # #
+	//   9 |    # # #
+	//  10 |      # #
+	//  11 |        #
+	0x3B, 0x08, 0x06, 0x03, 0x81, 0xE0, 0xF8, 0x1E, 0x03, 0x80, 0x60, 0x08,
+	0x00,
+
+	// 0x1B < ARROW RIGHT > (rows 3-11)
+	//   3 |        #
+	//   4 |        # #
+	//   5 |        # # #
+	//   6 |        # # # #
+	//   7 |        # # # # #
+	//   8 |        # # # #
+	//   9 |        # # #
+	//  10 |        # #
+	//  11 |        #
+	0x3B, 0x08, 0x03, 0x00, 0xE0, 0x3C, 0x0F, 0x83, 0xC0, 0xE0, 0x30, 0x08,
+	0x00,
+
+	// 0x1C <  > (empty)
+	0xF0,
+
+	// 0x1D <  > (empty)
+	0xF0,
+
+	// 0x1E <  > (empty)
+	0xF0,
+
+	// 0x1F 'DEL' (rows 1-13)
+	//   1 |      # # # # # #
+	//   2 |    # # # #   #
+	//   3 |  # # # # #   #
+	//   4 |  # # # # #   #
+	//   5 |  # # # # #   #
+	//   6 |  # # # # #   #
+	//   7 |    # # # #   #
+	//   8 |      # # #   #
+	//   9 |          #   #
+	//  10 |          #   #
+	//  11 |          #   #
+	//  12 |          #   #
+	//  13 |          #   #
+	0x1D, 0x1F, 0x8F, 0x47, 0xD1, 0xF4, 0x7D, 0x1F, 0x43, 0xD0, 0x74, 0x05,
+	0x01, 0x40, 0x50, 0x14, 0x05, 0x00,
+
+	// 0x20 ' ' (empty)
+	0xF0,
+
+	// 0x21 '!' (rows 2-12)
+	//   2 |        #
+	//   3 |        #
+	//   4 |        #
+	//   5 |        #
+	//   6 |        #
+	//   7 |        #
+	//   8 |        #
+	//   9 |        #
+	//  10 |
+	//  11 |
+	//  12 |        #
+	0x2C, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x00,
+	0x00, 0x00, 0x80,
+
+	// 0x22 '"' (rows 1-4)
+	//   1 |      #       #
+	//   2 |    #       #
+	//   3 |    #       #
+	//   4 |  #       #
+	0x14, 0x11, 0x08, 0x82, 0x21, 0x10,
+
+	// 0x23 '#' (rows 3-12)
+	//   3 |        #       #
+	//   4 |        #       #
+	//   5 |      #       #
+	//   6 |  # # # # # # # #
+	//   7 |      #       #
+	//   8 |    #       #
+	//   9 |  # # # # # # # #
+	//  10 |    #       #
+	//  11 |  #       #
+	//  12 |  #       #
+	0x3C, 0x08, 0x82, 0x21, 0x11, 0xFE, 0x11, 0x08, 0x87, 0xF8, 0x88, 0x44,
+	0x11, 0x00,
+
+	// 0x24 '$' (rows 1-14)
+	//   1 |        #
+	//   2 |    # # # # #
+	//   3 |  #     #     #
+	//   4 |  #     #
+	//   5 |  #     #
+	//   6 |    #   #
+	//   7 |        # # # #
+	//   8 |        #     #
+	//   9 |        #     #
+	//  10 |        #     #
+	//  11 |  #     #     #
+	//  12 |    # # # # #
+	//  13 |        #
+	//  14 |        #
+	0x1E, 0x08, 0x0F, 0x84, 0x91, 0x20, 0x48, 0x0A, 0x00, 0xF0, 0x24, 0x09,
+	0x02, 0x44, 0x90, 0xF8, 0x08, 0x02, 0x00,
+
+	// 0x25 '%' (rows 2-12)
+	//   2 |  # #
+	//   3 |#     #         #
+	//   4 |#     #       #
+	//   5 |  # #       #
+	//   6 |          #
+	//   7 |        #
+	//   8 |      #
+	//   9 |    #       # #
+	//  10 |  #       #     #
+	//  11 |#         #     #
+	//  12 |            # #
+	0x2C, 0x60, 0x24, 0x29, 0x11, 0x88, 0x04, 0x02, 0x01, 0x00, 0x8C, 0x44,
+	0xA1, 0x20, 0x30,
+
+	// 0x26 '&' (rows 1-12)
+	//   1 |    # # #
+	//   2 |  #       #
+	//   3 |  #
+	//   4 |    #
+	//   5 |    # #
+	//   6 |  #     #
+	//   7 |  #     #
+	//   8 |#         #     #
+	//   9 |#         #   #
+	//  10 |#           #
+	//  11 |  #       #   #
+	//  12 |    # # #       #
+	0x1C, 0x38, 0x11, 0x04, 0x00, 0x80, 0x30, 0x12, 0x04, 0x82, 0x12, 0x85,
+	0x20, 0x84, 0x50, 0xE2,
+
+	// 0x27 ''' (rows 1-4)
+	//   1 |          #
+	//   2 |        #
+	//   3 |        #
+	//   4 |      #
+	0x14, 0x04, 0x02, 0x00, 0x80, 0x40,
+
+	// 0x28 '(' (rows 1-13)
+	//   1 |          #
+	//   2 |          #
+	//   3 |        #
+	//   4 |        #
+	//   5 |      #
+	//   6 |      #
+	//   7 |      #
+	//   8 |      #
+	//   9 |      #
+	//  10 |        #
+	//  11 |        #
+	//  12 |          #
+	//  13 |          #
+	0x1D, 0x04, 0x01, 0x00, 0x80, 0x20, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10,
+	0x02, 0x00, 0x80, 0x10, 0x04, 0x00,
+
+	// 0x29 ')' (rows 1-13)
+	//   1 |        #
+	//   2 |        #
+	//   3 |          #
+	//   4 |          #
+	//   5 |            #
+	//   6 |            #
+	//   7 |            #
+	//   8 |            #
+	//   9 |            #
+	//  10 |          #
+	//  11 |          #
+	//  12 |        #
+	//  13 |        #
+	0x1D, 0x08, 0x02, 0x00, 0x40, 0x10, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+	0x01, 0x00, 0x40, 0x20, 0x08, 0x00,
+
+	// 0x2A '*' (rows 2-10)
+	//   2 |        #
+	//   3 |  #     #     #
+	//   4 |    #   #   #
+	//   5 |      # # #
+	//   6 |        #
+	//   7 |      # # #
+	//   8 |    #   #   #
+	//   9 |  #     #     #
+	//  10 |        #
+	0x2A, 0x08, 0x12, 0x42, 0xA0, 0x70, 0x08, 0x07, 0x02, 0xA1, 0x24, 0x08,
+	0x00,
+
+	// 0x2B '+' (rows 3-11)
+	//   3 |        #
+	//   4 |        #
+	//   5 |        #
+	//   6 |        #
+	//   7 |# # # # # # # # #
+	//   8 |        #
+	//   9 |        #
+	//  10 |        #
+	//  11 |        #
+	0x3B, 0x08, 0x02, 0x00, 0x80, 0x20, 0xFF, 0x82, 0x00, 0x80, 0x20, 0x08,
+	0x00,
+
+	// 0x2C ',' (rows 11-14)
+	//  11 |        # #
+	//  12 |        # #
+	//  13 |        #
+	//  14 |      #
+	0xBE, 0x0C, 0x03, 0x00, 0x80, 0x40,
+
+	// 0x2D '-' (rows 7-7)
+	//   7 |  # # # # # # # #
+	0x77, 0x7F, 0x80,
+
+	// 0x2E '.' (rows 11-12)
+	//  11 |        # #
+	//  12 |        # #
+	0xBC, 0x0C, 0x03, 0x00,
+
+	// 0x2F '/' (rows 1-13)
+	//   1 |              #
+	//   2 |              #
+	//   3 |            #
+	//   4 |            #
+	//   5 |          #
+	//   6 |          #
+	//   7 |        #
+	//   8 |      #
+	//   9 |      #
+	//  10 |    #
+	//  11 |    #
+	//  12 |  #
+	//  13 |  #
+	0x1D, 0x01, 0x00, 0x40, 0x20, 0x08, 0x04, 0x01, 0x00, 0x80, 0x40, 0x10,
+	0x08, 0x02, 0x01, 0x00, 0x40, 0x00,
+
+	// 0x30 '0' (rows 1-12)
+	//   1 |        # #
+	//   2 |      #     #
+	//   3 |    #         #
+	//   4 |    #         #
+	//   5 |  #             #
+	//   6 |  #       #     #
+	//   7 |  #     #       #
+	//   8 |  #             #
+	//   9 |    #         #
+	//  10 |    #         #
+	//  11 |      #     #
+	//  12 |        # #
+	0x1C, 0x0C, 0x04, 0x82, 0x10, 0x84, 0x40, 0x91, 0x24, 0x89, 0x02, 0x21,
+	0x08, 0x41, 0x20, 0x30,
+
+	// 0x31 '1' (rows 1-12)
+	//   1 |        #
+	//   2 |      # #
+	//   3 |        #
+	//   4 |        #
+	//   5 |        #
+	//   6 |        #
+	//   7 |        #
+	//   8 |        #
+	//   9 |        #
+	//  10 |        #
+	//  11 |        #
+	//  12 |      # # #
+	0x1C, 0x08, 0x06, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+	0x02, 0x00, 0x80, 0x70,
+
+	// 0x32 '2' (rows 1-12)
+	//   1 |      # # # #
+	//   2 |    #         #
+	//   3 |              #
+	//   4 |              #
+	//   5 |              #
+	//   6 |            #
+	//   7 |          #
+	//   8 |        #
+	//   9 |      #
+	//  10 |    #
+	//  11 |  #
+	//  12 |  # # # # # # #
+	0x1C, 0x1E, 0x08, 0x40, 0x10, 0x04, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10,
+	0x08, 0x04, 0x01, 0xFC,
+
+	// 0x33 '3' (rows 1-12)
+	//   1 |    # # # # # #
+	//   2 |              #
+	//   3 |            #
+	//   4 |          #
+	//   5 |        #
+	//   6 |      # # # #
+	//   7 |              #
+	//   8 |              #
+	//   9 |              #
+	//  10 |  #           #
+	//  11 |    #         #
+	//  12 |      # # # #
+	0x1C, 0x3F, 0x00, 0x40, 0x20, 0x10, 0x08, 0x07, 0x80, 0x10, 0x04, 0x01,
+	0x10, 0x42, 0x10, 0x78,
+
+	// 0x34 '4' (rows 1-12)
+	//   1 |              #
+	//   2 |            # #
+	//   3 |          #   #
+	//   4 |        #     #
+	//   5 |      #       #
+	//   6 |    #         #
+	//   7 |  #           #
+	//   8 |  # # # # # # # #
+	//   9 |              #
+	//  10 |              #
+	//  11 |              #
+	//  12 |              #
+	0x1C, 0x01, 0x00, 0xC0, 0x50, 0x24, 0x11, 0x08, 0x44, 0x11, 0xFE, 0x01,
+	0x00, 0x40, 0x10, 0x04,
+
+	// 0x35 '5' (rows 1-12)
+	//   1 |  # # # # # #
+	//   2 |  #
+	//   3 |  #
+	//   4 |  #   # # #
+	//   5 |  # #       #
+	//   6 |  #           #
+	//   7 |              #
+	//   8 |              #
+	//   9 |              #
+	//  10 |              #
+	//  11 |  #         #
+	//  12 |    # # # #
+	0x1C, 0x7E, 0x10, 0x04, 0x01, 0x70, 0x62, 0x10, 0x40, 0x10, 0x04, 0x01,
+	0x00, 0x44, 0x20, 0xF0,
+
+	// 0x36 '6' (rows 1-12)
+	//   1 |      # # #
+	//   2 |    #       #
+	//   3 |  #
+	//   4 |  #
+	//   5 |  #   # # #
+	//   6 |  # #       #
+	//   7 |  #           #
+	//   8 |  #           #
+	//   9 |  #           #
+	//  10 |  #           #
+	//  11 |    #       #
+	//  12 |      # # #
+	0x1C, 0x1C, 0x08, 0x84, 0x01, 0x00, 0x5C, 0x18, 0x84, 0x11, 0x04, 0x41,
+	0x10, 0x42, 0x20, 0x70,
+
+	// 0x37 '7' (rows 1-12)
+	//   1 |  # # # # # # #
+	//   2 |              #
+	//   3 |            #
+	//   4 |            #
+	//   5 |          #
+	//   6 |          #
+	//   7 |        #
+	//   8 |        #
+	//   9 |      #
+	//  10 |      #
+	//  11 |    #
+	//  12 |    #
+	0x1C, 0x7F, 0x00, 0x40, 0x20, 0x08, 0x04, 0x01, 0x00, 0x80, 0x20, 0x10,
+	0x04, 0x02, 0x00, 0x80,
+
+	// 0x38 '8' (rows 1-12)
+	//   1 |        # #
+	//   2 |      #     #
+	//   3 |    #         #
+	//   4 |    #         #
+	//   5 |      #     #
+	//   6 |      # # # #
+	//   7 |    #         #
+	//   8 |  #             #
+	//   9 |  #             #
+	//  10 |  #             #
+	//  11 |    #         #
+	//  12 |      # # # #
+	0x1C, 0x0C, 0x04, 0x82, 0x10, 0x84, 0x12, 0x07, 0x82, 0x11, 0x02, 0x40,
+	0x90, 0x22, 0x10, 0x78,
+
+	// 0x39 '9' (rows 1-12)
+	//   1 |      # # #
+	//   2 |    #       #
+	//   3 |  #           #
+	//   4 |  #           #
+	//   5 |  #           #
+	//   6 |    #       # #
+	//   7 |      # # #   #
+	//   8 |              #
+	//   9 |              #
+	//  10 |              #
+	//  11 |  #         #
+	//  12 |    # # # #
+	0x1C, 0x1C, 0x08, 0x84, 0x11, 0x04, 0x41, 0x08, 0xC1, 0xD0, 0x04, 0x01,
+	0x00, 0x44, 0x20, 0xF0,
+
+	// 0x3A ':' (rows 3-11)
+	//   3 |        # #
+	//   4 |        # #
+	//   5 |
+	//   6 |
+	//   7 |
+	//   8 |
+	//   9 |
+	//  10 |        # #
+	//  11 |        # #
+	0x3B, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C,
+	0x00,
+
+	// 0x3B ';' (rows 3-13)
+	//   3 |        # #
+	//   4 |        # #
+	//   5 |
+	//   6 |
+	//   7 |
+	//   8 |
+	//   9 |
+	//  10 |        # #
+	//  11 |        # #
+	//  12 |          #
+	//  13 |        #
+	0x3D, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C,
+	0x01, 0x00, 0x80,
+
+	// 0x3C '<' (rows 1-13)
+	//   1 |              #
+	//   2 |            #
+	//   3 |          #
+	//   4 |        #
+	//   5 |      #
+	//   6 |    #
+	//   7 |  #
+	//   8 |    #
+	//   9 |      #
+	//  10 |        #
+	//  11 |          #
+	//  12 |            #
+	//  13 |              #
+	0x1D, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x80, 0x10,
+	0x02, 0x00, 0x40, 0x08, 0x01, 0x00,
+
+	// 0x3D '=' (rows 5-9)
+	//   5 |  # # # # # # #
+	//   6 |
+	//   7 |
+	//   8 |
+	//   9 |  # # # # # # #
+	0x59, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+
+	// 0x3E '>' (rows 1-13)
+	//   1 |  #
+	//   2 |    #
+	//   3 |      #
+	//   4 |        #
+	//   5 |          #
+	//   6 |            #
+	//   7 |              #
+	//   8 |            #
+	//   9 |          #
+	//  10 |        #
+	//  11 |      #
+	//  12 |    #
+	//  13 |  #
+	0x1D, 0x40, 0x08, 0x01, 0x00, 0x20, 0x04, 0x00, 0x80, 0x10, 0x08, 0x04,
+	0x02, 0x01, 0x00, 0x80, 0x40, 0x00,
+
+	// 0x3F '?' (rows 1-12)
+	//   1 |      # # #
+	//   2 |    #       #
+	//   3 |  #           #
+	//   4 |              #
+	//   5 |              #
+	//   6 |            #
+	//   7 |          #
+	//   8 |        #
+	//   9 |        #
+	//  10 |
+	//  11 |
+	//  12 |        #
+	0x1C, 0x1C, 0x08, 0x84, 0x10, 0x04, 0x01, 0x00, 0x80, 0x40, 0x20, 0x08,
+	0x00, 0x00, 0x00, 0x20,
+
+	// 0x40 '@' (rows 1-14)
+	//   1 |      # # # #
+	//   2 |    #         #
+	//   3 |  #             #
+	//   4 |  #             #
+	//   5 |#     # #   #   #
+	//   6 |#   #     #     #
+	//   7 |#   #     #     #
+	//   8 |#   #     #     #
+	//   9 |#   #     #     #
+	//  10 |#     # #   #   #
+	//  11 |  #           #
+	//  12 |  #
+	//  13 |    # #
+	//  14 |        # # # #
+	0x1E, 0x1E, 0x08, 0x44, 0x09, 0x02, 0x9A, 0xA9, 0x2A, 0x4A, 0x92, 0xA4,
+	0xA6, 0xA4, 0x11, 0x00, 0x30, 0x03, 0xC0,
+
+	// 0x41 'A' (rows 1-12)
+	//   1 |        #
+	//   2 |      #   #
+	//   3 |      #   #
+	//   4 |      #   #
+	//   5 |    #       #
+	//   6 |    #       #
+	//   7 |    #       #
+	//   8 |  #           #
+	//   9 |  # # # # # # #
+	//  10 |  #           #
+	//  11 |#               #
+	//  12 |#               #
+	0x1C, 0x08, 0x05, 0x01, 0x40, 0x50, 0x22, 0x08, 0x82, 0x21, 0x04, 0x7F,
+	0x10, 0x48, 0x0A, 0x02,
+
+	// 0x42 'B' (rows 1-12)
+	//   1 |# # # # # #
+	//   2 |#           #
+	//   3 |#             #
+	//   4 |#             #
+	//   5 |#           #
+	//   6 |# # # # # # #
+	//   7 |#             #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |#               #
+	//  11 |#             #
+	//  12 |# # # # # # #
+	0x1C, 0xFC, 0x20, 0x88, 0x12, 0x04, 0x82, 0x3F, 0x88, 0x12, 0x02, 0x80,
+	0xA0, 0x28, 0x13, 0xF8,
+
+	// 0x43 'C' (rows 1-12)
+	//   1 |      # # # #
+	//   2 |    #         #
+	//   3 |  #             #
+	//   4 |#
+	//   5 |#
+	//   6 |#
+	//   7 |#
+	//   8 |#
+	//   9 |#
+	//  10 |  #             #
+	//  11 |    #         #
+	//  12 |      # # # #
+	0x1C, 0x1E, 0x08, 0x44, 0x0A, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80,
+	0x10, 0x22, 0x10, 0x78,
+
+	// 0x44 'D' (rows 1-12)
+	//   1 |# # # # # #
+	//   2 |#           #
+	//   3 |#             #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |#               #
+	//   7 |#               #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |#               #
+	//  11 |#             #
+	//  12 |# # # # # # #
+	0x1C, 0xFC, 0x20, 0x88, 0x12, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x80,
+	0xA0, 0x28, 0x13, 0xF8,
+
+	// 0x45 'E' (rows 1-12)
+	//   1 |# # # # # # # #
+	//   2 |#
+	//   3 |#
+	//   4 |#
+	//   5 |#
+	//   6 |# # # # # #
+	//   7 |#
+	//   8 |#
+	//   9 |#
+	//  10 |#
+	//  11 |#
+	//  12 |# # # # # # # # #
+	0x1C, 0xFF, 0x20, 0x08, 0x02, 0x00, 0x80, 0x3F, 0x08, 0x02, 0x00, 0x80,
+	0x20, 0x08, 0x03, 0xFE,
+
+	// 0x46 'F' (rows 1-12)
+	//   1 |# # # # # # # #
+	//   2 |#
+	//   3 |#
+	//   4 |#
+	//   5 |#
+	//   6 |# # # # # #
+	//   7 |#
+	//   8 |#
+	//   9 |#
+	//  10 |#
+	//  11 |#
+	//  12 |#
+	0x1C, 0xFF, 0x20, 0x08, 0x02, 0x00, 0x80, 0x3F, 0x08, 0x02, 0x00, 0x80,
+	0x20, 0x08, 0x02, 0x00,
+
+	// 0x47 'G' (rows 1-12)
+	//   1 |      # # # #
+	//   2 |    #         #
+	//   3 |  #             #
+	//   4 |#
+	//   5 |#
+	//   6 |#
+	//   7 |#         # # # #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |  #             #
+	//  11 |    #         #
+	//  12 |      # # # #
+	0x1C, 0x1E, 0x08, 0x44, 0x0A, 0x00, 0x80, 0x20, 0x08, 0x7A, 0x02, 0x80,
+	0x90, 0x22, 0x10, 0x78,
+
+	// 0x48 'H' (rows 1-12)
+	//   1 |#               #
+	//   2 |#               #
+	//   3 |#               #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |# # # # # # # # #
+	//   7 |#               #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |#               #
+	//  11 |#               #
+	//  12 |#               #
+	0x1C, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x80, 0xBF, 0xE8, 0x0A, 0x02, 0x80,
+	0xA0, 0x28, 0x0A, 0x02,
+
+	// 0x49 'I' (rows 1-12)
+	//   1 |      # # #
+	//   2 |        #
+	//   3 |        #
+	//   4 |        #
+	//   5 |        #
+	//   6 |        #
+	//   7 |        #
+	//   8 |        #
+	//   9 |        #
+	//  10 |        #
+	//  11 |        #
+	//  12 |      # # #
+	0x1C, 0x1C, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+	0x02, 0x00, 0x80, 0x70,
+
+	// 0x4A 'J' (rows 1-12)
+	//   1 |          # # #
+	//   2 |              #
+	//   3 |              #
+	//   4 |              #
+	//   5 |              #
+	//   6 |              #
+	//   7 |              #
+	//   8 |              #
+	//   9 |              #
+	//  10 |  #           #
+	//  11 |    #         #
+	//  12 |      # # # #
+	0x1C, 0x07, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01,
+	0x10, 0x42, 0x10, 0x78,
+
+	// 0x4B 'K' (rows 1-12)
+	//   1 |#             #
+	//   2 |#           #
+	//   3 |#         #
+	//   4 |#       #
+	//   5 |#     #
+	//   6 |#   #
+	//   7 |# #   #
+	//   8 |#       #
+	//   9 |#         #
+	//  10 |#           #
+	//  11 |#             #
+	//  12 |#               #
+	0x1C, 0x81, 0x20, 0x88, 0x42, 0x20, 0x90, 0x28, 0x0D, 0x02, 0x20, 0x84,
+	0x20, 0x88, 0x12, 0x02,
+
+	// 0x4C 'L' (rows 1-12)
+	//   1 |#
+	//   2 |#
+	//   3 |#
+	//   4 |#
+	//   5 |#
+	//   6 |#
+	//   7 |#
+	//   8 |#
+	//   9 |#
+	//  10 |#
+	//  11 |#
+	//  12 |# # # # # # # # #
+	0x1C, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80,
+	0x20, 0x08, 0x03, 0xFE,
+
+	// 0x4D 'M' (rows 1-12)
+	//   1 |#               #
+	//   2 |# #           # #
+	//   3 |#   #       #   #
+	//   4 |#     #   #     #
+	//   5 |#       #       #
+	//   6 |#       #       #
+	//   7 |#               #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |#               #
+	//  11 |#               #
+	//  12 |#               #
+	0x1C, 0x80, 0xB0, 0x6A, 0x2A, 0x52, 0x88, 0xA2, 0x28, 0x0A, 0x02, 0x80,
+	0xA0, 0x28, 0x0A, 0x02,
+
+	// 0x4E 'N' (rows 1-12)
+	//   1 |#               #
+	//   2 |# #             #
+	//   3 |#   #           #
+	//   4 |#   #           #
+	//   5 |#     #         #
+	//   6 |#       #       #
+	//   7 |#       #       #
+	//   8 |#         #     #
+	//   9 |#           #   #
+	//  10 |#           #   #
+	//  11 |#             # #
+	//  12 |#               #
+	0x1C, 0x80, 0xB0, 0x2A, 0x0A, 0x82, 0x90, 0xA2, 0x28, 0x8A, 0x12, 0x82,
+	0xA0, 0xA8, 0x1A, 0x02,
+
+	// 0x4F 'O' (rows 1-12)
+	//   1 |      # # # #
+	//   2 |    #         #
+	//   3 |  #             #
+	//   4 |  #             #
+	//   5 |  #             #
+	//   6 |  #             #
+	//   7 |  #             #
+	//   8 |  #             #
+	//   9 |  #             #
+	//  10 |  #             #
+	//  11 |    #         #
+	//  12 |      # # # #
+	0x1C, 0x1E, 0x08, 0x44, 0x09, 0x02, 0x40, 0x90, 0x24, 0x09, 0x02, 0x40,
+	0x90, 0x22, 0x10, 0x78,
+
+	// 0x50 'P' (rows 1-12)
+	//   1 |# # # # # # #
+	//   2 |#             #
+	//   3 |#               #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |#             #
+	//   7 |# # # # # # #
+	//   8 |#
+	//   9 |#
+	//  10 |#
+	//  11 |#
+	//  12 |#
+	0x1C, 0xFE, 0x20, 0x48, 0x0A, 0x02, 0x80, 0xA0, 0x4F, 0xE2, 0x00, 0x80,
+	0x20, 0x08, 0x02, 0x00,
+
+	// 0x51 'Q' (rows 1-12)
+	//   1 |      # # #
+	//   2 |    #       #
+	//   3 |  #           #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |#               #
+	//   7 |#               #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |  #         # #
+	//  11 |    #       # #
+	//  12 |      # # #     #
+	0x1C, 0x1C, 0x08, 0x84, 0x12, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x80,
+	0x90, 0xC2, 0x30, 0x72,
+
+	// 0x52 'R' (rows 1-12)
+	//   1 |# # # # # # #
+	//   2 |#             #
+	//   3 |#               #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |#             #
+	//   7 |# # # # # # #
+	//   8 |#         #
+	//   9 |#           #
+	//  10 |#             #
+	//  11 |#               #
+	//  12 |#               #
+	0x1C, 0xFE, 0x20, 0x48, 0x0A, 0x02, 0x80, 0xA0, 0x4F, 0xE2, 0x10, 0x82,
+	0x20, 0x48, 0x0A, 0x02,
+
+	// 0x53 'S' (rows 1-12)
+	//   1 |    # # # # #
+	//   2 |  #           #
+	//   3 |#
+	//   4 |#
+	//   5 |#
+	//   6 |  # # # # # #
+	//   7 |              #
+	//   8 |                #
+	//   9 |                #
+	//  10 |#               #
+	//  11 |  #             #
+	//  12 |    # # # # # #
+	0x1C, 0x3E, 0x10, 0x48, 0x02, 0x00, 0x80, 0x1F, 0x80, 0x10, 0x02, 0x00,
+	0xA0, 0x24, 0x08, 0xFC,
+
+	// 0x54 'T' (rows 1-12)
+	//   1 |# # # # # # # # #
+	//   2 |        #
+	//   3 |        #
+	//   4 |        #
+	//   5 |        #
+	//   6 |        #
+	//   7 |        #
+	//   8 |        #
+	//   9 |        #
+	//  10 |        #
+	//  11 |        #
+	//  12 |        #
+	0x1C, 0xFF, 0x82, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+	0x02, 0x00, 0x80, 0x20,
+
+	// 0x55 'U' (rows 1-12)
+	//   1 |#               #
+	//   2 |#               #
+	//   3 |#               #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |#               #
+	//   7 |#               #
+	//   8 |#               #
+	//   9 |#               #
+	//  10 |#               #
+	//  11 |  #           #
+	//  12 |    # # # # #
+	0x1C, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x80,
+	0xA0, 0x24, 0x10, 0xF8,
+
+	// 0x56 'V' (rows 1-12)
+	//   1 |#               #
+	//   2 |#               #
+	//   3 |  #           #
+	//   4 |  #           #
+	//   5 |  #           #
+	//   6 |    #       #
+	//   7 |    #       #
+	//   8 |    #       #
+	//   9 |      #   #
+	//  10 |      #   #
+	//  11 |      #   #
+	//  12 |        #
+	0x1C, 0x80, 0xA0, 0x24, 0x11, 0x04, 0x41, 0x08, 0x82, 0x20, 0x88, 0x14,
+	0x05, 0x01, 0x40, 0x20,
+
+	// 0x57 'W' (rows 1-12)
+	//   1 |#               #
+	//   2 |#               #
+	//   3 |#               #
+	//   4 |#               #
+	//   5 |  #           #
+	//   6 |  #     #     #
+	//   7 |  #     #     #
+	//   8 |  #     #     #
+	//   9 |    #   #   #
+	//  10 |    #   #   #
+	//  11 |    # #   # #
+	//  12 |    #       #
+	0x1C, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x41, 0x12, 0x44, 0x91, 0x24, 0x2A,
+	0x0A, 0x83, 0x60, 0x88,
+
+	// 0x58 'X' (rows 1-12)
+	//   1 |#               #
+	//   2 |#               #
+	//   3 |  #           #
+	//   4 |    #       #
+	//   5 |      #   #
+	//   6 |        #
+	//   7 |      #   #
+	//   8 |    #       #
+	//   9 |  #           #
+	//  10 |#               #
+	//  11 |#               #
+	//  12 |#               #
+	0x1C, 0x80, 0xA0, 0x24, 0x10, 0x88, 0x14, 0x02, 0x01, 0x40, 0x88, 0x41,
+	0x20, 0x28, 0x0A, 0x02,
+
+	// 0x59 'Y' (rows 1-12)
+	//   1 |#               #
+	//   2 |#               #
+	//   3 |  #           #
+	//   4 |  #           #
+	//   5 |    #       #
+	//   6 |    #       #
+	//   7 |      #   #
+	//   8 |        #
+	//   9 |        #
+	//  10 |        #
+	//  11 |        #
+	//  12 |        #
+	0x1C, 0x80, 0xA0, 0x24, 0x11, 0x04, 0x22, 0x08, 0x81, 0x40, 0x20, 0x08,
+	0x02, 0x00, 0x80, 0x20,
+
+	// 0x5A 'Z' (rows 1-12)
+	//   1 |  # # # # # # # #
+	//   2 |                #
+	//   3 |              #
+	//   4 |            #
+	//   5 |          #
+	//   6 |        #
+	//   7 |      #
+	//   8 |    #
+	//   9 |  #
+	//  10 |#
+	//  11 |#
+	//  12 |# # # # # # # # #
+	0x1C, 0x7F, 0x80, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40,
+	0x20, 0x08, 0x03, 0xFE,
+
+	// 0x5B '[' (rows 1-13)
+	//   1 |      # # # #
+	//   2 |      #
+	//   3 |      #
+	//   4 |      #
+	//   5 |      #
+	//   6 |      #
+	//   7 |      #
+	//   8 |      #
+	//   9 |      #
+	//  10 |      #
+	//  11 |      #
+	//  12 |      #
+	//  13 |      # # # #
+	0x1D, 0x1E, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10,
+	0x04, 0x01, 0x00, 0x40, 0x1E, 0x00,
+
+	// 0x5C '\' (rows 1-13)
+	//   1 |  #
+	//   2 |  #
+	//   3 |    #
+	//   4 |    #
+	//   5 |      #
+	//   6 |      #
+	//   7 |        #
+	//   8 |          #
+	//   9 |          #
+	//  10 |            #
+	//  11 |            #
+	//  12 |              #
+	//  13 |              #
+	0x1D, 0x40, 0x10, 0x02, 0x00, 0x80, 0x10, 0x04, 0x00, 0x80, 0x10, 0x04,
+	0x00, 0x80, 0x20, 0x04, 0x01, 0x00,
+
+	// 0x5D ']' (rows 1-13)
+	//   1 |    # # # #
+	//   2 |          #
+	//   3 |          #
+	//   4 |          #
+	//   5 |          #
+	//   6 |          #
+	//   7 |          #
+	//   8 |          #
+	//   9 |          #
+	//  10 |          #
+	//  11 |          #
+	//  12 |          #
+	//  13 |    # # # #
+	0x1D, 0x3C, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04,
+	0x01, 0x00, 0x40, 0x10, 0x3C, 0x00,
+
+	// 0x5E '^' (rows 1-4)
+	//   1 |        #
+	//   2 |      #   #
+	//   3 |    #       #
+	//   4 |  #           #
+	0x14, 0x08, 0x05, 0x02, 0x21, 0x04,
+
+	// 0x5F '_' (rows 13-13)
+	//  13 |# # # # # # # # #
+	0xDD, 0xFF, 0x80,
+
+	// 0x60 '`' (rows 1-4)
+	//   1 |      #
+	//   2 |        #
+	//   3 |          #
+	//   4 |            #
+	0x14, 0x10, 0x02, 0x00, 0x40, 0x08,
+
+	// 0x61 'a' (rows 3-12)
+	//   3 |    # # # #
+	//   4 |  #         #
+	//   5 |              #
+	//   6 |              #
+	//   7 |    # # # #   #
+	//   8 |  #         # #
+	//   9 |#             #
+	//  10 |#             #
+	//  11 |  #         # #
+	//  12 |    # # # #   #
+	0x3C, 0x3C, 0x10, 0x80, 0x10, 0x04, 0x3D, 0x10, 0xC8, 0x12, 0x04, 0x43,
+	0x0F, 0x40,
+
+	// 0x62 'b' (rows 1-12)
+	//   1 |#
+	//   2 |#
+	//   3 |#     # # #
+	//   4 |#   #       #
+	//   5 |# #           #
+	//   6 |#             #
+	//   7 |#             #
+	//   8 |#             #
+	//   9 |#             #
+	//  10 |#             #
+	//  11 |# #         #
+	//  12 |#   # # # #
+	0x1C, 0x80, 0x20, 0x09, 0xC2, 0x88, 0xC1, 0x20, 0x48, 0x12, 0x04, 0x81,
+	0x20, 0x4C, 0x22, 0xF0,
+
+	// 0x63 'c' (rows 3-12)
+	//   3 |      # # # #
+	//   4 |    #         #
+	//   5 |  #
+	//   6 |#
+	//   7 |#
+	//   8 |#
+	//   9 |#
+	//  10 |  #
+	//  11 |    #         #
+	//  12 |      # # # #
+	0x3C, 0x1E, 0x08, 0x44, 0x02, 0x00, 0x80, 0x20, 0x08, 0x01, 0x00, 0x21,
+	0x07, 0x80,
+
+	// 0x64 'd' (rows 1-12)
+	//   1 |              #
+	//   2 |              #
+	//   3 |    # # #     #
+	//   4 |  #       #   #
+	//   5 |#           # #
+	//   6 |#             #
+	//   7 |#             #
+	//   8 |#             #
+	//   9 |#             #
+	//  10 |#             #
+	//  11 |  #         # #
+	//  12 |    # # # #   #
+	0x1C, 0x01, 0x00, 0x43, 0x91, 0x14, 0x83, 0x20, 0x48, 0x12, 0x04, 0x81,
+	0x20, 0x44, 0x30, 0xF4,
+
+	// 0x65 'e' (rows 3-12)
+	//   3 |    # # # # #
+	//   4 |  #           #
+	//   5 |#             #
+	//   6 |#             #
+	//   7 |#   # # # # #
+	//   8 |#
+	//   9 |#
+	//  10 |#
+	//  11 |  #
+	//  12 |    # # # # #
+	0x3C, 0x3E, 0x10, 0x48, 0x12, 0x04, 0xBE, 0x20, 0x08, 0x02, 0x00, 0x40,
+	0x0F, 0x80,
+
+	// 0x66 'f' (rows 1-12)
+	//   1 |          # # #
+	//   2 |        #
+	//   3 |      #
+	//   4 |      #
+	//   5 |  # # # # # #
+	//   6 |      #
+	//   7 |      #
+	//   8 |      #
+	//   9 |      #
+	//  10 |      #
+	//  11 |      #
+	//  12 |      #
+	0x1C, 0x07, 0x02, 0x01, 0x00, 0x40, 0x7E, 0x04, 0x01, 0x00, 0x40, 0x10,
+	0x04, 0x01, 0x00, 0x40,
+
+	// 0x67 'g' (rows 3-14)
+	//   3 |      # # #   #
+	//   4 |    #       # #
+	//   5 |  #           #
+	//   6 |#             #
+	//   7 |#             #
+	//   8 |#             #
+	//   9 |  #           #
+	//  10 |    #       # #
+	//  11 |      # # #   #
+	//  12 |              #
+	//  13 |  #         #
+	//  14 |    # # # #
+	0x3E, 0x1D, 0x08, 0xC4, 0x12, 0x04, 0x81, 0x20, 0x44, 0x10, 0x8C, 0x1D,
+	0x00, 0x44, 0x20, 0xF0,
+
+	// 0x68 'h' (rows 1-12)
+	//   1 |#
+	//   2 |#
+	//   3 |#     # # #
+	//   4 |#   #       #
+	//   5 |# #           #
+	//   6 |#             #
+	//   7 |#             #
+	//   8 |#             #
+	//   9 |#             #
+	//  10 |#             #
+	//  11 |#             #
+	//  12 |#             #
+	0x1C, 0x80, 0x20, 0x09, 0xC2, 0x88, 0xC1, 0x20, 0x48, 0x12, 0x04, 0x81,
+	0x20, 0x48, 0x12, 0x04,
+
+	// 0x69 'i' (rows 1-12)
+	//   1 |        #
+	//   2 |
+	//   3 |      # #
+	//   4 |        #
+	//   5 |        #
+	//   6 |        #
+	//   7 |        #
+	//   8 |        #
+	//   9 |        #
+	//  10 |        #
+	//  11 |        #
+	//  12 |      # # #
+	0x1C, 0x08, 0x00, 0x01, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+	0x02, 0x00, 0x80, 0x70,
+
+	// 0x6A 'j' (rows 1-14)
+	//   1 |          #
+	//   2 |
+	//   3 |        # #
+	//   4 |          #
+	//   5 |          #
+	//   6 |          #
+	//   7 |          #
+	//   8 |          #
+	//   9 |          #
+	//  10 |          #
+	//  11 |          #
+	//  12 |          #
+	//  13 |        #
+	//  14 |  # # #
+	0x1E, 0x04, 0x00, 0x00, 0xC0, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04,
+	0x01, 0x00, 0x40, 0x10, 0x08, 0x1C, 0x00,
+
+	// 0x6B 'k' (rows 1-12)
+	//   1 |  #
+	//   2 |  #
+	//   3 |  #
+	//   4 |  #         #
+	//   5 |  #       #
+	//   6 |  #     #
+	//   7 |  #   #
+	//   8 |  # #   #
+	//   9 |  #       #
+	//  10 |  #         #
+	//  11 |  #           #
+	//  12 |  #           #
+	0x1C, 0x40, 0x10, 0x04, 0x01, 0x08, 0x44, 0x12, 0x05, 0x01, 0xA0, 0x44,
+	0x10, 0x84, 0x11, 0x04,
+
+	// 0x6C 'l' (rows 1-12)
+	//   1 |      # # #
+	//   2 |          #
+	//   3 |          #
+	//   4 |          #
+	//   5 |          #
+	//   6 |          #
+	//   7 |          #
+	//   8 |          #
+	//   9 |          #
+	//  10 |          #
+	//  11 |          #
+	//  12 |          # #
+	0x1C, 0x1C, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04,
+	0x01, 0x00, 0x40, 0x18,
+
+	// 0x6D 'm' (rows 3-12)
+	//   3 |#   # #     # #
+	//   4 |# #     # #     #
+	//   5 |#       #       #
+	//   6 |#       #       #
+	//   7 |#       #       #
+	//   8 |#       #       #
+	//   9 |#       #       #
+	//  10 |#       #       #
+	//  11 |#       #       #
+	//  12 |#               #
+	0x3C, 0xB3, 0x33, 0x28, 0x8A, 0x22, 0x88, 0xA2, 0x28, 0x8A, 0x22, 0x88,
+	0xA0, 0x20,
+
+	// 0x6E 'n' (rows 3-12)
+	//   3 |  #     # # #
+	//   4 |  #   #       #
+	//   5 |  # #         #
+	//   6 |  #           #
+	//   7 |  #           #
+	//   8 |  #           #
+	//   9 |  #           #
+	//  10 |  #           #
+	//  11 |  #           #
+	//  12 |  #           #
+	0x3C, 0x4E, 0x14, 0x46, 0x11, 0x04, 0x41, 0x10, 0x44, 0x11, 0x04, 0x41,
+	0x10, 0x40,
+
+	// 0x6F 'o' (rows 3-12)
+	//   3 |      # # #
+	//   4 |    #       #
+	//   5 |  #           #
+	//   6 |  #           #
+	//   7 |  #           #
+	//   8 |  #           #
+	//   9 |  #           #
+	//  10 |  #           #
+	//  11 |    #       #
+	//  12 |      # # #
+	0x3C, 0x1C, 0x08, 0x84, 0x11, 0x04, 0x41, 0x10, 0x44, 0x11, 0x04, 0x22,
+	0x07, 0x00,
+
+	// 0x70 'p' (rows 3-14)
+	//   3 |#   # # # #
+	//   4 |# #         #
+	//   5 |#             #
+	//   6 |#             #
+	//   7 |#             #
+	//   8 |#             #
+	//   9 |# #           #
+	//  10 |#   #       #
+	//  11 |#     # # #
+	//  12 |#
+	//  13 |#
+	//  14 |#
+	0x3E, 0xBC, 0x30, 0x88, 0x12, 0x04, 0x81, 0x20, 0x4C, 0x12, 0x88, 0x9C,
+	0x20, 0x08, 0x02, 0x00,
+
+	// 0x71 'q' (rows 3-14)
+	//   3 |    # # # #   #
+	//   4 |  #         # #
+	//   5 |#             #
+	//   6 |#             #
+	//   7 |#             #
+	//   8 |#             #
+	//   9 |#           # #
+	//  10 |  #       #   #
+	//  11 |    # # #     #
+	//  12 |              #
+	//  13 |              #
+	//  14 |              #
+	0x3E, 0x3D, 0x10, 0xC8, 0x12, 0x04, 0x81, 0x20, 0x48, 0x31, 0x14, 0x39,
+	0x00, 0x40, 0x10, 0x04,
+
+	// 0x72 'r' (rows 3-12)
+	//   3 |#     # # # #
+	//   4 |#   #         #
+	//   5 |# #
+	//   6 |#
+	//   7 |#
+	//   8 |#
+	//   9 |#
+	//  10 |#
+	//  11 |#
+	//  12 |#
+	0x3C, 0x9E, 0x28, 0x4C, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80,
+	0x20, 0x00,
+
+	// 0x73 's' (rows 3-12)
+	//   3 |    # # # # #
+	//   4 |  #
+	//   5 |#
+	//   6 |#
+	//   7 |  # # # # # #
+	//   8 |              #
+	//   9 |              #
+	//  10 |              #
+	//  11 |#           #
+	//  12 |  # # # # #
+	0x3C, 0x3E, 0x10, 0x08, 0x02, 0x00, 0x7E, 0x00, 0x40, 0x10, 0x04, 0x82,
+	0x1F, 0x00,
+
+	// 0x74 't' (rows 2-12)
+	//   2 |      #
+	//   3 |      #
+	//   4 |      #
+	//   5 |# # # # # # #
+	//   6 |      #
+	//   7 |      #
+	//   8 |      #
+	//   9 |      #
+	//  10 |      #
+	//  11 |      #       #
+	//  12 |        # # #
+	0x2C, 0x10, 0x04, 0x01, 0x03, 0xF8, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10,
+	0x04, 0x40, 0xE0,
+
+	// 0x75 'u' (rows 3-12)
+	//   3 |  #           #
+	//   4 |  #           #
+	//   5 |  #           #
+	//   6 |  #           #
+	//   7 |  #           #
+	//   8 |  #           #
+	//   9 |  #           #
+	//  10 |  #         # #
+	//  11 |    #     #   #
+	//  12 |      # #     #
+	0x3C, 0x41, 0x10, 0x44, 0x11, 0x04, 0x41, 0x10, 0x44, 0x11, 0x0C, 0x25,
+	0x06, 0x40,
+
+	// 0x76 'v' (rows 3-12)
+	//   3 |  #           #
+	//   4 |  #           #
+	//   5 |  #           #
+	//   6 |    #       #
+	//   7 |    #       #
+	//   8 |    #       #
+	//   9 |      #   #
+	//  10 |      #   #
+	//  11 |      #   #
+	//  12 |        #
+	0x3C, 0x41, 0x10, 0x44, 0x10, 0x88, 0x22, 0x08, 0x81, 0x40, 0x50, 0x14,
+	0x02, 0x00,
+
+	// 0x77 'w' (rows 3-12)
+	//   3 |#               #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |#               #
+	//   7 |#       #       #
+	//   8 |#       #       #
+	//   9 |  #     #     #
+	//  10 |  #   #   #   #
+	//  11 |  #   #   #   #
+	//  12 |    #       #
+	0x3C, 0x80, 0xA0, 0x28, 0x0A, 0x02, 0x88, 0xA2, 0x24, 0x91, 0x54, 0x55,
+	0x08, 0x80,
+
+	// 0x78 'x' (rows 3-12)
+	//   3 |  #           #
+	//   4 |  #           #
+	//   5 |    #       #
+	//   6 |      #   #
+	//   7 |        #
+	//   8 |      #   #
+	//   9 |    #       #
+	//  10 |  #           #
+	//  11 |  #           #
+	//  12 |  #           #
+	0x3C, 0x41, 0x10, 0x42, 0x20, 0x50, 0x08, 0x05, 0x02, 0x21, 0x04, 0x41,
+	0x10, 0x40,
+
+	// 0x79 'y' (rows 3-14)
+	//   3 |#               #
+	//   4 |#               #
+	//   5 |#               #
+	//   6 |  #           #
+	//   7 |  #           #
+	//   8 |    #         #
+	//   9 |    #       #
+	//  10 |      #       #
+	//  11 |        #   #
+	//  12 |          #
+	//  13 |        #
+	//  14 |  # # #
+	0x3E, 0x80, 0xA0, 0x28, 0x09, 0x04, 0x41, 0x08, 0x42, 0x20, 0x44, 0x0A,
+	0x01, 0x00, 0x81, 0xC0,
+
+	// 0x7A 'z' (rows 3-12)
+	//   3 |  # # # # # # #
+	//   4 |              #
+	//   5 |            #
+	//   6 |          #
+	//   7 |        #
+	//   8 |      #
+	//   9 |    #
+	//  10 |  #
+	//  11 |  #
+	//  12 |  # # # # # # #
+	0x3C, 0x7F, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x40,
+	0x1F, 0xC0,
+
+	// 0x7B '{' (rows 1-14)
+	//   1 |          # #
+	//   2 |        #
+	//   3 |      #
+	//   4 |      #
+	//   5 |        #
+	//   6 |      #
+	//   7 |    #
+	//   8 |      #
+	//   9 |        #
+	//  10 |      #
+	//  11 |      #
+	//  12 |      #
+	//  13 |        #
+	//  14 |          # #
+	0x1E, 0x06, 0x02, 0x01, 0x00, 0x40, 0x08, 0x04, 0x02, 0x00, 0x40, 0x08,
+	0x04, 0x01, 0x00, 0x40, 0x08, 0x01, 0x80,
+
+	// 0x7C '|' (rows 0-15)
+	//   0 |        #
+	//   1 |        #
+	//   2 |        #
+	//   3 |        #
+	//   4 |        #
+	//   5 |        #
+	//   6 |        #
+	//   7 |        #
+	//   8 |        #
+	//   9 |        #
+	//  10 |        #
+	//  11 |        #
+	//  12 |        #
+	//  13 |        #
+	//  14 |        #
+	//  15 |        #
+	0x0F, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+	0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20,
+
+	// 0x7D '}' (rows 1-14)
+	//   1 |    # #
+	//   2 |        #
+	//   3 |          #
+	//   4 |          #
+	//   5 |        #
+	//   6 |          #
+	//   7 |            #
+	//   8 |          #
+	//   9 |        #
+	//  10 |          #
+	//  11 |          #
+	//  12 |          #
+	//  13 |        #
+	//  14 |    # #
+	0x1E, 0x30, 0x02, 0x00, 0x40, 0x10, 0x08, 0x01, 0x00, 0x20, 0x10, 0x08,
+	0x01, 0x00, 0x40, 0x10, 0x08, 0x0C, 0x00,
+
+	// 0x7E '~' (rows 5-7)
+	//   5 |    # #         #
+	//   6 |  #     #     #
+	//   7 |#         # #
+	0x57, 0x30, 0x92, 0x48, 0x60,
+
+	// 0x7F < AES > (rows 1-13)
+	//   1 |        #
+	//   2 |      #   #
+	//   3 |    #       #
+	//   4 |  # # # # # # #
+	//   5 |#               #
+	//   6 |#               #
+	//   7 |
+	//   8 |# # # #     # # #
+	//   9 |#         #
+	//  10 |# # #       # #
+	//  11 |#               #
+	//  12 |#               #
+	//  13 |# # # #   # # #
+	0x1D, 0x08, 0x05, 0x02, 0x21, 0xFC, 0x80, 0xA0, 0x20, 0x03, 0xCE, 0x84,
+	0x38, 0xC8, 0x0A, 0x02, 0xF7, 0x00,
 
 };
 
+static const uint16_t _font_10_16_index[FONT_GLYPHS + 1] =
+{
+	   0,   15,   31,   46,   62,   75,   88,  101,
+	 114,  129,  148,  167,  186,  202,  218,  237,
+	 256,  265,  275,  290,  309,  328,  347,  366,
+	 385,  393,  401,  414,  427,  428,  429,  430,
+	 448,  449,  464,  470,  484,  503,  518,  534,
+	 540,  558,  576,  589,  602,  608,  611,  615,
+	 633,  649,  665,  681,  697,  713,  729,  745,
+	 761,  777,  793,  806,  821,  839,  847,  865,
+	 881,  900,  916,  932,  948,  964,  980,  996,
+	1012, 1028, 1044, 1060, 1076, 1092, 1108, 1124,
+	1140, 1156, 1172, 1188, 1204, 1220, 1236, 1252,
+	1268, 1284, 1300, 1316, 1334, 1352, 1370, 1376,
+	1379, 1385, 1399, 1415, 1429, 1445, 1459, 1475,
+	1491, 1507, 1523, 1542, 1558, 1574, 1588, 1602,
+	1616, 1632, 1648, 1662, 1676, 1691, 1705, 1719,
+	1733, 1747, 1763, 1777, 1796, 1817, 1836, 1841,
+	1859,
+};
+
 
 const font_info_t font_10_16 =
 {
-	"MuKOB - 10 x 16",  // name
-	10,             	// width
-	16,             	// height
-	2,              	// bytes per glyph line
-	13,					// suggested cursor line
-	0x000003FF,     	// bitmask
-	true,           	// has lowercase
-	(uint8_t*)_ft,  	// font/glyph table
+	"MuKOB - 10 x 16",	// name
+	10,				// width
+	16,				// height
+	13,				// suggested cursor line
+	0x000003FF,		// bitmask
+	true,			// has lowercase
+	_font_10_16_glyphs,	// packed glyphs
+	_font_10_16_index,	// glyph index
+	FONT_STYLE_NORMAL,	// style
 };
 
+const font_info_t font_10_16_bold =
+{
+	"MuKOB - 10 x 16 Bold",	// name
+	10,				// width
+	16,				// height
+	13,				// suggested cursor line
+	0x000003FF,		// bitmask
+	true,			// has lowercase
+	_font_10_16_glyphs,	// packed glyphs
+	_font_10_16_index,	// glyph index
+	FONT_STYLE_BOLD,	// style
+};
+
+const font_info_t font_10_16_large =
+{
+	"MuKOB - 10 x 16 Large",	// name
+	20,				// width
+	32,				// height
+	27,				// suggested cursor line
+	0x000FFFFF,		// bitmask
+	true,			// has lowercase
+	_font_10_16_glyphs,	// packed glyphs
+	_font_10_16_index,	// glyph index
+	FONT_STYLE_DOUBLE,	// style
+};
@@ -18,6 +18,18 @@
  */
 extern const font_info_t font_10_16;
 
+/**
+ * @brief Information for the bold 10x16 fixed font (uses the same glyph data).
+ * @ingroup display
+ */
+extern const font_info_t font_10_16_bold;
+
+/**
+ * @brief Information for the large (20x32) fixed font (uses the same glyph data).
+ * @ingroup display
+ */
+extern const font_info_t font_10_16_large;
+
 #ifdef __cplusplus
 }
 #endif
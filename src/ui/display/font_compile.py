@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+
+# Font compiler - Converts a BDF font into the packed C font source used by the display.
+#
+# The glyphs are stored packed: for each character, a byte with the first and last
+# non-blank rows of the glyph (high and low nibble), followed by only those rows,
+# `width` bits each, most significant (left-most pixel) bit first. The data for each
+# character starts on a byte. An index gives the offset of each character's data.
+# Glyphs can be up to 16 x 16. See `font_glyph_rows` in `font.c` for the decoder.
+#
+# Bold and large (double size) variants of the font can be included. They use the
+# same glyph data (the decoder applies the style).
+#
+# The existing C font source format (a uint16_t per glyph row, 16 rows per glyph)
+# can also be read, and a BDF file written, to convert a font to BDF.
+#
+# usage:
+#   python3 font_compile.py <font.bdf> -o <font.c> --var <c-name> [--name <display-name>]
+#           [--cursor-line <n>] [--variants]
+#   python3 font_compile.py --from-c <font.c> --width <w> --height <h> --bdf-out <font.bdf>
+#
+# No libraries beyond the Python standard library are needed.
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+GLYPHS = 128
+BYTES_PER_LINE = 12
+
+
+class Glyph:
+    def __init__(self, code, desc, rows):
+        self.code = code
+        self.desc = desc
+        self.rows = rows    # Cell rows, bit (width - 1) is the left-most pixel
+
+
+def read_c_table(path, width, height):
+    """Read the glyphs from a C source with a uint16_t per glyph row."""
+    glyphs = []
+    desc = None
+    code = None
+    rows = []
+    hdr = re.compile(r'//\s*0x([0-9A-Fa-f]{2})\s+(.*?)\s*\(\d+ wide x \d+ high cell\)')
+    val = re.compile(r'^\s*(0x[0-9A-Fa-f]{4}),')
+    for line in Path(path).read_text(encoding='utf-8').splitlines():
+        m = hdr.search(line)
+        if m:
+            code = int(m.group(1), 16)
+            desc = m.group(2)
+            rows = []
+            continue
+        m = val.match(line)
+        if m and code is not None:
+            rows.append(int(m.group(1), 16))
+            if len(rows) == height:
+                glyphs.append(Glyph(code, desc, rows))
+                code = None
+    if len(glyphs) != GLYPHS:
+        raise Exception(f'Expected {GLYPHS} glyphs in {path}, found {len(glyphs)}')
+    return glyphs
+
+
+def read_bdf(path):
+    """Read the glyphs (codes 0-127) from a BDF font. Returns (width, height, glyphs)."""
+    width = height = fbb_x = fbb_y = None
+    glyphs = {}
+    lines = iter(Path(path).read_text(encoding='utf-8').splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'FONTBOUNDINGBOX':
+            width, height, fbb_x, fbb_y = (int(w) for w in words[1:5])
+        elif words[0] == 'STARTCHAR':
+            desc = line[len('STARTCHAR'):].strip()
+            code = None
+            bbx = None
+            for line in lines:
+                words = line.split()
+                if words[0] == 'ENCODING':
+                    code = int(words[1])
+                elif words[0] == 'BBX':
+                    bbx = [int(w) for w in words[1:5]]
+                elif words[0] == 'BITMAP':
+                    break
+            bw, bh, bx, by = bbx
+            rows = [0] * height
+            top = (fbb_y + height) - (by + bh)     # Cell row of the top of the bitmap
+            col = bx - fbb_x
+            for r in range(bh):
+                hexrow = next(lines).strip()
+                bits = int(hexrow, 16) >> (len(hexrow) * 4 - bw)
+                if 0 <= top + r < height:
+                    rows[top + r] = (bits << (width - col - bw)) & ((1 << width) - 1)
+            if code is not None and 0 <= code < GLYPHS:
+                glyphs[code] = Glyph(code, desc, rows)
+    if width is None:
+        raise Exception(f'No FONTBOUNDINGBOX in {path}')
+    empty = [0] * height
+    return width, height, [glyphs.get(c, Glyph(c, '', empty)) for c in range(GLYPHS)]
+
+
+def write_bdf(path, name, width, height, glyphs):
+    row_bytes = (width + 7) // 8
+    with open(path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('STARTFONT 2.1\n')
+        f.write(f'FONT {name}\n')
+        f.write(f'SIZE {height} 75 75\n')
+        f.write(f'FONTBOUNDINGBOX {width} {height} 0 0\n')
+        f.write('STARTPROPERTIES 2\n')
+        f.write('FONT_ASCENT {}\nFONT_DESCENT 0\n'.format(height))
+        f.write('ENDPROPERTIES\n')
+        f.write(f'CHARS {len(glyphs)}\n')
+        for g in glyphs:
+            f.write(f'STARTCHAR {g.desc}\n')
+            f.write(f'ENCODING {g.code}\n')
+            f.write(f'SWIDTH {width * 1000 // height} 0\n')
+            f.write(f'DWIDTH {width} 0\n')
+            f.write(f'BBX {width} {height} 0 0\n')
+            f.write('BITMAP\n')
+            for r in g.rows:
+                f.write('{:0{}X}\n'.format(r << (row_bytes * 8 - width), row_bytes * 2))
+            f.write('ENDCHAR\n')
+        f.write('ENDFONT\n')
+
+
+def pack_glyph(rows, width):
+    """Pack a glyph. Returns (first-row, last-row, bytes)."""
+    used = [i for i, r in enumerate(rows) if r]
+    if not used:
+        return (15, 0, bytes([0xF0]))   # first > last is an empty glyph
+    first, last = used[0], used[-1]
+    acc = 0
+    nbits = 0
+    out = bytearray([(first << 4) | last])
+    for r in rows[first:last + 1]:
+        acc = (acc << width) | r
+        nbits += width
+        while nbits >= 8:
+            nbits -= 8
+            out.append((acc >> nbits) & 0xFF)
+    if nbits:
+        out.append((acc << (8 - nbits)) & 0xFF)
+    return (first, last, bytes(out))
+
+
+def write_c(path, var, name, width, height, cursor_line, variants, source, glyphs):
+    packed = [pack_glyph(g.rows, width) for g in glyphs]
+    index = []
+    offset = 0
+    for p in packed:
+        index.append(offset)
+        offset += len(p[2])
+    index.append(offset)
+    unpacked = GLYPHS * height * ((width + 7) // 8)
+    has_lowercase = any(glyphs[c].rows != [0] * height for c in range(ord('a'), ord('z') + 1))
+    out = []
+    out.append('/**')
+    out.append(' * Copyright 2023 AESilky')
+    out.append(' *')
+    out.append(' * SPDX-License-Identifier: BSD-3-Clause')
+    out.append(' *')
+    out.append(f' * Generated by `font_compile.py` from `{source}`. Edit the BDF and regenerate.')
+    out.append(' */')
+    out.append(f'#include "{var}.h"')
+    out.append('')
+    out.append('//')
+    out.append(f'// Font data for Terminal (fixed-pitch) {width} x {height}')
+    out.append('//')
+    out.append('// 32 special/graphic characters, and standard ASCII')
+    out.append('//')
+    out.append(f'// Packed glyphs: {offset} bytes + {len(index) * 2} bytes of index (unpacked: {unpacked} bytes)')
+    out.append('//')
+    out.append('')
+    out.append(f'static const uint8_t _{var}_glyphs[] =')
+    out.append('{')
+    for g, (first, last, data) in zip(glyphs, packed):
+        rows_desc = (f'rows {first}-{last}' if first <= last else 'empty')
+        out.append(f'\t// 0x{g.code:02X} {g.desc} ({rows_desc})')
+        if first <= last:
+            for r in range(first, last + 1):
+                pic = ' '.join('#' if g.rows[r] & (1 << (width - 1 - b)) else ' ' for b in range(width))
+                out.append(f'\t//  {r:2d} |{pic.rstrip()}')
+        for i in range(0, len(data), BYTES_PER_LINE):
+            out.append('\t' + ' '.join(f'0x{b:02X},' for b in data[i:i + BYTES_PER_LINE]))
+        out.append('')
+    out.append('};')
+    out.append('')
+    out.append(f'static const uint16_t _{var}_index[FONT_GLYPHS + 1] =')
+    out.append('{')
+    for i in range(0, len(index), 8):
+        out.append('\t' + ' '.join(f'{v:4d},' for v in index[i:i + 8]))
+    out.append('};')
+    out.append('')
+    fonts = [(var, name, width, height, cursor_line, 'FONT_STYLE_NORMAL')]
+    if variants:
+        fonts.append((f'{var}_bold', f'{name} Bold', width, height, cursor_line, 'FONT_STYLE_BOLD'))
+        fonts.append((f'{var}_large', f'{name} Large', width * 2, height * 2, cursor_line * 2 + 1, 'FONT_STYLE_DOUBLE'))
+    for fvar, fname, fw, fh, fcl, fstyle in fonts:
+        out.append('')
+        out.append(f'const font_info_t {fvar} =')
+        out.append('{')
+        out.append(f'\t"{fname}",\t// name')
+        out.append(f'\t{fw},\t\t\t\t// width')
+        out.append(f'\t{fh},\t\t\t\t// height')
+        out.append(f'\t{fcl},\t\t\t\t// suggested cursor line')
+        out.append(f'\t0x{(1 << fw) - 1:08X},\t\t// bitmask')
+        out.append(f'\t{"true" if has_lowercase else "false"},\t\t\t// has lowercase')
+        out.append(f'\t_{var}_glyphs,\t// packed glyphs')
+        out.append(f'\t_{var}_index,\t// glyph index')
+        out.append(f'\t{fstyle},\t// style')
+        out.append('};')
+    # The sources use CRLF line endings
+    with open(path, 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write('\n'.join(out) + '\n')
+    return offset + len(index) * 2, unpacked
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Compile a BDF font into packed C font source.')
+    ap.add_argument('font', nargs='?', help='BDF font file')
+    ap.add_argument('-o', '--output', help='C source file to write')
+    ap.add_argument('--var', help='C name of the font (the header is <var>.h)')
+    ap.add_argument('--name', help='Display name of the font')
+    ap.add_argument('--cursor-line', type=int, help='Suggested cursor line (default: height - 3)')
+    ap.add_argument('--variants', action='store_true', help='Also define bold and large fonts')
+    ap.add_argument('--from-c', help='Read the glyphs from a C source (uint16_t per row) rather than BDF')
+    ap.add_argument('--width', type=int, help='Glyph width (with --from-c)')
+    ap.add_argument('--height', type=int, help='Glyph height (with --from-c)')
+    ap.add_argument('--bdf-out', help='BDF file to write')
+    args = ap.parse_args()
+
+    if args.from_c:
+        if not (args.width and args.height):
+            ap.error('--from-c needs --width and --height')
+        width, height = args.width, args.height
+        glyphs = read_c_table(args.from_c, width, height)
+        source = Path(args.from_c).name
+    elif args.font:
+        width, height, glyphs = read_bdf(args.font)
+        source = Path(args.font).name
+    else:
+        ap.error('a BDF font or --from-c is needed')
+    if width > 16 or height > 16:
+        ap.error(f'glyphs can be up to 16 x 16 (font is {width} x {height})')
+    name = args.name or f'{width} x {height}'
+
+    if args.bdf_out:
+        write_bdf(args.bdf_out, name.replace(' ', '_'), width, height, glyphs)
+        print(f'Wrote {args.bdf_out}')
+    if args.output:
+        if not args.var:
+            ap.error('--var is needed to write C source')
+        cursor_line = (args.cursor_line if args.cursor_line is not None else height - 3)
+        size, unpacked = write_c(args.output, args.var, name, width, height, cursor_line, args.variants, source, glyphs)
+        print(f'Wrote {args.output}: {size} bytes (unpacked: {unpacked} bytes, {100 - (size * 100) // unpacked}% smaller)')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
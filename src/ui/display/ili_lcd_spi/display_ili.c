@@ -9,16 +9,29 @@
 #include "display_i.h"
 #include "font.h"
 #include "font_10_16.h"
+#include "glyph_cache.h"
 #include "ili_lcd_spi.h"
 #include "mkboard.h"
 #include "mkdebug.h"
 #include "string.h"
 
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+#include "hardware/structs/xip_ctrl.h"
+
 static void _disp_char(uint16_t aline, uint16_t col, char c, paint_control_t paint);
 static void _disp_char_colorbyte(uint16_t aline, uint16_t col, char c, uint8_t color, paint_control_t paint);
 static void _disp_line_clear(uint16_t aline, paint_control_t paint);
 static void _disp_line_paint(uint16_t aline);
+static void _disp_span_paint(uint16_t aline, uint16_t first, uint16_t last);
+static void _dirty_clear(uint16_t aline);
+static void _dirty_mark(uint16_t aline, uint16_t first, uint16_t last);
+static void _dirty_mark_all(void);
 static void _fill_rgb16_buf(rgb16_t* buf, rgb16_t rgb16, size_t bufsize);
+static const font_info_t* _font_ram_copy(const font_info_t* fi);
+static void _glyph_render(const font_info_t* fi, unsigned char c, colorbyte_t color, rgb16_t* dst, uint16_t stride);
+static void _render_buf_paint(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+static void _scroll_start_send(void);
 static uint16_t _translate_cursor_line(uint16_t curline);
 static uint16_t _translate_line(uint16_t line);
 
@@ -48,6 +61,19 @@ static scr_context_t* _scr_ctx = NULL;
 /** @brief The number of characters to scan (back) looking for a wrap break-point character */
 static uint16_t _wrap_len;
 
+/** @brief The font to use (in flash), and the copy of it in RAM (if one has been made) */
+static const font_info_t* _font = &font_10_16;
+static const font_info_t* _font_ram = NULL;
+static bool _use_font_ram = false;
+
+/** @brief A paint job (painting the dirty lines) is in progress */
+static bool _paint_job_active = false;
+
+/** @brief Painting statistics */
+static uint32_t _spans_painted;
+static uint32_t _span_merges;
+static uint32_t _scroll_lines;
+
 // ======================================================================================
 // Internal functions
 // ======================================================================================
@@ -89,57 +115,20 @@ static void _disp_char_colorbyte(uint16_t aline, uint16_t col, char c, uint8_t c
     *(_scr_ctx->full_screen_color + (aline * _scr_ctx->cols) + col) = color;
     if (paint) {
         // Actually render the characher glyph onto the screen.
-        bool invert = c & DISP_CHAR_INVERT_BIT;
-        unsigned char cl = c & 0x7F;
-        uint8_t fg = (invert ? bg_from_cb(color) : fg_from_cb(color));
-        uint8_t bg = (invert ? fg_from_cb(color) : bg_from_cb(color));
-        rgb16_t fgrgb = rgb16_from_color16(fg);
-        rgb16_t bgrgb = rgb16_from_color16(bg);
         const font_info_t* fi = _scr_ctx->font_info;
         int8_t font_height = fi->height;
         int8_t font_width = fi->width;
-        int8_t bpgl = fi->bytes_per_glyph_line;
         rgb16_t* rbuf = _scr_ctx->render_buf;
-        uint16_t glyphindex = (cl * font_height * bpgl);
+        _glyph_render(fi, c, color, rbuf, font_width);
         // See if we need to show the cursor
-        bool show_a_cursor = (_scr_ctx->show_cursor && col == _scr_ctx->cursor_pos.column && aline == _translate_cursor_line(_scr_ctx->cursor_pos.line));
-        rgb16_t cursor_color = _scr_ctx->cursor_color;
-        for (int glyph_line = 0; glyph_line < font_height; glyph_line++) {
-            if (show_a_cursor && glyph_line == _scr_ctx->font_info->suggested_cursor_line) {
-                for (int c = 0; c < font_width; c++) {
-                    *rbuf++ = cursor_color;
-                }
-            }
-            else {
-                // Get each glyph row for the character (each line of the font char height).
-                uint32_t cgr = 0;
-                uint32_t mask = 1u << (font_width - 1u);
-                for (int byte = 0; byte < bpgl; byte++) {
-                    cgr |= (fi->glyphs[glyphindex + byte + (glyph_line * bpgl)]) << (8u * byte);
-                }
-                for (int c = 0; c < font_width; c++) {
-                    // For each glyph column bit that is set, set the forground color in the character buffer.
-                    if (cgr & mask) {
-                        *rbuf = fgrgb;
-                    }
-                    else {
-                        *rbuf = bgrgb;
-                    }
-                    mask >>= 1u;
-                    rbuf++;
-                }
-            }
+        if (_scr_ctx->show_cursor && col == _scr_ctx->cursor_pos.column && aline == _translate_cursor_line(_scr_ctx->cursor_pos.line)) {
+            _fill_rgb16_buf(rbuf + (fi->suggested_cursor_line * font_width), _scr_ctx->cursor_color, font_width);
         }
-        // Set a window into the right part of the screen
-        uint16_t x = col * font_width;
-        uint16_t y = aline * font_height;
-        uint16_t w = font_width;
-        uint16_t h = font_height;
-        ili_window_set_area(x, y, w, h);
-        ili_screen_paint(_scr_ctx->render_buf, (font_width * font_height));
+        // Send it to the right part of the screen
+        _render_buf_paint(col * font_width, aline * font_height, font_width, font_height);
     }
     else {
-        _scr_ctx->dirty_text_lines[aline] = true;
+        _dirty_mark(aline, col, col);
     }
 }
 
@@ -152,10 +141,10 @@ static void _disp_eol_clear(uint16_t aline, uint16_t col, paint_control_t paint)
     memset((_scr_ctx->full_screen_text + (aline * _scr_ctx->cols) + col), SPACE_CHR, (_scr_ctx->cols - col));
     memset((_scr_ctx->full_screen_color + (aline * _scr_ctx->cols) + col), colorbyte(_scr_ctx->color_fg_default, _scr_ctx->color_bg_default), (_scr_ctx->cols - col));
     if (paint) {
-        _disp_line_paint(aline);
+        _disp_span_paint(aline, col, _scr_ctx->cols - 1);
     }
     else {
-        _scr_ctx->dirty_text_lines[aline] = true;
+        _dirty_mark(aline, col, _scr_ctx->cols - 1);
     }
 }
 
@@ -171,64 +160,173 @@ static void _disp_line_clear(uint16_t aline, paint_control_t paint) {
         _disp_line_paint(aline);
     }
     else {
-        _scr_ctx->dirty_text_lines[aline] = true;
+        _dirty_mark(aline, 0, _scr_ctx->cols - 1);
     }
 }
 
 /*
  * Update the portion of the screen containing the given character line.
  *
- * Getting the glyph data for the font character is similar to `disp_char_colorbyte`,
- * but the difference is that here we are rendering a complete line of characters one
- * glyph line at a time, and repeating that for all of the glyph lines.
- *
  * NOTE: This does not perform text line translation, nor bounds check.
  */
 static void _disp_line_paint(uint16_t aline) {
+    // The whole line is painted, so any changes waiting to be painted are done.
+    _dirty_clear(aline);
+    _disp_span_paint(aline, 0, _scr_ctx->cols - 1);
+}
+
+/*
+ * Update the portion of the screen containing a span of columns of a character line.
+ *
+ * Getting the glyph data for the font character is the same as `disp_char_colorbyte`,
+ * but the difference is that here we are rendering a span of characters, each
+ * one into its columns of the span's render buffer.
+ *
+ * NOTE: This does not perform text line translation, nor bounds check.
+ */
+static void _disp_span_paint(uint16_t aline, uint16_t first, uint16_t last) {
     const font_info_t* fi = _scr_ctx->font_info;
     int8_t font_height = fi->height;
     int8_t font_width = fi->width;
-    int8_t bpgl = fi->bytes_per_glyph_line;
-    bool show_cursor = (_scr_ctx->show_cursor && aline == _translate_cursor_line(_scr_ctx->cursor_pos.line));
-    int8_t cursor_show_row = fi->suggested_cursor_line;
+    uint16_t span_width = (last - first + 1) * font_width;
     uint16_t screen_line = aline * font_height;
     rgb16_t* rbuf = _scr_ctx->render_buf;
-    for (int glyph_line = 0; glyph_line < font_height; glyph_line++) {
-        for (uint16_t textcol = 0; textcol < _scr_ctx->cols; textcol++) {
-            uint16_t index = (aline * _scr_ctx->cols) + textcol;
-            unsigned char c = _scr_ctx->full_screen_text[index];
-            bool invert = c & DISP_CHAR_INVERT_BIT;
-            unsigned char cl = c & 0x7F;
-            uint8_t color = _scr_ctx->full_screen_color[index];
-            uint8_t fg = (invert ? bg_from_cb(color) : fg_from_cb(color));
-            uint8_t bg = (invert ? fg_from_cb(color) : bg_from_cb(color));
-            rgb16_t fgrgb = rgb16_from_color16(fg);
-            rgb16_t bgrgb = rgb16_from_color16(bg);
-            // Get the glyph row for the character (a line of the font char height).
-            uint16_t glyphindex = (cl * font_height * bpgl);
-            uint32_t cgr = 0;
-            for (int byte = 0; byte < bpgl; byte++) {
-                cgr |= (fi->glyphs[glyphindex + byte + (glyph_line * bpgl)]) << (8u * byte);
-            }
-            for (uint32_t mask = (1u << (font_width - 1u)); mask; mask >>= 1u) {
-                if (show_cursor && textcol == _scr_ctx->cursor_pos.column && glyph_line == cursor_show_row) {
-                    // Draw a cursor line
-                    *rbuf++ = _scr_ctx->cursor_color;
-                }
-                else if (cgr & mask) {
-                    // set the fg color
-                    *rbuf++ = fgrgb;
-                }
-                else {
-                    // set the bg color
-                    *rbuf++ = bgrgb;
-                }
-            }
+    for (uint16_t textcol = first; textcol <= last; textcol++) {
+        uint16_t index = (aline * _scr_ctx->cols) + textcol;
+        _glyph_render(fi, _scr_ctx->full_screen_text[index], _scr_ctx->full_screen_color[index], rbuf + ((textcol - first) * font_width), span_width);
+    }
+    uint16_t cursor_col = _scr_ctx->cursor_pos.column;
+    if (_scr_ctx->show_cursor && cursor_col >= first && cursor_col <= last && aline == _translate_cursor_line(_scr_ctx->cursor_pos.line)) {
+        // Draw a cursor line
+        rgb16_t* cbuf = rbuf + (fi->suggested_cursor_line * span_width) + ((cursor_col - first) * font_width);
+        _fill_rgb16_buf(cbuf, _scr_ctx->cursor_color, font_width);
+    }
+    // Write the pixel rows of the span to the display
+    _spans_painted++;
+    _render_buf_paint(first * font_width, screen_line, span_width, font_height);
+}
+
+/*
+ * Mark a line as painted.
+ */
+static void _dirty_clear(uint16_t aline) {
+    _scr_ctx->dirty_lines[aline >> 5] &= ~(1u << (aline & 0x1F));
+}
+
+/*
+ * Mark a span of columns of a line as needing to be painted (added to what was already marked).
+ */
+static void _dirty_mark(uint16_t aline, uint16_t first, uint16_t last) {
+    uint32_t* word = &_scr_ctx->dirty_lines[aline >> 5];
+    uint32_t bit = (1u << (aline & 0x1F));
+    if (*word & bit) {
+        _span_merges++;
+        if (first < _scr_ctx->dirty_col_first[aline]) {
+            _scr_ctx->dirty_col_first[aline] = first;
+        }
+        if (last > _scr_ctx->dirty_col_last[aline]) {
+            _scr_ctx->dirty_col_last[aline] = last;
         }
     }
-    // Write the pixel screen row to the display
-    ili_window_set_area(0, screen_line, _scr_ctx->cols * font_width, font_height);
-    ili_screen_paint(_scr_ctx->render_buf, _scr_ctx->cols * font_width * font_height);
+    else {
+        *word |= bit;
+        _scr_ctx->dirty_col_first[aline] = first;
+        _scr_ctx->dirty_col_last[aline] = last;
+    }
+}
+
+/*
+ * Mark all of the lines as needing to be painted.
+ */
+static void _dirty_mark_all(void) {
+    for (uint16_t aline = 0; aline < _scr_ctx->lines; aline++) {
+        _dirty_mark(aline, 0, _scr_ctx->cols - 1);
+    }
+}
+
+/*
+ * Send the render buffer to an area of the screen, and switch to the other render buffer.
+ *
+ * The transfer goes on while the next line (or character) is rendered into the other
+ * buffer. Only one transfer is in progress at a time (the display operations wait for
+ * the one in progress to complete), so the buffer switched to is no longer being sent.
+ */
+static void _render_buf_paint(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    ili_window_set_area(x, y, w, h);
+    ili_screen_paint(_scr_ctx->render_buf, w * h);
+    rgb16_t* rb = _scr_ctx->render_buf;
+    _scr_ctx->render_buf = _scr_ctx->render_buf_alt;
+    _scr_ctx->render_buf_alt = rb;
+}
+
+/*
+ * Send the scroll start to the display if it has changed.
+ *
+ * When printing without painting, the new-lines only move the scroll start in the
+ * text buffer. The display is scrolled once, when the lines are painted.
+ */
+static void _scroll_start_send(void) {
+    if (_scr_ctx->scroll_start_pending) {
+        _scr_ctx->scroll_start_pending = false;
+        ili_scroll_set_start(_scr_ctx->scroll_start * _scr_ctx->font_info->height);
+    }
+}
+
+/*
+ * Render a character into a buffer (using the glyph cache).
+ *
+ * If the character has the invert bit set, the foreground and background colors are swapped.
+ */
+static void _glyph_render(const font_info_t* fi, unsigned char c, colorbyte_t color, rgb16_t* dst, uint16_t stride) {
+    if (c & DISP_CHAR_INVERT_BIT) {
+        color = colorbyte(bg_from_cb(color), fg_from_cb(color));
+    }
+    c &= 0x7F;
+    const rgb16_t* glyph = glyph_cache_get(fi, c, color);
+    if (glyph) {
+        int8_t font_width = fi->width;
+        for (int glyph_line = 0; glyph_line < fi->height; glyph_line++) {
+            memcpy(dst, glyph, font_width * sizeof(rgb16_t));
+            glyph += font_width;
+            dst += stride;
+        }
+    }
+    else {
+        glyph_expand(fi, c, rgb16_from_color16(fg_from_cb(color)), rgb16_from_color16(bg_from_cb(color)), dst, stride);
+    }
+}
+
+/*
+ * Make a copy of a font (its information, index, and glyphs) in RAM.
+ *
+ * The copy is one allocation, with the font information first.
+ */
+static const font_info_t* _font_ram_copy(const font_info_t* fi) {
+    size_t index_size = (FONT_GLYPHS + 1) * sizeof(uint16_t);
+    size_t glyphs_size = fi->glyph_index[FONT_GLYPHS];
+    uint8_t* mem = malloc(sizeof(font_info_t) + index_size + glyphs_size);
+    if (mem == NULL) {
+        error_printf(false, "Display - Could not allocate RAM for the font.");
+        return (NULL);
+    }
+    uint16_t* index = (uint16_t*)(mem + sizeof(font_info_t));
+    uint8_t* glyphs = (uint8_t*)index + index_size;
+    memcpy(index, fi->glyph_index, index_size);
+    memcpy(glyphs, fi->glyphs, glyphs_size);
+    const font_info_t ram_fi = {
+        fi->name,
+        fi->width,
+        fi->height,
+        fi->suggested_cursor_line,
+        fi->bitmask,
+        fi->has_lowercase,
+        glyphs,
+        index,
+        fi->style,
+    };
+    memcpy(mem, &ram_fi, sizeof(font_info_t));
+
+    return ((const font_info_t*)mem);
 }
 
 /*! @brief Fill an RGB-16 buffer with an RGB-16 value. */
@@ -340,11 +438,12 @@ void disp_clear(paint_control_t paint) {
     size_t chars = _scr_ctx->lines * _scr_ctx->cols;
     memset(_scr_ctx->full_screen_text, SPACE_CHR, chars);
     memset(_scr_ctx->full_screen_color, colorbyte(_scr_ctx->color_fg_default, _scr_ctx->color_bg_default), chars);
-    memset(_scr_ctx->dirty_text_lines, false, _scr_ctx->lines);
+    memset(_scr_ctx->dirty_lines, 0, ((_scr_ctx->lines + 31) / 32) * sizeof(uint32_t));
     disp_cursor_home();
     if (paint) {
         display_backlight_on(false);    // Turning off the backlight helps this from being distracting
         ili_screen_clr(_scr_ctx->color_bg_default, false);
+        ili_paint_wait();               // Let the clear finish before the backlight comes back on
         display_backlight_on(true);
     }
 }
@@ -377,6 +476,20 @@ void disp_char_colorbyte(uint16_t line, uint16_t col, char c, colorbyte_t color,
     _disp_char_colorbyte(aline, col, c, color, paint);
 }
 
+bool disp_font_ram(bool ram) {
+    if (ram && !_font_ram) {
+        _font_ram = _font_ram_copy(_font);
+    }
+    _use_font_ram = (ram && _font_ram);
+    const font_info_t* fi = (_use_font_ram ? _font_ram : _font);
+    if (_scr_ctx && _scr_ctx->font_info != fi && _scr_ctx->font_info->width == fi->width && _scr_ctx->font_info->height == fi->height) {
+        // Same font, from the other place. The glyph cache is emptied, as it's keyed by the font.
+        _scr_ctx->font_info = fi;
+    }
+
+    return (_use_font_ram);
+}
+
 /*
  * Display all of the font characters. Wrap the characters until the full
  * screen is filled.
@@ -477,25 +590,142 @@ void disp_line_paint(uint16_t line) {
     _disp_line_paint(line);
 }
 
+uint32_t disp_paint_timed(bool dma) {
+    ili_dma_enable(dma);
+    uint64_t start = now_us();
+    disp_update(Paint);
+    ili_paint_wait();
+    uint32_t elapsed = (uint32_t)(now_us() - start);
+    ili_dma_enable(true);
+
+    return (elapsed);
+}
+
+uint32_t disp_glyph_render_timed(bool table, uint16_t count) {
+    const font_info_t* fi = _scr_ctx->font_info;
+    uint16_t line_width = _scr_ctx->cols * fi->width;
+    // The render buffer could be being sent to the screen
+    ili_paint_wait();
+    rgb16_t* rbuf = _scr_ctx->render_buf;
+    uint64_t start = now_us();
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t c = SPACE_CHR + (i % 95);
+        uint16_t col = i % _scr_ctx->cols;
+        rgb16_t fg = _color16_map[(i & 0x1) ? C16_BR_WHITE : C16_YELLOW];
+        rgb16_t bg = _color16_map[(i & 0x1) ? C16_BLACK : C16_BLUE];
+        if (table) {
+            glyph_expand(fi, c, fg, bg, rbuf + (col * fi->width), line_width);
+        }
+        else {
+            glyph_expand_per_bit(fi, c, fg, bg, rbuf + (col * fi->width), line_width);
+        }
+    }
+    return ((uint32_t)(now_us() - start));
+}
+
+uint32_t disp_line_render_cycles(bool ram, bool cold) {
+    const font_info_t* fi = (ram ? _font_ram : _font);
+    if (!fi) {
+        // No RAM copy (yet)
+        fi = _font_ram = _font_ram_copy(_font);
+        if (!fi) {
+            return (0);
+        }
+    }
+    uint16_t line_width = _scr_ctx->cols * fi->width;
+    rgb16_t fg = _color16_map[C16_BR_WHITE];
+    rgb16_t bg = _color16_map[C16_BLACK];
+    // The render buffer could be being sent to the screen
+    ili_paint_wait();
+    rgb16_t* rbuf = _scr_ctx->render_buf;
+    if (cold) {
+        // Flush the XIP cache (this also drops the cached code, the same for either font).
+        xip_ctrl_hw->flush = 1;
+        while (!(xip_ctrl_hw->stat & XIP_STAT_FLUSH_READY_BITS)) {
+            tight_loop_contents();
+        }
+    }
+    // The M0+ doesn't have a cycle counter, so use SysTick (24 bit, counts down) at the CPU clock.
+    // Interrupts are off so that only the render is counted.
+    uint32_t flags = save_and_disable_interrupts();
+    uint32_t systick_csr = systick_hw->csr;
+    uint32_t systick_rvr = systick_hw->rvr;
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = (M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS);
+    uint32_t start = systick_hw->cvr;
+    (void)systick_hw->csr;  // Reading clears the COUNTFLAG
+    for (uint16_t col = 0; col < _scr_ctx->cols; col++) {
+        glyph_expand(fi, SPACE_CHR + 1 + (col % 94), fg, bg, rbuf + (col * fi->width), line_width);
+    }
+    uint32_t end = systick_hw->cvr;
+    // The COUNTFLAG is set if the count reached 0 (and reloaded), so the cycles can't be known.
+    bool wrapped = (systick_hw->csr & M0PLUS_SYST_CSR_COUNTFLAG_BITS);
+    systick_hw->csr = systick_csr;
+    systick_hw->rvr = systick_rvr;
+    restore_interrupts(flags);
+    if (wrapped || end > start) {
+        return (0);
+    }
+
+    return (start - end);
+}
+
+uint32_t disp_glyph_decode_timed(uint16_t count) {
+    const font_info_t* fi = _scr_ctx->font_info;
+    uint32_t rows[FONT_HEIGHT_MAX];
+    uint64_t start = now_us();
+    for (uint16_t i = 0; i < count; i++) {
+        font_glyph_rows(fi, SPACE_CHR + (i % 95), rows);
+    }
+    return ((uint32_t)(now_us() - start));
+}
+
 /*
  * Paint the physical screen from the text.
  */
 void disp_paint(void) {
-    int16_t lines = _scr_ctx->lines;
-    uint16_t aline;
-    bool some_lines_dirty = false;
-    for (uint16_t i = 0; i < lines && !some_lines_dirty; i++) {
-        some_lines_dirty |= _scr_ctx->dirty_text_lines[i];
-    }
-    if (some_lines_dirty) {
-        for (uint16_t line = 0; line < lines; line++) {
-            aline = _translate_line(line);
-            if (_scr_ctx->dirty_text_lines[aline]) {
-                _disp_line_paint(aline);
-                _scr_ctx->dirty_text_lines[aline] = false; // The text line has been painted, mark it 'not dirty'
+    disp_paint_async();
+    while (disp_paint_job_poll()) {
+        // Each step renders a line while the previous one is being sent
+    }
+}
+
+void disp_paint_async(void) {
+    _paint_job_active = true;
+}
+
+bool disp_paint_job_poll(void) {
+    if (!_paint_job_active) {
+        return (false);
+    }
+    // Scroll the display first, so the lines are painted where they will be seen
+    _scroll_start_send();
+    // Paint the changed span of the first dirty line (in the text buffer). Lines changed
+    // while the job is running are picked up, and the job ends when no lines are dirty.
+    uint16_t words = (_scr_ctx->lines + 31) / 32;
+    for (uint16_t w = 0; w < words; w++) {
+        uint32_t bits = _scr_ctx->dirty_lines[w];
+        if (bits) {
+            uint16_t aline = (w * 32) + __builtin_ctz(bits);
+            uint16_t first = _scr_ctx->dirty_col_first[aline];
+            uint16_t last = _scr_ctx->dirty_col_last[aline];
+            if (_scr_ctx->show_cursor && aline == _translate_cursor_line(_scr_ctx->cursor_pos.line)) {
+                // Include the cursor, as it could have moved within the line
+                uint16_t cursor_col = _scr_ctx->cursor_pos.column;
+                if (cursor_col < _scr_ctx->cols) {
+                    first = (cursor_col < first ? cursor_col : first);
+                    last = (cursor_col > last ? cursor_col : last);
+                }
             }
+            _dirty_clear(aline); // The span is being painted, mark the line 'not dirty'
+            _disp_span_paint(aline, first, last);
+            return (true);
         }
     }
+    _paint_job_active = false;
+
+    return (false);
 }
 
 void disp_print_crlf(int16_t add_lines, paint_control_t paint) {
@@ -520,10 +750,14 @@ void disp_print_crlf(int16_t add_lines, paint_control_t paint) {
             ss = _scr_ctx->fixed_area_top_size;
         }
         _scr_ctx->scroll_start = ss;
+        _scr_ctx->scroll_start_pending = true;
+        _scroll_lines++;
         // blank out what will be the cursor line
         aline = _translate_cursor_line(new_cp.line);
         _disp_line_clear(aline, paint);
-        ili_scroll_set_start(ss * _scr_ctx->font_info->height);
+        if (paint) {
+            _scroll_start_send();
+        }
     }
     else {
         // blank out what will be the cursor line
@@ -704,7 +938,7 @@ void disp_text_colors_set(colorn16_t fg, colorn16_t bg) {
 
 void disp_update(paint_control_t paint) {
     // Mark all lines as 'dirty' so they will be re-rendered during a `paint` operation.
-    memset(_scr_ctx->dirty_text_lines, true, _scr_ctx->lines * sizeof(bool));
+    _dirty_mark_all();
     if (paint) {
         disp_paint();
     }
@@ -718,8 +952,13 @@ void disp_screen_close() {
     // Free the buffers from the current context...
     free(_scr_ctx->full_screen_text);
     free(_scr_ctx->full_screen_color);
-    free(_scr_ctx->dirty_text_lines);
+    free(_scr_ctx->dirty_lines);
+    free(_scr_ctx->dirty_col_first);
+    free(_scr_ctx->dirty_col_last);
+    // The render buffers can't be freed while one is being sent to the screen
+    ili_paint_wait();
     free(_scr_ctx->render_buf);
+    free(_scr_ctx->render_buf_alt);
     // Now free the current context
     free(_scr_ctx);
 
@@ -743,8 +982,8 @@ bool disp_screen_new() {
         return false;
     }
     // For now, we only have one font - get its info
-    const font_info_t* fi = &font_10_16;
-    info_printf(true, "Display font: %s.\n", fi->name);
+    const font_info_t* fi = (_use_font_ram ? _font_ram : _font);
+    info_printf(true, "Display font: %s%s.\n", fi->name, (_use_font_ram ? " (in RAM)" : ""));
     scr_context->font_info = fi;
     scr_context->color_bg_default = C16_BLACK;
     scr_context->color_fg_default = C16_WHITE;
@@ -758,13 +997,17 @@ bool disp_screen_new() {
     // Allocate buffers
     scr_context->full_screen_text = (uint8_t*)malloc(chars);
     scr_context->full_screen_color = (colorbyte_t*)malloc(chars);
-    scr_context->dirty_text_lines = (bool*)calloc(lines, sizeof(bool));
+    scr_context->dirty_lines = (uint32_t*)calloc((lines + 31) / 32, sizeof(uint32_t));
+    scr_context->dirty_col_first = (uint16_t*)malloc(lines * sizeof(uint16_t));
+    scr_context->dirty_col_last = (uint16_t*)malloc(lines * sizeof(uint16_t));
     scr_context->render_buf = (rgb16_t*)malloc(fi->width * fi->height * cols * sizeof(rgb16_t));
+    scr_context->render_buf_alt = (rgb16_t*)malloc(fi->width * fi->height * cols * sizeof(rgb16_t));
     // Default scroll area to the full screen
     scr_context->fixed_area_top_size = 0;
     scr_context->fixed_area_bottom_size = 0;
     scr_context->scroll_size = lines;
     scr_context->scroll_start = 0;
+    scr_context->scroll_start_pending = false;
     scr_context->cursor_pos = (scr_position_t){ 0, 0 };
     scr_context->show_cursor = false; // Start with the cursor off (typical for dialogs)
     // 16-bit from R5G6B5 = R5*2048 + G6*32 + B5
@@ -777,6 +1020,30 @@ bool disp_screen_new() {
     return (true);
 }
 
+void disp_stats(disp_stats_t* stats) {
+    glyph_cache_stats_t gcs;
+    glyph_cache_stats(&gcs);
+    stats->glyph_cache_hits = gcs.hits;
+    stats->glyph_cache_misses = gcs.misses;
+    stats->glyph_cache_evictions = gcs.evictions;
+    stats->glyph_cache_used = gcs.used;
+    stats->glyph_cache_size = gcs.size;
+    stats->spans_painted = _spans_painted;
+    stats->span_merges = _span_merges;
+    ili_stats_t is;
+    ili_stats(&is);
+    stats->spi_pixel_bytes = is.pixel_bytes;
+    stats->spi_control_bytes = is.commands + is.param_bytes;
+    stats->spi_pixel_writes = is.pixel_writes;
+    stats->scroll_lines = _scroll_lines;
+    stats->scroll_starts = is.scroll_starts;
+    stats->scroll_start = is.scroll_start;
+    const font_info_t* fi = _scr_ctx->font_info;
+    stats->font_data_bytes = font_data_size(fi);
+    stats->font_unpacked_bytes = FONT_GLYPHS * fi->height * ((fi->width + 7) / 8);
+    stats->font_in_ram = (_font_ram && fi == _font_ram);
+}
+
 void disp_scroll_area_define(uint16_t top_fixed_size, uint16_t bottom_fixed_size) {
     uint16_t screen_lines = _scr_ctx->lines;
     uint16_t fixed_lines = top_fixed_size + bottom_fixed_size;
@@ -798,7 +1065,8 @@ void disp_scroll_area_define(uint16_t top_fixed_size, uint16_t bottom_fixed_size
     _scr_ctx->fixed_area_bottom_size = bottom_fixed_size;
     _scr_ctx->scroll_size = screen_lines - (top_fixed_size + bottom_fixed_size);
     ili_scroll_set_area(top_fixed_size * _scr_ctx->font_info->height, bottom_fixed_size * _scr_ctx->font_info->height);
-    ili_scroll_set_start(_scr_ctx->scroll_start);
+    _scr_ctx->scroll_start_pending = true;
+    _scroll_start_send();
     disp_cursor_home();
 }
 
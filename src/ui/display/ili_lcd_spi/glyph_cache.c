@@ -0,0 +1,182 @@
+/**
+ * Cache of expanded (RGB-16) glyphs.
+ *
+ * The entries are found by a scan of their keys (there are few of them, and the
+ * last one found is checked first, as runs of the same character and color are common).
+ * The least recently used entry is replaced when one is needed.
+ *
+ * The glyph rows are decoded from the (packed) font, then expanded a nibble (4 pixels)
+ * at a time, from a table of the 16 possible 4 pixel patterns in the current foreground
+ * and background colors. The table is rebuilt when the colors change (which is rare from one character to the next).
+ * Each pattern is stored with two 32 bit writes. The Cortex-M0+ doesn't have 64 bit
+ * stores or unaligned access, so the writes are used when the destination is word
+ * aligned (which it is for fonts with an even width), otherwise the pattern is
+ * written a pixel at a time.
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#include "glyph_cache.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define _KEY_EMPTY 0xFFFFu
+
+static const font_info_t* _font = NULL;
+static rgb16_t* _pixels = NULL;         // GLYPH_CACHE_ENTRIES expanded glyphs
+static uint16_t _glyph_pixels;          // Pixels in a glyph of the font
+static uint16_t _keys[GLYPH_CACHE_ENTRIES];     // Character and color of each entry
+static uint32_t _used[GLYPH_CACHE_ENTRIES];     // When each entry was last used
+static uint32_t _tick;
+static int _last;
+static glyph_cache_stats_t _stats;
+
+// Nibble expansion table (4 pixels for each nibble value, first pixel in the low half of the first word)
+static uint32_t _nibble_pixels[16][2];
+static rgb16_t _nibble_fg;
+static rgb16_t _nibble_bg;
+static bool _nibble_valid = false;
+
+
+/**
+ * @brief Empty the cache and size it for a font.
+ */
+static void _font_set(const font_info_t* fi) {
+    uint16_t glyph_pixels = fi->width * fi->height;
+    if (!_pixels || glyph_pixels != _glyph_pixels) {
+        free(_pixels);
+        _pixels = malloc(GLYPH_CACHE_ENTRIES * glyph_pixels * sizeof(rgb16_t));
+    }
+    _font = fi;
+    _glyph_pixels = glyph_pixels;
+    for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+        _keys[i] = _KEY_EMPTY;
+        _used[i] = 0;
+    }
+    _last = 0;
+    _stats.used = 0;
+    _stats.size = (_pixels ? GLYPH_CACHE_ENTRIES : 0);
+}
+
+/**
+ * @brief Build the nibble expansion table for a pair of colors.
+ */
+static void _nibble_table_build(rgb16_t fg, rgb16_t bg) {
+    for (int n = 0; n < 16; n++) {
+        // The high bit of the nibble is the left (first) pixel
+        uint32_t p0 = ((n & 0x8) ? fg : bg);
+        uint32_t p1 = ((n & 0x4) ? fg : bg);
+        uint32_t p2 = ((n & 0x2) ? fg : bg);
+        uint32_t p3 = ((n & 0x1) ? fg : bg);
+        _nibble_pixels[n][0] = p0 | (p1 << 16);
+        _nibble_pixels[n][1] = p2 | (p3 << 16);
+    }
+    _nibble_fg = fg;
+    _nibble_bg = bg;
+    _nibble_valid = true;
+}
+
+void glyph_expand(const font_info_t* fi, uint8_t c, rgb16_t fg, rgb16_t bg, rgb16_t* dst, uint16_t stride) {
+    if (!_nibble_valid || fg != _nibble_fg || bg != _nibble_bg) {
+        _nibble_table_build(fg, bg);
+    }
+    int8_t font_height = fi->height;
+    int8_t font_width = fi->width;
+    uint32_t rows[FONT_HEIGHT_MAX];
+    font_glyph_rows(fi, c, rows);
+    bool aligned = (0 == ((uintptr_t)dst & 0x3) && 0 == (stride & 0x1));
+    for (int glyph_line = 0; glyph_line < font_height; glyph_line++) {
+        uint32_t cgr = rows[glyph_line];
+        rgb16_t* p = dst;
+        int bit = font_width;
+        // Each nibble (from the left) is 4 pixels from the table
+        while (bit >= 4) {
+            bit -= 4;
+            const uint32_t* px = _nibble_pixels[(cgr >> bit) & 0xF];
+            if (aligned) {
+                ((uint32_t*)p)[0] = px[0];
+                ((uint32_t*)p)[1] = px[1];
+            }
+            else {
+                const rgb16_t* px16 = (const rgb16_t*)px;
+                p[0] = px16[0];
+                p[1] = px16[1];
+                p[2] = px16[2];
+                p[3] = px16[3];
+            }
+            p += 4;
+        }
+        // The rest of the row (if the width isn't a multiple of 4)
+        while (bit > 0) {
+            bit--;
+            *p++ = ((cgr & (1u << bit)) ? fg : bg);
+        }
+        dst += stride;
+    }
+}
+
+void glyph_expand_per_bit(const font_info_t* fi, uint8_t c, rgb16_t fg, rgb16_t bg, rgb16_t* dst, uint16_t stride) {
+    int8_t font_height = fi->height;
+    int8_t font_width = fi->width;
+    uint32_t rows[FONT_HEIGHT_MAX];
+    font_glyph_rows(fi, c, rows);
+    for (int glyph_line = 0; glyph_line < font_height; glyph_line++) {
+        uint32_t cgr = rows[glyph_line];
+        rgb16_t* p = dst;
+        for (uint32_t mask = (1u << (font_width - 1u)); mask; mask >>= 1u) {
+            // For each glyph column bit that is set, use the forground color.
+            *p++ = ((cgr & mask) ? fg : bg);
+        }
+        dst += stride;
+    }
+}
+
+const rgb16_t* glyph_cache_get(const font_info_t* fi, uint8_t c, colorbyte_t color) {
+    if (fi != _font) {
+        _font_set(fi);
+    }
+    if (!_pixels) {
+        return (NULL);
+    }
+    uint16_t key = ((uint16_t)c << 8) | color;
+    _tick++;
+    if (_keys[_last] == key) {
+        _used[_last] = _tick;
+        _stats.hits++;
+        return (&_pixels[_last * _glyph_pixels]);
+    }
+    int lru = 0;
+    for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+        if (_keys[i] == key) {
+            _used[i] = _tick;
+            _last = i;
+            _stats.hits++;
+            return (&_pixels[i * _glyph_pixels]);
+        }
+        if (_used[i] < _used[lru]) {
+            lru = i;
+        }
+    }
+    // Not cached. Replace the least recently used (empty entries have never been used).
+    _stats.misses++;
+    if (_keys[lru] == _KEY_EMPTY) {
+        _stats.used++;
+    }
+    else {
+        _stats.evictions++;
+    }
+    rgb16_t* glyph = &_pixels[lru * _glyph_pixels];
+    glyph_expand(fi, c, rgb16_from_color16(fg_from_cb(color)), rgb16_from_color16(bg_from_cb(color)), glyph, fi->width);
+    _keys[lru] = key;
+    _used[lru] = _tick;
+    _last = lru;
+
+    return (glyph);
+}
+
+void glyph_cache_stats(glyph_cache_stats_t* stats) {
+    memcpy(stats, &_stats, sizeof(glyph_cache_stats_t));
+}
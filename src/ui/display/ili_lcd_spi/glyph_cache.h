@@ -0,0 +1,91 @@
+/**
+ * Cache of expanded (RGB-16) glyphs.
+ *
+ * Rendering a character from the font bitmap means testing each bit of each glyph
+ * row and picking the foreground or background color for it. The screen mostly
+ * shows the same few characters in the same few colors, so the expanded glyphs are
+ * kept (least recently used are replaced) keyed by the character and its colors.
+ * Rendering a cached glyph is then a copy of each of its rows.
+ *
+ * The cache holds `GLYPH_CACHE_ENTRIES` glyphs of the font in use (it is emptied
+ * when a different font is used).
+ *
+ * Copyright 2023 AESilky
+ * SPDX-License-Identifier: MIT License
+ *
+ */
+#ifndef _GLYPH_CACHE_H_
+#define _GLYPH_CACHE_H_
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "display.h"
+#include "font.h"
+
+#define GLYPH_CACHE_ENTRIES 32
+
+/**
+ * @brief Glyph cache statistics.
+ * @ingroup display
+ */
+typedef struct _glyph_cache_stats_ {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;         // Glyphs replaced to make room
+    uint16_t used;              // Entries in use
+    uint16_t size;              // Entries (0 if the cache couldn't be allocated)
+} glyph_cache_stats_t;
+
+/**
+ * @brief Render a glyph (one character) into a buffer.
+ * @ingroup display
+ *
+ * @param fi The font.
+ * @param c The character (without the invert bit).
+ * @param fg The foreground color.
+ * @param bg The background color.
+ * @param dst The buffer to render into (the top left pixel of the character).
+ * @param stride The number of pixels from one row to the next in the buffer.
+ */
+extern void glyph_expand(const font_info_t* fi, uint8_t c, rgb16_t fg, rgb16_t bg, rgb16_t* dst, uint16_t stride);
+
+/**
+ * @brief Render a glyph into a buffer a bit (pixel) at a time.
+ * @ingroup display
+ *
+ * This is the way glyphs were rendered before `glyph_expand` used a table. It is
+ * kept for comparing the performance. The parameters are the same as `glyph_expand`.
+ */
+extern void glyph_expand_per_bit(const font_info_t* fi, uint8_t c, rgb16_t fg, rgb16_t bg, rgb16_t* dst, uint16_t stride);
+
+/**
+ * @brief Get the expanded glyph for a character in a color, from the cache.
+ * @ingroup display
+ *
+ * The glyph is expanded and added to the cache if it isn't there. The glyph rows
+ * are `fi->width` pixels, one after the other.
+ *
+ * The glyph is valid until the next call (it could be replaced).
+ *
+ * @param fi The font.
+ * @param c The character (without the invert bit).
+ * @param color The color (with fg/bg swapped for an inverted character).
+ * @return The glyph, or NULL if the cache couldn't be allocated (use `glyph_expand`).
+ */
+extern const rgb16_t* glyph_cache_get(const font_info_t* fi, uint8_t c, colorbyte_t color);
+
+/**
+ * @brief Get the glyph cache statistics.
+ * @ingroup display
+ *
+ * @param stats Structure to fill in.
+ */
+extern void glyph_cache_stats(glyph_cache_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // _GLYPH_CACHE_H_
@@ -37,7 +37,15 @@ static uint16_t _old_y1 = 0xffff, _old_y2 = 0xffff;
 /** @brief Flag to track if the screen has been written to since we know it was cleared. */
 static bool _screen_dirty = true; // start out assuming dirty
 
+/** @brief Use DMA for painting (otherwise the pixels are written one at a time). */
+static bool _dma_enabled = true;
+/** @brief A DMA paint is in progress. Its operation is ended when it completes. */
+static bool _paint_pending = false;
+/** @brief Color for a DMA fill (must stay put during the transfer). */
+static rgb16_t _fill_color;
+
 static ili_disp_info_t _ili_disp_info;
+static ili_stats_t _stats;
 static ili_controller_type _ili_controller_type = ILI_CONTROLLER_NONE;
 
 /**
@@ -66,7 +74,21 @@ static void _command_mode(bool cmd) {
     }
 }
 
+/**
+ * @brief Finish a DMA paint that is in progress, ending its operation.
+ */
+static void _paint_finish() {
+    if (_paint_pending) {
+        spi_display_dma_wait();
+        _paint_pending = false;
+        _cs(false);
+        spi_display_end();
+    }
+}
+
 static void _op_begin() {
+    // A DMA paint holds the display until it is done
+    _paint_finish();
     spi_display_begin();
     _cs(true);
 }
@@ -100,6 +122,7 @@ static void _send_command(uint8_t cmd) {
     _command_mode(true);
     spi_display_write8_buf(&cmd, 1);
     _command_mode(false);
+    _stats.commands++;
 }
 
 /**
@@ -109,6 +132,7 @@ static void _send_command(uint8_t cmd) {
 static void _send_command_wd(uint8_t cmd, const uint8_t* data, size_t count) {
     _send_command(cmd);
     spi_display_write8_buf(data, count);
+    _stats.param_bytes += count;
 }
 
 /** @brief Set window. MUST BE CALLED WITHIN `_op_begin` and `_op_end`!!! */
@@ -123,6 +147,8 @@ static void _set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
         spi_display_write16(words[1]);
         _old_x1 = x;
         _old_x2 = x2;
+        _stats.param_bytes += 4;
+        _stats.windows_set++;
     }
     if (y != _old_y1 || y2 != _old_y2) {
         _send_command(ILI_PASET); // Page address set
@@ -132,6 +158,8 @@ static void _set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
         spi_display_write16(words[1]);
         _old_y1 = y;
         _old_y2 = y2;
+        _stats.param_bytes += 4;
+        _stats.windows_set++;
     }
     _send_command(ILI_RAMWR); // Set it up to write to RAM
 }
@@ -146,6 +174,8 @@ static void _set_window_fullscreen(void) {
 */
 static void _write_area(const rgb16_t* rgb_pixel_data, uint16_t pixels) {
     spi_display_write16_buf(rgb_pixel_data, pixels);
+    _stats.pixel_bytes += pixels * sizeof(rgb16_t);
+    _stats.pixel_writes++;
 }
 
 /**
@@ -196,6 +226,19 @@ void ili_colors_show() {
     _screen_dirty = true;
 }
 
+void ili_dma_enable(bool enable) {
+    _paint_finish();
+    _dma_enabled = enable;
+}
+
+bool ili_paint_busy() {
+    return (_paint_pending && spi_display_dma_busy());
+}
+
+void ili_paint_wait() {
+    _paint_finish();
+}
+
 void ili_send_command(uint8_t cmd) {
     _op_begin();
     {
@@ -296,10 +339,17 @@ void ili_screen_on(bool on) {
 
 void ili_screen_paint(const rgb16_t* rgb_pixel_data, uint16_t pixels) {
     _op_begin();
-    {
+    if (_dma_enabled) {
+        // Return once the transfer is started. The operation is ended when it is done.
+        spi_display_write16_buf_dma(rgb_pixel_data, pixels);
+        _paint_pending = true;
+        _stats.pixel_bytes += pixels * sizeof(rgb16_t);
+        _stats.pixel_writes++;
+    }
+    else {
         _write_area(rgb_pixel_data, pixels);
+        _op_end();
     }
-    _op_end();
     _screen_dirty = true;
 }
 
@@ -330,6 +380,11 @@ void ili_scroll_set_area(uint16_t top_fixed_lines, uint16_t bottom_fixed_lines)
         _send_command(ILI_VSCRSADD);
         uint16_t row = top_fixed_lines;
         spi_display_write16(row);
+        _stats.param_bytes += 8;
+        _stats.scroll_top_fixed = words[0];
+        _stats.scroll_height = words[1];
+        _stats.scroll_bottom_fixed = words[2];
+        _stats.scroll_start = row;
         // Set window within the scroll area
     }
     _op_end();
@@ -340,6 +395,9 @@ void ili_scroll_set_start(uint16_t row) {
     {
         _send_command(ILI_VSCRSADD);
         spi_display_write16(row);
+        _stats.param_bytes += 2;
+        _stats.scroll_starts++;
+        _stats.scroll_start = row;
     }
     _op_end();
 }
@@ -374,15 +432,27 @@ void ili_line_paint(uint16_t line, rgb16_t* buf) {
 
 void ili_screen_clr(rgb16_t color, bool force) {
     if (force || _screen_dirty) {
-        memset(_ili_line_buf, color, _screen_width * sizeof(rgb16_t));
-        _op_begin();
-        {
+        if (_dma_enabled) {
+            _op_begin();
+            // Repeat the one color for the whole screen.
+            _fill_color = color;
             _set_window_fullscreen();
-            for (int i = 0; i < _screen_height; i++) {
-                _write_area(_ili_line_buf, _screen_width);
+            spi_display_fill16_dma(&_fill_color, (size_t)_screen_width * _screen_height);
+            _paint_pending = true;
+            _stats.pixel_bytes += (uint32_t)_screen_width * _screen_height * sizeof(rgb16_t);
+            _stats.pixel_writes++;
+        }
+        else {
+            memset(_ili_line_buf, color, _screen_width * sizeof(rgb16_t));
+            _op_begin();
+            {
+                _set_window_fullscreen();
+                for (int i = 0; i < _screen_height; i++) {
+                    _write_area(_ili_line_buf, _screen_width);
+                }
             }
+            _op_end();
         }
-        _op_end();
         _screen_dirty = false;
     }
     else {
@@ -395,6 +465,10 @@ void ili_screen_clr(rgb16_t color, bool force) {
     }
 }
 
+void ili_stats(ili_stats_t* stats) {
+    memcpy(stats, &_stats, sizeof(ili_stats_t));
+}
+
 ili_controller_type ili_module_init(void) {
     // Take reset low, then high
     gpio_put(DISPLAY_RESET_OUT, DISPLAY_HW_RESET_OFF);
@@ -427,6 +501,7 @@ ili_controller_type ili_module_init(void) {
         warn_printf(false, "Cannot determine display controller type (9341 or 9488)");
     }
 
+    spi_display_dma_init();
     if (_ili_controller_type != ILI_CONTROLLER_NONE) {
         uint8_t cmd, x, numArgs;
         _op_begin();
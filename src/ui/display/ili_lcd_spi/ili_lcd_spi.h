@@ -169,6 +169,26 @@ typedef struct _ili_disp_info_ {
     uint8_t lcd_id4_ic_model2;
 } ili_disp_info_t;
 
+/**
+ * @brief Display (SPI) traffic statistics and the vertical scroll settings.
+ * @ingroup display
+ *
+ * This accounts for what is sent to the controller, so the cost of the
+ * display operations can be measured.
+ */
+typedef struct _ili_stats_ {
+    uint32_t commands;          // Command bytes sent
+    uint32_t param_bytes;       // Command parameter (data) bytes sent (window, scroll, init)
+    uint32_t pixel_bytes;       // Pixel data bytes sent
+    uint32_t pixel_writes;      // Pixel transfers (paints and fills)
+    uint32_t windows_set;       // Column/Page address sets (the window is only set when it changes)
+    uint32_t scroll_starts;     // Vertical scroll start address sets
+    uint16_t scroll_top_fixed;  // Vertical scroll definition: top fixed area rows
+    uint16_t scroll_height;     // Vertical scroll definition: scroll area rows
+    uint16_t scroll_bottom_fixed; // Vertical scroll definition: bottom fixed area rows
+    uint16_t scroll_start;      // Vertical scroll start address (row)
+} ili_stats_t;
+
 /**
  * @brief Send a command byte to the controller.
  * @ingroup display
@@ -208,6 +228,17 @@ extern void ili_send_command_wd(uint8_t cmd, uint8_t* data, size_t count);
  */
 extern void ili_colors_show();
 
+/**
+ * @brief Use DMA to paint (the default), or write the pixels one at a time.
+ * @ingroup display
+ *
+ * The pixel at a time writes are what was used before DMA, and are kept for
+ * comparing the performance.
+ *
+ * @param enable True to use DMA.
+ */
+extern void ili_dma_enable(bool enable);
+
 /**
  * @brief Get a pointer to a buffer large enough to hold
  * one scan line for the ILI display.
@@ -227,12 +258,35 @@ extern rgb16_t* ili_get_line_buf();
 */
 extern ili_disp_info_t* ili_info(void);
 
+/**
+ * @brief Get the display (SPI) traffic statistics.
+ * @ingroup display
+ *
+ * @param stats Structure to fill in.
+ */
+extern void ili_stats(ili_stats_t* stats);
+
 /**
  * @brief Initialize the display.
  * @ingroup display
 */
 extern ili_controller_type ili_module_init(void);
 
+/**
+ * @brief Indicate if a paint (DMA transfer) is in progress.
+ * @ingroup display
+ */
+extern bool ili_paint_busy();
+
+/**
+ * @brief Wait for a paint (DMA transfer) that is in progress to complete.
+ * @ingroup display
+ *
+ * The buffer passed to `ili_screen_paint` can be changed after this.
+ * The other display operations wait for a paint to complete before starting.
+ */
+extern void ili_paint_wait();
+
 /**
  * @brief Paint a buffer of rgb16_t values to one horizontal line
  * of the screen. The buffer passed in must be at least `ILI_WIDTH`
@@ -276,6 +330,10 @@ extern void ili_screen_on(bool on);
  * Uses the buffer of RGB data to paint the screen into the screen window.
  * Set the screen window using `ili_window_set_area`.
  *
+ * When DMA is enabled this returns once the transfer has started, so the
+ * buffer must not be changed until `ili_paint_wait` has been called (or
+ * another display operation has been started).
+ *
  * @param data RGB-12 pixel data buffer (1 rgb value for each pixel to paint)
  * @param pixels Number of pixels (size of the data buffer in rgb_t's)
  */
@@ -13,8 +13,10 @@
 #include "cmd.h"
 #include "cmt.h"
 #include "core1_main.h"
+#include "disp_cmdq.h"
 #include "display.h"
 #include "mkboard.h"
+#include "mkcap.h"
 #include "mkwire.h"
 #include "multicore.h"
 #include "re_pbsw.h"
@@ -32,7 +34,9 @@
 #define _UI_STATUS_PULSE_PERIOD 7001
 
 // Internal, non message handler, function declarations
-static void _sort_station_list(const mk_station_id_t *stations[], int len);
+static int _station_list_insert(mk_station_handle_t station);
+static int _station_list_remove(mk_station_handle_t station);
+static void _stations_changed(int from);
 static void _ui_init_terminal_shell();
 
 // Message handler functions...
@@ -44,11 +48,14 @@ static void _handle_kob_status(cmt_msg_t* msg);
 static void _handle_touch_panel(cmt_msg_t* msg);
 static void _handle_update_ui_status(cmt_msg_t* msg);
 static void _handle_wifi_conn_status_update(cmt_msg_t* msg);
+static void _handle_wire_capture_replay(cmt_msg_t* msg);
+static void _handle_wire_capture_write(cmt_msg_t* msg);
 static void _handle_wire_changed(cmt_msg_t* msg);
 static void _handle_wire_connected_state(cmt_msg_t* msg);
 static void _handle_wire_station_msgs(cmt_msg_t* msg);
 
 static void _ui_idle_function_1();
+static void _ui_idle_function_2();
 
 static cmt_msg_t _msg_ui_cmd_start;
 static cmt_msg_t _msg_ui_initialized;
@@ -68,10 +75,14 @@ static const msg_handler_entry_t _kob_status_handler_entry = { MSG_KOB_STATUS, _
 static const msg_handler_entry_t _touch_panel_handler_entry = { MSG_TOUCH_PANEL, _handle_touch_panel };
 static const msg_handler_entry_t _update_status_handler_entry = { MSG_UPDATE_UI_STATUS, _handle_update_ui_status };
 static const msg_handler_entry_t _wifi_status_handler_entry = { MSG_WIFI_CONN_STATUS_UPDATE, _handle_wifi_conn_status_update };
+static const msg_handler_entry_t _wire_capture_replay_handler_entry = { MSG_WIRE_CAPTURE_REPLAY, _handle_wire_capture_replay };
+static const msg_handler_entry_t _wire_capture_write_handler_entry = { MSG_WIRE_CAPTURE_WRITE, _handle_wire_capture_write };
 static const msg_handler_entry_t _wire_changed_handler_entry = { MSG_WIRE_CHANGED, _handle_wire_changed };
 static const msg_handler_entry_t _wire_connected_state_handler_entry = { MSG_WIRE_CONNECTED_STATE, _handle_wire_connected_state };
 static const msg_handler_entry_t _wire_current_sender_handler_entry = { MSG_WIRE_CURRENT_SENDER, _handle_wire_station_msgs };
-static const msg_handler_entry_t _wire_station_id_handler_entry = { MSG_WIRE_STATION_ID_RCVD, _handle_wire_station_msgs };
+static const msg_handler_entry_t _wire_station_added_handler_entry = { MSG_WIRE_STATION_ADDED, _handle_wire_station_msgs };
+static const msg_handler_entry_t _wire_station_expired_handler_entry = { MSG_WIRE_STATION_EXPIRED, _handle_wire_station_msgs };
+static const msg_handler_entry_t _wire_station_updated_handler_entry = { MSG_WIRE_STATION_UPDATED, _handle_wire_station_msgs };
 static const msg_handler_entry_t _wire_stations_cleared_handler_entry = { MSG_WIRE_STATIONS_CLEARED, _handle_wire_station_msgs };
 
 /**
@@ -87,9 +98,13 @@ static const msg_handler_entry_t* _handler_entries[] = {
     &_input_char_ready_handler_entry,
     &_kob_status_handler_entry,
     &_cmd_key_pressed_handler_entry,
+    &_wire_capture_write_handler_entry,
+    &_wire_capture_replay_handler_entry,
     &_touch_panel_handler_entry,
     &_wire_current_sender_handler_entry,
-    &_wire_station_id_handler_entry,
+    &_wire_station_updated_handler_entry,
+    &_wire_station_added_handler_entry,
+    &_wire_station_expired_handler_entry,
     &_wire_stations_cleared_handler_entry,
     &_wire_connected_state_handler_entry,
     &_wifi_status_handler_entry,
@@ -103,6 +118,7 @@ static const msg_handler_entry_t* _handler_entries[] = {
 
 static const idle_fn _ui_idle_functions[] = {
     (idle_fn)_ui_idle_function_1,
+    (idle_fn)_ui_idle_function_2,
     (idle_fn)0, // Last entry must be a NULL
 };
 
@@ -112,7 +128,14 @@ msg_loop_cntx_t ui_msg_loop_cntx = {
     _ui_idle_functions,
 };
 
-static const char* _sender_id = NULL;
+/** The current sender (it isn't in the displayed list). */
+static mk_station_handle_t _sender = MK_STATION_NONE;
+static char _sender_id[MK_STATION_ID_MAX_LEN + 1];
+/** Active stations being displayed (in display order, without the current sender). */
+static mk_station_handle_t _stations[MK_MAX_ACTIVE_STATIONS];
+/** The station information (for ordering) for the displayed stations. */
+static mk_station_info_t _stations_info[MK_MAX_ACTIVE_STATIONS];
+static int _stations_count = 0;
 
 // ============================================
 // Idle functions
@@ -130,6 +153,11 @@ static void _ui_idle_function_1() {
     }
 }
 
+static void _ui_idle_function_2() {
+    // Apply the queued display commands and paint the next changed span.
+    disp_cmdq_render_task();
+}
+
 
 // ============================================
 // Message handler functions
@@ -207,6 +235,8 @@ static void _handle_code_window_output(cmt_msg_t* msg) {
  */
 static void _handle_init_terminal(cmt_msg_t* msg) {
     _ui_init_terminal_shell();
+    ui_term_update_sender(MK_STATION_NONE == _sender ? NULL : _sender_id);
+    ui_term_update_stations(_stations, _stations_count, 0);
 }
 
 static void _handle_kob_status(cmt_msg_t* msg) {
@@ -231,6 +261,14 @@ static void _handle_wifi_conn_status_update(cmt_msg_t* msg) {
     debug_printf(true, "UI - Update wifi status: %u\n", wifi_status);
 }
 
+static void _handle_wire_capture_replay(cmt_msg_t* msg) {
+    mkcap_replay_next();
+}
+
+static void _handle_wire_capture_write(cmt_msg_t* msg) {
+    mkcap_write();
+}
+
 static void _handle_wire_changed(cmt_msg_t* msg) {
     uint16_t wire_no = msg->data.wire;
     ui_disp_update_wire(wire_no);
@@ -260,52 +298,74 @@ static void _handle_wire_connected_state(cmt_msg_t* msg) {
 
 /**
  * Handle all messages from the wire that involve a Station ID.
+ *
+ * The station messages are incremental (added, updated, expired), so the displayed
+ * list is kept in order by moving just the station involved, and only the rows
+ * from the first one that changed are redrawn.
  */
 static void _handle_wire_station_msgs(cmt_msg_t *msg) {
-    const char* msg_station_id = msg->data.station_id;
-
     if (MSG_WIRE_CURRENT_SENDER == msg->id) {
-        if (_sender_id) {
-            if (strcmp(_sender_id, msg_station_id) == 0) {
-                return;
-            }
+        mk_station_handle_t sender = msg->data.station;
+        if (sender == _sender) {
+            return;
         }
         // Different station, store it and update the UI.
-        _sender_id = msg->data.station_id;
-        ui_disp_update_sender(_sender_id);
-        ui_term_update_sender(_sender_id);
+        mk_station_handle_t prev_sender = _sender;
+        _sender = sender;
+        const char* id = NULL;
+        if (sender != MK_STATION_NONE) {
+            mkstation_id(sender, _sender_id, MK_STATION_ID_MAX_LEN);
+            id = _sender_id;
+        }
+        ui_disp_update_sender(id);
+        ui_term_update_sender(id);
+        // Take the new sender out of the list, and put the previous one back in.
+        int from = _station_list_remove(sender);
+        if (from < 0) {
+            from = _stations_count;
+        }
+        if (prev_sender != MK_STATION_NONE) {
+            int i = _station_list_insert(prev_sender);
+            if (i >= 0 && i < from) {
+                from = i;
+            }
+        }
+        _stations_changed(from);
     }
-    else if (MSG_WIRE_STATION_ID_RCVD == msg->id) {
-        const mk_station_id_t **stations = mkwire_active_stations();
-        // Remove current sender and sort.
-        int count = 0;
-        while (*(stations + count)) {
-            count++;
+    else if (MSG_WIRE_STATION_ADDED == msg->id) {
+        int i = _station_list_insert(msg->data.station);
+        if (i >= 0) {
+            _stations_changed(i);
         }
-        const mk_station_id_t *ss[count];
-        const mk_station_id_t **ssp = ss;
-        int sc = 0;
-        // Don't include the current sender.
-        for (int i = 0; i < count; i++) {
-            const mk_station_id_t *station = *stations++;
-            if (strcmp(_sender_id, station->id) != 0) {
-                *ssp++ = station;
-                sc++;
+    }
+    else if (MSG_WIRE_STATION_UPDATED == msg->id) {
+        // Its order may have changed. Take it out and put it back in.
+        int from = _station_list_remove(msg->data.station);
+        if (from >= 0) {
+            int i = _station_list_insert(msg->data.station);
+            if (i >= 0 && i < from) {
+                from = i;
             }
+            _stations_changed(from);
+        }
+    }
+    else if (MSG_WIRE_STATION_EXPIRED == msg->id) {
+        if (msg->data.station == _sender) {
+            // The sender stays displayed, but the handle can be reused.
+            _sender = MK_STATION_NONE;
+        }
+        int i = _station_list_remove(msg->data.station);
+        if (i >= 0) {
+            _stations_changed(i);
         }
-        ss[sc] = (mk_station_id_t*)0; // Mark end with NULL
-        _sort_station_list(ss, sc);
-        ui_disp_update_stations(ss, sc);
-        ui_term_update_stations(ss, sc);
     }
     else if (MSG_WIRE_STATIONS_CLEARED == msg->id) {
         // Remove all of the stations and the current sender.
-        _sender_id = NULL;
-        ui_disp_update_sender(_sender_id);
-        ui_term_update_sender(_sender_id);
-        const mk_station_id_t** stations = mkwire_active_stations();
-        ui_disp_update_stations(stations, 0);
-        ui_term_update_stations(stations, 0);
+        _sender = MK_STATION_NONE;
+        ui_disp_update_sender(NULL);
+        ui_term_update_sender(NULL);
+        _stations_count = 0;
+        _stations_changed(0);
     }
 }
 
@@ -314,15 +374,7 @@ static void _handle_wire_station_msgs(cmt_msg_t *msg) {
 // Internal functions
 // ============================================
 
-static void _qsort_swap(void *v[], int i, int j) {
-    void *temp;
-
-    temp = v[i];
-    v[i] = v[j];
-    v[j] = temp;
-}
-
-static int _qsort_sl_comp(const mk_station_id_t *s1, const mk_station_id_t *s2) {
+static int _station_list_comp(const mk_station_info_t *s1, const mk_station_info_t *s2) {
     // Sort by last received from (longest first).
     // If we haven't received from the station, sort by time first seen.
     if (s1->ts_recv != 0 || s2->ts_recv != 0) {
@@ -350,27 +402,56 @@ static int _qsort_sl_comp(const mk_station_id_t *s1, const mk_station_id_t *s2)
     return 0;
 }
 
-static void _qsort_sl(const mk_station_id_t *s[], int left, int right) {
-    int last;
-
-    // Do nothing if array contains fewer than two elements.
-    if (left >= right) {
-        return;
+/**
+ * @brief Insert a station into the displayed list (in order).
+ *
+ * The current sender isn't put in the list, nor is a station that is already in it.
+ *
+ * @return The index it was inserted at, or -1 if it wasn't.
+ */
+static int _station_list_insert(mk_station_handle_t station) {
+    mk_station_info_t info;
+    if (_stations_count >= MK_MAX_ACTIVE_STATIONS || station == _sender || !mkstation_info(station, &info)) {
+        return (-1);
     }
-    _qsort_swap((void **)s, left, (left + right) / 2);
-    last = left;
-    for (int i = left+1; i <= right; i++) {
-        if (_qsort_sl_comp(s[i], s[left]) < 0) {
-            _qsort_swap((void **)s, ++last, i);
+    int at = _stations_count;
+    for (int i = _stations_count - 1; i >= 0; i--) {
+        if (_stations[i] == station) {
+            return (-1);
+        }
+        if (_station_list_comp(&info, &_stations_info[i]) < 0) {
+            at = i;
+        }
+    }
+    memmove(&_stations[at + 1], &_stations[at], (_stations_count - at) * sizeof(mk_station_handle_t));
+    memmove(&_stations_info[at + 1], &_stations_info[at], (_stations_count - at) * sizeof(mk_station_info_t));
+    _stations[at] = station;
+    _stations_info[at] = info;
+    _stations_count++;
+
+    return (at);
+}
+
+/**
+ * @brief Remove a station from the displayed list.
+ *
+ * @return The index it was removed from, or -1 if it wasn't in the list.
+ */
+static int _station_list_remove(mk_station_handle_t station) {
+    for (int i = 0; i < _stations_count; i++) {
+        if (_stations[i] == station) {
+            _stations_count--;
+            memmove(&_stations[i], &_stations[i + 1], (_stations_count - i) * sizeof(mk_station_handle_t));
+            memmove(&_stations_info[i], &_stations_info[i + 1], (_stations_count - i) * sizeof(mk_station_info_t));
+            return (i);
         }
     }
-    _qsort_swap((void**)s, left, last);
-    _qsort_sl(s, left, last-1);
-    _qsort_sl(s, last+1, right);
+    return (-1);
 }
 
-static void _sort_station_list(const mk_station_id_t *stations[], int len) {
-    _qsort_sl(stations, 0, len - 1);
+static void _stations_changed(int from) {
+    ui_disp_update_stations(_stations, _stations_count, from);
+    ui_term_update_stations(_stations, _stations_count, from);
 }
 
 static void _ui_init_terminal_shell() {
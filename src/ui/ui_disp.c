@@ -7,6 +7,7 @@
 */
 #include "ui_disp.h"
 #include "config.h"
+#include "disp_cmdq.h"
 #include "display.h"
 #include "font.h"
 #include "util.h"
@@ -56,7 +57,7 @@
 
 static uint16_t _active_stations_lines;
 static bool _code_displaying;
-static const char* _current_sender;
+static bool _sender_shown;
 static kob_status_t _kob_status;
 
 static void _header_fill_fixed() {
@@ -93,6 +94,8 @@ static void _status_fill_fixed() {
 
 void ui_disp_build(void) {
     _code_displaying = false;
+    // Anything queued would be cleared
+    disp_cmdq_flush();
     disp_text_colors_set(C16_LT_GREEN, C16_BLACK);
     disp_clear(Paint);
     disp_scroll_area_define(UI_DISP_TOP_FIXED_LINES, (UI_DISP_BOTTOM_FIXED_LINES + _active_stations_lines));
@@ -118,43 +121,40 @@ void ui_disp_display_wire() {
 
 void ui_disp_put_codetext(char* str) {
     if (!_code_displaying) {
-        disp_print_crlf(0, No_Paint);
+        disp_cmdq_print_crlf();
         _code_displaying = true;
     }
+    disp_cmdq_prints(str);
     // If this is a '=' print a newline.
     if (strchr(str, '=')) {
-        disp_prints(str, No_Paint);
-        disp_print_crlf(0, Paint);
-    }
-    else {
-        disp_prints(str, Paint);
+        disp_cmdq_print_crlf();
     }
 }
 
 void ui_disp_puts(char* str) {
     if (_code_displaying) {
-        disp_print_crlf(0, No_Paint);
+        disp_cmdq_print_crlf();
         _code_displaying = false;
     }
-    disp_prints(str, Paint);
+    disp_cmdq_prints(str);
 }
 
 void ui_disp_update_circuit_closed(bool closed) {
     char indicator = (closed ? LOOP_CLOSED_CHR : LOOP_OPEN_CHR);
-    disp_char_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_LOOP_COL, indicator, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG, Paint); // Loop
+    disp_cmdq_char_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_LOOP_COL, indicator, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG); // Loop
 }
 
 void ui_disp_update_connected_state(wire_connected_state_t state) {
     char* state_indicator = (WIRE_CONNECTED == state ? "\026\027" : "\024\025"); // Conn/Not-Conn LF/RT
-    disp_string_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_CONNECTED_ICON_COL,
-        state_indicator, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG, Paint);
+    disp_cmdq_string_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_CONNECTED_ICON_COL,
+        state_indicator, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG);
 }
 
 void ui_disp_update_key_closed(bool closed) {
     char indicator_l = (closed ? CLOSER_CLOSED_LG_L_CHR : CLOSER_OPEN_LG_L_CHR);
     char indicator_r = (closed ? CLOSER_CLOSED_LG_R_CHR : CLOSER_OPEN_LG_R_CHR);
-    disp_char_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_CLOSER_COL, indicator_l, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG, Paint); // Closer Left
-    disp_char_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_CLOSER_COL + 1, indicator_r, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG, Paint); // Closer Right
+    disp_cmdq_char_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_CLOSER_COL, indicator_l, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG); // Closer Left
+    disp_cmdq_char_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_CLOSER_COL + 1, indicator_r, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG); // Closer Right
 }
 
 void ui_disp_update_kob_status(const kob_status_t* kob_status) {
@@ -177,20 +177,21 @@ void ui_disp_update_sender(const char* id) {
     char buf[disp_info_columns() + 1];
 
     // If we had a sender print a new-line and a line of dashes in the code window
-    if (*id && *_current_sender) {
-        disp_print_crlf(0, No_Paint);
+    if (id && *id && _sender_shown) {
+        disp_cmdq_print_crlf();
         for (int i = 0; i < disp_info_columns(); i++) {
             buf[i] = '-';
         }
-        disp_prints(buf, Paint);
+        buf[disp_info_columns()] = '\000';
+        disp_cmdq_prints(buf);
     }
-    _current_sender = id;
+    _sender_shown = (id && *id);
     disp_text_colors_get(&cp);
     disp_text_colors_set(UI_DISP_SENDER_COLOR_FG, UI_DISP_SENDER_COLOR_BG);
-    disp_line_clear(UI_DISP_SENDER_LINE, (id ? No_Paint : Paint));
+    disp_cmdq_line_clear(UI_DISP_SENDER_LINE);
     if (id) {
         snprintf(buf, sizeof(buf) - 1, ">%s", id);
-        disp_string(UI_DISP_SENDER_LINE, 0, buf, false, Paint);
+        disp_cmdq_string(UI_DISP_SENDER_LINE, 0, buf, false);
     }
     disp_text_colors_cp_set(&cp);
 }
@@ -199,31 +200,38 @@ void ui_disp_update_speed(uint16_t speed) {
     char buf[5];
 
     snprintf(buf, sizeof(buf) - 1, "%-2hd", speed);
-    disp_string_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_SPEED_VALUE_COL, buf, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG, Paint);
+    disp_cmdq_string_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_SPEED_VALUE_COL, buf, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG);
 }
 
-void ui_disp_update_stations(const mk_station_id_t** stations, int count) {
-    // Erase the current stations area
-    for (int j = (UI_DISP_STATUS_LINE - 1); j > (UI_DISP_STATUS_LINE - (_active_stations_lines + 1)); j--) {
-        disp_line_clear(j, No_Paint);
-    }
+void ui_disp_update_stations(const mk_station_handle_t* stations, int count, int from) {
     // How many lines to display
     int lines = (count <= UI_DISP_STATIONS_LINES_MAX ? count : UI_DISP_STATIONS_LINES_MAX);
+    if (lines != _active_stations_lines) {
+        // The area changes size, so everything moves. Erase the current stations area.
+        for (int j = (UI_DISP_STATUS_LINE - 1); j > (UI_DISP_STATUS_LINE - (_active_stations_lines + 1)); j--) {
+            disp_cmdq_line_clear(j);
+        }
+        from = 0;
+    }
+    else if (from >= lines) {
+        // The change is below what is shown.
+        return;
+    }
     // Set the scroll area if needed (if it needs to be different from the current)
     if ((lines + UI_DISP_BOTTOM_FIXED_LINES) != disp_info_fixed_bottom_lines()) {
+        disp_cmdq_flush();
         disp_scroll_area_define(UI_DISP_TOP_FIXED_LINES, (lines + UI_DISP_BOTTOM_FIXED_LINES));
     }
     _active_stations_lines = lines;
-    // Display the stations
-    uint16_t line = UI_DISP_STATUS_LINE - lines;
+    // Display the stations (that changed)
+    uint16_t line = UI_DISP_STATUS_LINE - lines + from;
     uint16_t cols = disp_info_columns();
     char buf[cols];
-    for (int i = 0; i < lines; i++) {
-        const mk_station_id_t * station = *(stations + i);
-        snprintf(buf, cols, "%s", station->id);
-        disp_string_color(line++, 0, buf, UI_DISP_STATIONS_COLOR_FG, UI_DISP_STATIONS_COLOR_BG, No_Paint);
+    for (int i = from; i < lines; i++) {
+        disp_cmdq_line_clear(line);
+        mkstation_id(stations[i], buf, cols - 1);
+        disp_cmdq_string_color(line++, 0, buf, UI_DISP_STATIONS_COLOR_FG, UI_DISP_STATIONS_COLOR_BG);
     }
-    disp_paint();
 }
 
 void ui_disp_update_status() {
@@ -233,12 +241,12 @@ void ui_disp_update_status() {
 
     rtc_get_datetime(&now);
     strdatetime(buf, 9, &now, SDTC_TIME_2CHAR_HOUR | SDTC_TIME_AMPM);
-    disp_string_color(UI_DISP_STATUS_LINE, UI_DISP_STATUS_TIME_COL, buf, UI_DISP_STATUS_COLOR_FG, UI_DISP_STATUS_COLOR_BG, Paint);
+    disp_cmdq_string_color(UI_DISP_STATUS_LINE, UI_DISP_STATUS_TIME_COL, buf, UI_DISP_STATUS_COLOR_FG, UI_DISP_STATUS_COLOR_BG);
 }
 
 void ui_disp_update_wire(uint16_t wire) {
     char buf[5];
 
     snprintf(buf, sizeof(buf) - 1, "%-3hd", wire);
-    disp_string_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_WIRE_VALUE_COL, buf, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG, Paint);
+    disp_cmdq_string_color(UI_DISP_HEADER_INFO_LINE, UI_DISP_HEADER_WIRE_VALUE_COL, buf, UI_DISP_HEADER_COLOR_FG, UI_DISP_HEADER_COLOR_BG);
 }
@@ -113,13 +113,14 @@ extern void ui_disp_update_speed(uint16_t speed);
  * @brief Update the active stations list area.
  * @ingroup ui
  *
- * The list is NULL terminated, but we also pass in the count to allow formatting
- * without having to scan the list first.
+ * Only the stations from `from` on are redrawn, unless the number of lines
+ * needed for the list has changed.
  *
- * @param stations List of Station ID structure pointers.
+ * @param stations List of station handles.
  * @param count The number of stations in the list.
+ * @param from The index of the first station that changed.
  */
-extern void ui_disp_update_stations(const mk_station_id_t** stations, int count);
+extern void ui_disp_update_stations(const mk_station_handle_t* stations, int count, int from);
 
 /**
  * @brief Update the status bar.
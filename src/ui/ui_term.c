@@ -17,7 +17,7 @@
 #include <ctype.h>
 #include <string.h>
 
-static const char* _current_sender;
+static bool _sender_shown;
 static term_color_t _color_term_text_current_bg;
 static term_color_t _color_term_text_current_fg;
 
@@ -34,6 +34,7 @@ static kob_status_t _kob_status;
 
 static uint16_t _scroll_end_line;
 static uint16_t _station_list_separator_line;
+static int _station_list_lines;
 
 static ui_term_input_available_handler _input_available_handler;
 static ui_term_getline_callback_fn _getline_callback; // Function pointer to be called when an input line is ready
@@ -227,6 +228,8 @@ static void _term_init() {
     term_set_size(UI_TERM_LINES, UI_TERM_COLUMNS);
     term_clear();
     _draw_station_list_box(0);
+    _station_list_lines = 0;
+    _sender_shown = false;
     term_cursor_on(false);
     term_cursor_moveto(1,1);
     ui_term_use_code_color();
@@ -238,7 +241,6 @@ void ui_term_build(void) {
     _status_fill_fixed();
     ui_term_display_speed();
     ui_term_display_wire();
-    ui_term_update_sender(mkwire_current_sender());
     ui_term_update_status();
     ui_term_update_connected_state(mkwire_connected_state());
     ui_term_update_kob_status(kob_status());
@@ -465,14 +467,14 @@ void ui_term_update_sender(const char* id) {
     char buf[UI_TERM_COLUMNS + 1];
 
     // If we had a sender print a new-line and a line of dashes in the code window
-    if (*id && *_current_sender) {
+    if (id && *id && _sender_shown) {
         putchar('\n');
         for (int i = 0; i < UI_TERM_COLUMNS; i++) {
             buf[i] = '-';
         }
         printf("%s", buf);
     }
-    _current_sender = id;
+    _sender_shown = (id && *id);
     // Save the current location and colors and update the 'Sender' line
     term_cursor_save();
     term_color_fg(UI_TERM_SENDER_COLOR_FG);
@@ -502,30 +504,37 @@ void ui_term_update_speed(uint16_t speed) {
     term_cursor_restore();
 }
 
-void ui_term_update_stations(const mk_station_id_t** stations, int count) {
+void ui_term_update_stations(const mk_station_handle_t* stations, int count, int from) {
     int lines = count / UI_TERM_STATIONS_PER_LINE;
     if (lines * UI_TERM_STATIONS_PER_LINE < count) {
         lines++;
     }
-    _draw_station_list_box(lines);
+    if (lines != _station_list_lines) {
+        // The box changes size, so everything moves.
+        _draw_station_list_box(lines);
+        _station_list_lines = lines;
+        from = 0;
+    }
     if (count > 0) {
         int start_line = UI_TERM_STATION_LIST_LAST_LINE - (lines - 1);
         int slen = UI_TERM_COLUMNS / UI_TERM_STATIONS_PER_LINE;
+        int first_line = (from < count ? from : count) / UI_TERM_STATIONS_PER_LINE;
+        int i = (first_line * UI_TERM_STATIONS_PER_LINE);
+        char name[UI_TERM_COLUMNS + 1];
         term_cursor_save();
         term_color_fg(UI_TERM_STATION_LIST_COLOR_FG);
         term_color_bg(UI_TERM_STATION_LIST_COLOR_BG);
         term_set_origin_mode(TERM_OM_UPPER_LEFT);
-        // Display the stations
-        for (int l = 0; l < lines; l++) {
+        // Display the stations (from the line with the first one that changed)
+        for (int l = first_line; l < lines; l++) {
             term_cursor_moveto((start_line + l), 1);
             for (int c = 0; c < UI_TERM_STATIONS_PER_LINE; c++) {
-                const mk_station_id_t* station = *stations;
-                const char* name = (station ? station->id : "");
+                *name = '\000';
+                if (i < count) {
+                    mkstation_id(stations[i++], name, slen);
+                }
                 printf("%-*.*s", slen, slen, name);
                 term_cursor_right_1();
-                if (*stations) {
-                    stations++;
-                }
             }
         }
         term_set_origin_mode(TERM_OM_IN_MARGINS);
@@ -536,10 +545,23 @@ void ui_term_update_stations(const mk_station_id_t** stations, int count) {
 void ui_term_update_status() {
     // Put the current time in the center
     char buf[10];
+    char rtt_buf[14];
     datetime_t now;
+    mkwire_link_stats_t ls;
 
     rtc_get_datetime(&now);
     strdatetime(buf, 9, &now, SDTC_TIME_2CHAR_HOUR | SDTC_TIME_AMPM);
+    // And the server round trip time on the right (while connected)
+    mkwire_link_stats(&ls);
+    if (WIRE_LINK_DOWN == ls.state) {
+        rtt_buf[0] = '\000';
+    }
+    else if (ls.rtt_ms >= 0) {
+        snprintf(rtt_buf, sizeof(rtt_buf), "RTT:%dms", (ls.rtt_ms < 9999 ? ls.rtt_ms : 9999));
+    }
+    else {
+        snprintf(rtt_buf, sizeof(rtt_buf), "RTT:---");
+    }
     term_color_pair_t tc = ui_term_color_get();
     term_cursor_save();
     term_color_fg(UI_TERM_STATUS_COLOR_FG);
@@ -547,6 +569,8 @@ void ui_term_update_status() {
     term_set_origin_mode(TERM_OM_UPPER_LEFT);
     term_cursor_moveto(UI_TERM_STATUS_LINE, UI_TERM_STATUS_TIME_COL);
     printf("%s", buf);
+    term_cursor_moveto(UI_TERM_STATUS_LINE, UI_TERM_STATUS_RTT_COL);
+    printf("%-12s", rtt_buf);
     term_set_origin_mode(TERM_OM_IN_MARGINS);
     term_cursor_restore();
     ui_term_color_set(tc.fg, tc.bg);
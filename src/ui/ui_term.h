@@ -66,6 +66,7 @@ extern "C" {
 #define UI_TERM_STATUS_LINE (UI_TERM_LINES)
 #define UI_TERM_STATUS_LOGO_COL (UI_TERM_COLUMNS - 2)
 #define UI_TERM_STATUS_TIME_COL ((UI_TERM_COLUMNS / 2) - 3)
+#define UI_TERM_STATUS_RTT_COL (UI_TERM_STATUS_LOGO_COL - 14)
 
 // Scroll margins
 #define UI_TERM_SCROLL_START_LINE (3)
@@ -309,13 +310,14 @@ extern void ui_term_update_sender(const char* id);
  * @brief Update the active stations list area.
  * @ingroup ui
  *
- * The list is NULL terminated, but we also pass in the count to allow formatting
- * without having to scan the list first.
+ * Only the stations from `from` on are redrawn, unless the number of lines
+ * needed for the list has changed.
  *
- * @param stations List of Station ID structure pointers.
+ * @param stations List of station handles.
  * @param count The number of stations in the list.
+ * @param from The index of the first station that changed.
  */
-extern void ui_term_update_stations(const mk_station_id_t** stations, int count);
+extern void ui_term_update_stations(const mk_station_handle_t* stations, int count, int from);
 
 /**
  * @brief Update the speed value.